@@ -41,6 +41,11 @@ static void print_arglist(int exit_code) {
                "  -s, -syntax                      show syntax tree and stop\n"
                "  -comments                        generate comments\n"
                "  -coverage                        generate coverage report\n"
+               "  -profile-use PROFILE             optimise C for counts from -coverage\n"
+               "  -among table|trie|hash|compact   how to generate C for among\n"
+               "  -grouping bitmap|table           how to generate C for UTF-8 groupings\n"
+               "  -ascii                           also generate C specialised for ASCII\n"
+               "  -inline-runtime                  inline commonest runtime functions in C\n"
                "  -ada                             generate Ada\n"
                "  -c++                             generate C++\n"
                "  -cs, -csharp                     generate C#\n"
@@ -193,6 +198,49 @@ static struct options * read_options(int * argc_ptr, char * argv[]) {
                 o->coverage = true;
                 continue;
             }
+            if (eq(s, "-profile-use")) {
+                check_lim(i, argc);
+                o->profile_use = argv[i++];
+                continue;
+            }
+            if (eq(s, "-grouping")) {
+                check_lim(i, argc);
+                s = argv[i++];
+                if (eq(s, "bitmap")) {
+                    o->grouping_mode = GROUPING_BITMAP;
+                } else if (eq(s, "table")) {
+                    o->grouping_mode = GROUPING_TABLE;
+                } else {
+                    fprintf(stderr, "unknown -grouping mode '%s'\n", s);
+                    print_arglist(1);
+                }
+                continue;
+            }
+            if (eq(s, "-among")) {
+                check_lim(i, argc);
+                s = argv[i++];
+                if (eq(s, "table")) {
+                    o->among_mode = AMONG_TABLE;
+                } else if (eq(s, "trie")) {
+                    o->among_mode = AMONG_TRIE;
+                } else if (eq(s, "hash")) {
+                    o->among_mode = AMONG_HASH;
+                } else if (eq(s, "compact")) {
+                    o->among_mode = AMONG_COMPACT;
+                } else {
+                    fprintf(stderr, "unknown -among mode '%s'\n", s);
+                    print_arglist(1);
+                }
+                continue;
+            }
+            if (eq(s, "-ascii")) {
+                o->ascii = true;
+                continue;
+            }
+            if (eq(s, "-inline-runtime")) {
+                o->inline_runtime = true;
+                continue;
+            }
             if (eq(s, "-ep") || eq(s, "-eprefix")) {
                 check_lim(i, argc);
                 o->externals_prefix = argv[i++];
@@ -375,6 +423,22 @@ static struct options * read_options(int * argc_ptr, char * argv[]) {
         if (o->coverage) {
             fprintf(stderr, "warning: -coverage only currently supported for C and C++\n");
         }
+        if (o->profile_use) {
+            fprintf(stderr, "warning: -profile-use only meaningful for C and C++\n");
+        }
+        if (o->among_mode != AMONG_TABLE) {
+            fprintf(stderr, "warning: -among only meaningful for C and C++\n");
+        }
+        if (o->grouping_mode != GROUPING_BITMAP) {
+            fprintf(stderr, "warning: -grouping only meaningful for C and C++\n");
+        }
+        if (o->inline_runtime) {
+            fprintf(stderr, "warning: -inline-runtime only meaningful for C and C++\n");
+        }
+    }
+
+    if (o->ascii && o->target_lang != LANG_C) {
+        fprintf(stderr, "warning: -ascii only meaningful for C\n");
     }
 
     // Split any extension off o->output_file and set o->output_leaf to just
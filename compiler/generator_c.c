@@ -12,6 +12,7 @@
 static void generate(struct generator * g, struct node * p);
 static void w(struct generator * g, const char * s);
 static void writef(struct generator * g, const char * s, struct node * p);
+static void write_among_call(struct generator * g, struct node * p);
 
 /* Write routines for items from the syntax tree */
 
@@ -40,6 +41,9 @@ static void write_varname(struct generator * g, struct name * p) {
         write_char(g, '_');
     }
     write_s(g, p->s);
+    if (g->ascii && (p->type == t_routine || p->type == t_external)) {
+        write_string(g, "_ascii");
+    }
 }
 
 /* Reference to variable, e.g. when assigning to or using in an expression. */
@@ -220,6 +224,9 @@ static void writef(struct generator * g, const char * input, struct node * p) {
                 write_s(g, g->B[j]);
                 continue;
             }
+            case 'A': // Call to look up an among.
+                write_among_call(g, p);
+                continue;
             case 'F': { // Among function dispatcher.
                 struct among * x = p->among;
                 if (x->function_count == 0) {
@@ -232,7 +239,11 @@ static void writef(struct generator * g, const char * input, struct node * p) {
                     struct amongvec * v = x->b;
                     for (int j = 0; j < x->literalstring_count; j++) {
                         if (v[j].function) {
+                            // Among functions don't have ASCII versions.
+                            int ascii = g->ascii;
+                            g->ascii = false;
                             write_varref(g, v[j].function);
+                            g->ascii = ascii;
                             goto continue_outer_loop;
                         }
                     }
@@ -299,6 +310,13 @@ static void w(struct generator * g, const char * s) {
     writef(g, s, NULL);
 }
 
+/* Can the text contain multi-byte characters?  This is false when generating
+ * the routines specialised for ASCII input, which step a byte at a time.
+ */
+static int multibyte_text(struct generator * g) {
+    return g->options->encoding == ENC_UTF8 && !g->ascii;
+}
+
 /* Write out a statement with additional code to propagate a negative return
  * value which indicates an error.
  *
@@ -380,7 +398,7 @@ static void generate_AE(struct generator * g, struct node * p) {
             w(g, p->mode == m_forward ? "z->l" : "z->lb");
             break;
         case c_len:
-            if (g->options->encoding == ENC_UTF8) {
+            if (multibyte_text(g)) {
                 w(g, "len_utf8(z->p)");
                 break;
             }
@@ -389,7 +407,7 @@ static void generate_AE(struct generator * g, struct node * p) {
             w(g, "SIZE(z->p)");
             break;
         case c_lenof:
-            if (g->options->encoding == ENC_UTF8) {
+            if (multibyte_text(g)) {
                 writef(g, "len_utf8(~V)", p);
                 break;
             }
@@ -657,7 +675,7 @@ static void generate_do(struct generator * g, struct node * p) {
 
 static void generate_next(struct generator * g, struct node * p) {
     write_comment(g, p);
-    if (g->options->encoding == ENC_UTF8) {
+    if (multibyte_text(g)) {
         if (p->mode == m_forward)
             w(g, "~{~Mint ret = skip_utf8(z->p, z->c, z->l, 1");
         else
@@ -676,21 +694,279 @@ static void generate_next(struct generator * g, struct node * p) {
     }
 }
 
+// With -coverage, generated C code counts how often each among string and
+// grouping matches, and provides a function to dump the counts.
+static int counting_coverage(struct generator * g) {
+    return g->options->coverage && g->options->target_lang == LANG_C;
+}
+
+// With -among trie, amongs with up to this many strings are looked up by a
+// generated function instead of find_among() (larger ones would generate a
+// lot of code for little gain over the binary search).
+#define AMONG_TRIE_MAX_STRINGS 128
+
+static int among_trie(struct generator * g, struct among * x) {
+    return g->options->among_mode == AMONG_TRIE &&
+           !g->options->coverage &&
+           x->literalstring_count <= AMONG_TRIE_MAX_STRINGS;
+}
+
+// With -among hash, backward amongs with at least this many strings are
+// looked up with find_among_b_hash() (for smaller ones the binary search
+// only needs a few comparisons).
+#define AMONG_HASH_MIN_STRINGS 32
+
+static int among_hash(struct generator * g, struct among * x) {
+    return g->options->among_mode == AMONG_HASH &&
+           !g->options->coverage &&
+           x->node->mode == m_backward &&
+           x->literalstring_count >= AMONG_HASH_MIN_STRINGS;
+}
+
+// With -among compact, amongs are stored in struct among_compact, which
+// needs each string's length, result and routine number to fit in an
+// unsigned char, and the offset of each string in the pool to fit in an
+// unsigned short.
+static int among_compact(struct generator * g, struct among * x) {
+    if (g->options->among_mode != AMONG_COMPACT || g->options->coverage ||
+        g->among_pool_too_big) {
+        return false;
+    }
+    if (x->longest_size > 255 || x->function_count > 255 ||
+        x->literalstring_count > 32767) {
+        return false;
+    }
+    for (int i = 0; i < x->literalstring_count; i++) {
+        if (x->b[i].result > 255) return false;
+    }
+    return true;
+}
+
+static void write_among_call(struct generator * g, struct node * p) {
+    struct among * x = p->among;
+    if (among_trie(g, x)) {
+        w(g, "fa_");
+        write_int(g, x->number);
+        w(g, "(z)");
+        return;
+    }
+    if (among_hash(g, x)) {
+        w(g, "find_among_b_hash(z, a_");
+        write_int(g, x->number);
+        writef(g, ", ~F, &a_", p);
+        write_int(g, x->number);
+        w(g, "_hash)");
+        return;
+    }
+    w(g, "find_among");
+    if (p->mode != m_forward) w(g, "_b");
+    if (counting_coverage(g)) w(g, "_counted");
+    if (among_compact(g, x)) {
+        w(g, "_compact(z, &a_");
+    } else {
+        w(g, "(z, a_");
+    }
+    write_int(g, x->number);
+    w(g, ", ");
+    write_int(g, x->literalstring_count);
+    writef(g, ", ~F", p);
+    if (counting_coverage(g)) {
+        w(g, ", a_");
+        write_int(g, x->number);
+        w(g, "_counts");
+    }
+    w(g, ")");
+}
+
+static void set_bit(symbol * b, int i) { b[i >> 3] |= 1 << (i & 7); }
+
+// Is grouping character ch in the bitmap for grouping q?
+static int grouping_has(struct grouping * q, const symbol * map, int ch) {
+    if (ch < q->smallest_ch || ch > q->largest_ch) return false;
+    ch -= q->smallest_ch;
+    return (map[ch >> 3] >> (ch & 7)) & 1;
+}
+
+// Add the page of 64 characters from base in grouping q to pages (unless
+// there's already an identical one) and return its index, or 0 if none of
+// the characters are in q.
+static int utf8_grouping_page(struct grouping * q, const symbol * map, int base,
+                              byte * pages, int * n_pages) {
+    byte page[8] = { 0 };
+    int empty = true;
+    for (int i = 0; i < 64; i++) {
+        if (grouping_has(q, map, base + i)) {
+            page[i >> 3] |= 1 << (i & 7);
+            empty = false;
+        }
+    }
+    if (empty) return 0;
+    for (int k = 1; k < *n_pages; k++) {
+        if (memcmp(pages + k * 8, page, 8) == 0) return k;
+    }
+    memcpy(pages + *n_pages * 8, page, 8);
+    return (*n_pages)++;
+}
+
+// Build the lookup tables which follow the bitmap for grouping q with
+// -grouping table (see in_grouping_U_table() in the runtime for the layout)
+// and return their size, or 0 if they aren't used for q.  If tables isn't
+// NULL, set *tables to them (to be freed by the caller).
+static int utf8_grouping_tables(struct generator * g, struct grouping * q,
+                                symbol * map, byte ** tables) {
+    if (g->options->grouping_mode != GROUPING_TABLE ||
+        g->options->encoding != ENC_UTF8 ||
+        g->options->coverage) {
+        return 0;
+    }
+
+    // Up to 32 pages for two byte characters and 16 * 64 for three.
+    byte * pages = MALLOC((1 + 32 + 16 * 64) * 8);
+    int n_pages = 1;
+    byte * rows = MALLOC((1 + 16) * 64);
+    int n_rows = 1;
+    byte * lead = MALLOC(256);
+    int ok = true;
+
+    memset(pages, 0, 8);
+    memset(rows, 0, 64);
+    memset(lead, 0, 256);
+    for (int b = 0; b < 0xC0; b++) {
+        lead[b] = grouping_has(q, map, b);
+    }
+    for (int b = 0xC0; b < 0xE0; b++) {
+        int k = utf8_grouping_page(q, map, (b & 0x1F) << 6, pages, &n_pages);
+        if (k > 255) ok = false;
+        lead[b] = k;
+    }
+    for (int b = 0xE0; b < 0xF0; b++) {
+        byte * row = rows + n_rows * 64;
+        int empty = true;
+        for (int b1 = 0; b1 < 64; b1++) {
+            int k = utf8_grouping_page(q, map, (b & 0xF) << 12 | b1 << 6,
+                                       pages, &n_pages);
+            if (k > 255) ok = false;
+            row[b1] = k;
+            if (k) empty = false;
+        }
+        if (empty) continue;
+        int r = 1;
+        while (r < n_rows && memcmp(rows + r * 64, row, 64) != 0) ++r;
+        if (r == n_rows) ++n_rows;
+        lead[b] = r;
+    }
+    lead[0xFF] = n_rows;
+
+    int size = 256 + n_rows * 64 + n_pages * 8;
+    if (ok && tables) {
+        byte * t = MALLOC(size);
+        memcpy(t, lead, 256);
+        memcpy(t + 256, rows, n_rows * 64);
+        memcpy(t + 256 + n_rows * 64, pages, n_pages * 8);
+        *tables = t;
+    }
+    FREE(lead);
+    FREE(rows);
+    FREE(pages);
+    return ok ? size : 0;
+}
+
+static symbol * grouping_bitmap(struct grouping * q) {
+    int range = q->largest_ch - q->smallest_ch + 1;
+    int size = (range + 7) / 8;  /* assume 8 bits per symbol */
+    symbol * b = q->b;
+    symbol * map = create_b(size);
+
+    for (int i = 0; i < size; i++) map[i] = 0;
+
+    for (int i = 0; i < SIZE(b); i++) set_bit(map, b[i] - q->smallest_ch);
+    SET_SIZE(map, size);
+    return map;
+}
+
+// The suffix of the runtime function names to test grouping q.
+static const char * grouping_suffix(struct generator * g, struct grouping * q) {
+    if (!multibyte_text(g)) return "";
+    symbol * map = grouping_bitmap(q);
+    int tables = utf8_grouping_tables(g, q, map, NULL);
+    lose_b(map);
+    return tables ? "_U_table" : "_U";
+}
+
+// Maximum number of characters in a grouping for the runtime to scan it
+// with in_grouping_scan() etc.
+#define GROUPING_SCAN_MAX_CHARS 16
+
+// If grouping q is suitable for in_grouping_scan() etc, write its characters
+// as a C string to buf (which must be big enough) and return true.
+static int grouping_scan_chars(struct generator * g, struct grouping * q,
+                               char * buf) {
+    if (g->options->coverage) return false;
+    if (q->smallest_ch < 1 || q->largest_ch > 127) return false;
+    symbol * map = grouping_bitmap(q);
+    int n = 0;
+    char * out = buf;
+    *out++ = '"';
+    for (int ch = q->smallest_ch; ch <= q->largest_ch; ch++) {
+        if (!grouping_has(q, map, ch)) continue;
+        if (++n > GROUPING_SCAN_MAX_CHARS) break;
+        if (ch == '"' || ch == '\\') {
+            *out++ = '\\';
+            *out++ = ch;
+        } else if (ch < 32 || ch == 127 || ch == '?') {
+            // Octal escape (also for '?' to avoid any trigraphs).
+            *out++ = '\\';
+            *out++ = '0' + (ch >> 6);
+            *out++ = '0' + ((ch >> 3) & 7);
+            *out++ = '0' + (ch & 7);
+        } else {
+            *out++ = ch;
+        }
+    }
+    *out++ = '"';
+    *out = '\0';
+    lose_b(map);
+    return n <= GROUPING_SCAN_MAX_CHARS;
+}
+
 static void generate_GO_grouping(struct generator * g, struct node * p, int is_goto, int complement) {
     write_comment(g, p);
 
     struct grouping * q = p->name->grouping;
     g->S[0] = p->mode == m_forward ? "" : "_b";
     g->S[1] = complement ? "in" : "out";
-    g->S[2] = g->options->encoding == ENC_UTF8 ? "_U" : "";
+    g->S[2] = grouping_suffix(g, q);
     g->I[0] = q->smallest_ch;
     g->I[1] = q->largest_ch;
-    if (is_goto) {
+
+    // Long runs of ASCII can be skipped using SIMD.
+    char chars[GROUPING_SCAN_MAX_CHARS * 4 + 3];
+    if (p->mode == m_forward && grouping_scan_chars(g, q, chars)) {
+        g->S[2] = multibyte_text(g) ? "_U" : "";
+        g->S[3] = chars;
+        if (is_goto) {
+            writef(g, "~Mif (~S1_grouping_scan~S2(z, ~V, ~I0, ~I1, ~S3) < 0) ~f~N", p);
+        } else {
+            writef(g, "~{"
+                  "~Mint ret = ~S1_grouping_scan~S2(z, ~V, ~I0, ~I1, ~S3);~N"
+                  "~Mif (ret < 0) ~f~N", p);
+        }
+    } else if (counting_coverage(g)) {
+        if (is_goto) {
+            writef(g, "~Mif (count_grouping_scan(~V_counts, ~S1_grouping~S0~S2(z, ~V, ~I0, ~I1, 1)) < 0) ~f~N", p);
+        } else {
+            writef(g, "~{"
+                  "~Mint ret = count_grouping_scan(~V_counts, ~S1_grouping~S0~S2(z, ~V, ~I0, ~I1, 1));~N"
+                  "~Mif (ret < 0) ~f~N", p);
+        }
+    } else if (is_goto) {
         writef(g, "~Mif (~S1_grouping~S0~S2(z, ~V, ~I0, ~I1, 1) < 0) ~f~N", p);
     } else {
         writef(g, "~{"
               "~Mint ret = ~S1_grouping~S0~S2(z, ~V, ~I0, ~I1, 1);~N"
               "~Mif (ret < 0) ~f~N", p);
+    }
+    if (!is_goto) {
 
         if (p->mode == m_forward)
             w(g, "~Mz->c += ret;~N");
@@ -839,7 +1115,7 @@ static void generate_atmark(struct generator * g, struct node * p) {
 
 static void generate_hop(struct generator * g, struct node * p) {
     write_comment(g, p);
-    if (g->options->encoding == ENC_UTF8) {
+    if (multibyte_text(g)) {
         g->S[0] = p->mode == m_forward ? "" : "_b";
         g->S[1] = p->mode == m_forward ? "z->l" : "z->lb";
         w(g, "~{~Mint ret = skip~S0_utf8(z->p, z->c, ~S1, ");
@@ -1166,10 +1442,12 @@ static void generate_grouping(struct generator * g, struct node * p, int complem
     struct grouping * q = p->name->grouping;
     g->S[0] = p->mode == m_forward ? "" : "_b";
     g->S[1] = complement ? "out" : "in";
-    g->S[2] = g->options->encoding == ENC_UTF8 ? "_U" : "";
+    g->S[2] = grouping_suffix(g, q);
     g->I[0] = q->smallest_ch;
     g->I[1] = q->largest_ch;
-    if (tailcallable(g, p)) {
+    if (counting_coverage(g)) {
+        writef(g, "~Mif (count_grouping(~V_counts, ~S1_grouping~S0~S2(z, ~V, ~I0, ~I1, 0))) ~f~N", p);
+    } else if (tailcallable(g, p)) {
         writef(g, "~Mreturn !~S1_grouping~S0~S2(z, ~V, ~I0, ~I1, 0);~N", p);
         p->right = NULL;
     } else {
@@ -1270,6 +1548,15 @@ static void generate_define(struct generator * g, struct node * p) {
     g->failure_label = x_return;
     g->label_used = 0;
 
+    /* Tail call optimisation unlinks the "functionend" node, so note where
+     * it is to restore it afterwards in case we generate the routine again
+     * specialised for ASCII.
+     */
+    struct node * last = p->left;
+    if (last->type == c_bra && last->left) last = last->left;
+    while (last->right && last->right->type != c_functionend) last = last->right;
+    struct node * end = last->right;
+
     /* Generate function body. */
     generate(g, p->left);
     if (p->left->right) {
@@ -1278,6 +1565,7 @@ static void generate_define(struct generator * g, struct node * p) {
             generate(g, p->left->right);
         }
     }
+    last->right = end;
     w(g, "~}");
 }
 
@@ -1286,6 +1574,189 @@ static void generate_functionend(struct generator * g, struct node * p) {
     w(g, "~Mreturn 1;~N");
 }
 
+// With -profile-use, we read the counts written by the coverage_dump()
+// function of a -coverage build and use them to add checks for the most
+// frequently matched among strings before the binary search.
+struct profile_count {
+    struct profile_count * next;
+    int line_number;
+    byte * s;            // NULL for the "(no match)" count.
+    unsigned long count;
+};
+
+// Maximum number of strings to check for before calling find_among().
+#define PROFILE_MAX_FAST_PATHS 3
+
+static const char * leafname(const char * file) {
+    const char * slash = strrchr(file, '/');
+    return slash ? slash + 1 : file;
+}
+
+static void read_profile_line(struct generator * g, const byte * line, int len,
+                              const char * leaf) {
+    // Lines look like: "path/to/english.sbl:123\t'ing'\t42".
+    int tab1 = 0;
+    while (tab1 < len && line[tab1] != '\t') ++tab1;
+    int tab2 = len - 1;
+    while (tab2 > tab1 && line[tab2] != '\t') --tab2;
+    if (tab2 <= tab1) return;
+
+    int colon = tab1 - 1;
+    while (colon >= 0 && line[colon] != ':') --colon;
+    if (colon < 0) return;
+
+    char buf[32];
+    int n = tab1 - colon - 1;
+    if (n <= 0 || n >= (int)sizeof(buf)) return;
+    memcpy(buf, line + colon + 1, n);
+    buf[n] = '\0';
+    int line_number = atoi(buf);
+
+    n = len - tab2 - 1;
+    if (n <= 0 || n >= (int)sizeof(buf)) return;
+    memcpy(buf, line + tab2 + 1, n);
+    buf[n] = '\0';
+    unsigned long count = strtoul(buf, NULL, 10);
+
+    // Only use counts for the source file we're compiling.
+    int start = colon;
+    while (start > 0 && line[start - 1] != '/') --start;
+    if ((size_t)(colon - start) != strlen(leaf) ||
+        memcmp(line + start, leaf, colon - start) != 0) return;
+
+    const byte * s = line + tab1 + 1;
+    n = tab2 - tab1 - 1;
+    byte * string;
+    if (n >= 2 && s[0] == '\'' && s[n - 1] == '\'') {
+        string = create_s_from_data((const char *)s + 1, n - 2);
+    } else if (n == 10 && memcmp(s, "(no match)", 10) == 0) {
+        string = NULL;
+    } else {
+        // Grouping counts aren't used yet.
+        return;
+    }
+
+    NEW(profile_count, q);
+    q->next = g->profile;
+    q->line_number = line_number;
+    q->s = string;
+    q->count = count;
+    g->profile = q;
+}
+
+static void read_profile(struct generator * g) {
+    const char * file = g->options->profile_use;
+    byte * u = get_input(file);
+    if (u == NULL) {
+        fprintf(stderr, "Can't open profile %s\n", file);
+        exit(1);
+    }
+    const char * leaf = leafname(g->analyser->tokeniser->file);
+    int i = 0;
+    while (i < SIZE(u)) {
+        int start = i;
+        while (i < SIZE(u) && u[i] != '\n') ++i;
+        read_profile_line(g, u + start, i - start, leaf);
+        ++i;
+    }
+    lose_s(u);
+}
+
+static void free_profile(struct generator * g) {
+    while (g->profile) {
+        struct profile_count * q = g->profile;
+        g->profile = q->next;
+        lose_s(q->s);
+        FREE(q);
+    }
+}
+
+// Return the profiled count for string b of size size on line line_number,
+// or for the among at line_number failing to match if b is NULL.
+static unsigned long profile_lookup(struct generator * g, int line_number,
+                                    const symbol * b, int size) {
+    for (struct profile_count * q = g->profile; q; q = q->next) {
+        if (q->line_number != line_number) continue;
+        if (b == NULL || q->s == NULL) {
+            if (b == NULL && q->s == NULL) return q->count;
+            continue;
+        }
+        if (SIZE(q->s) != size) continue;
+        int i = 0;
+        while (i < size && q->s[i] == b[i]) ++i;
+        if (i == size) return q->count;
+    }
+    return 0;
+}
+
+// Is there a longer string in among x which must also match if v does?
+// find_among() returns the longest match, so we can only check for v
+// before calling it if there isn't.
+static int among_extends(struct among * x, int mode, const struct amongvec * v) {
+    for (int i = 0; i < x->literalstring_count; i++) {
+        const struct amongvec * u = &x->b[i];
+        if (u->size <= v->size) continue;
+        int offset = (mode == m_forward ? 0 : u->size - v->size);
+        int j = 0;
+        while (j < v->size && u->b[offset + j] == v->b[j]) ++j;
+        if (j == v->size) return true;
+    }
+    return false;
+}
+
+// Find the strings in among x which are worth checking for before calling
+// find_among(), most frequent first.  Returns the number found.
+static int profile_fast_paths(struct generator * g, struct among * x, int mode,
+                              int * fast) {
+    if (g->profile == NULL || g->options->coverage) return 0;
+    // The strings aren't in separate arrays to check for.
+    if (among_trie(g, x) || among_compact(g, x)) return 0;
+
+    struct amongvec * v = x->b;
+    unsigned long total = profile_lookup(g, x->node->line_number, NULL, 0);
+    for (int i = 0; i < x->literalstring_count; i++) {
+        total += profile_lookup(g, v[i].line_number, v[i].b, v[i].size);
+    }
+    if (total == 0) return 0;
+
+    int n_fast = 0;
+    unsigned long fast_count[PROFILE_MAX_FAST_PATHS];
+    for (int i = 0; i < x->literalstring_count; i++) {
+        // Strings with a routine condition need find_among() to call it.
+        if (v[i].size == 0 || v[i].function) continue;
+        unsigned long count = profile_lookup(g, v[i].line_number, v[i].b, v[i].size);
+        // An extra check costs more than it saves for rarer strings.
+        if (count == 0 || count < total / 8) continue;
+        if (among_extends(x, mode, &v[i])) continue;
+        // Insertion sort into the array of the most frequent.
+        int j = n_fast;
+        if (j == PROFILE_MAX_FAST_PATHS) {
+            if (count <= fast_count[j - 1]) continue;
+            --j;
+        } else {
+            ++n_fast;
+        }
+        while (j > 0 && fast_count[j - 1] < count) {
+            fast[j] = fast[j - 1];
+            fast_count[j] = fast_count[j - 1];
+            --j;
+        }
+        fast[j] = i;
+        fast_count[j] = count;
+    }
+    return n_fast;
+}
+
+static void write_fast_path_checks(struct generator * g, struct among * x,
+                                   const int * fast, int n_fast) {
+    for (int k = 0; k < n_fast; k++) {
+        if (k) w(g, " || ");
+        g->I[2] = x->b[fast[k]].size;
+        g->I[3] = fast[k];
+        w(g, "eq_s~S0(z, ~I2, s_~I0_~I3)");
+    }
+}
+
 static void generate_substring(struct generator * g, struct node * p) {
     write_comment(g, p);
 
@@ -1402,8 +1873,17 @@ static void generate_substring(struct generator * g, struct node * p) {
 #endif
     }
 
+    int fast[PROFILE_MAX_FAST_PATHS];
+    int n_fast = profile_fast_paths(g, x, p->mode, fast);
+
     if (x->amongvar_needed) {
-        writef(g, "~Mamong_var = find_among~S0(z, a_~I0, ~I1, ~F);~N", p);
+        for (int k = 0; k < n_fast; k++) {
+            g->I[2] = x->b[fast[k]].size;
+            g->I[3] = fast[k];
+            g->I[4] = x->b[fast[k]].result;
+            writef(g, "~Mif (eq_s~S0(z, ~I2, s_~I0_~I3)) among_var = ~I4; else~N", p);
+        }
+        writef(g, "~Mamong_var = ~A;~N", p);
         if (!x->always_matches) {
             writef(g, "~Mif (!among_var) ~f~N", p);
         }
@@ -1424,13 +1904,28 @@ static void generate_substring(struct generator * g, struct node * p) {
         }
     }
 
-    if (x->always_matches) {
-        writef(g, "~Mfind_among~S0(z, a_~I0, ~I1, ~F);~N", p);
+    if (n_fast) {
+        if (x->always_matches) {
+            w(g, "~Mif (!(");
+            write_fast_path_checks(g, x, fast, n_fast);
+            writef(g, ")) ~A;~N", p);
+        } else if (x->command_count == 0 && tailcallable(g, p)) {
+            w(g, "~Mreturn ");
+            write_fast_path_checks(g, x, fast, n_fast);
+            writef(g, " || ~A != 0;~N", p);
+            x->node->right = NULL;
+        } else {
+            w(g, "~Mif (!(");
+            write_fast_path_checks(g, x, fast, n_fast);
+            writef(g, " || ~A)) ~f~N", p);
+        }
+    } else if (x->always_matches) {
+        writef(g, "~M~A;~N", p);
     } else if (x->command_count == 0 && tailcallable(g, p)) {
-        writef(g, "~Mreturn find_among~S0(z, a_~I0, ~I1, ~F) != 0;~N", p);
+        writef(g, "~Mreturn ~A != 0;~N", p);
         x->node->right = NULL;
     } else {
-        writef(g, "~Mif (!find_among~S0(z, a_~I0, ~I1, ~F)) ~f~N", p);
+        writef(g, "~Mif (!~A) ~f~N", p);
     }
 }
 
@@ -1589,6 +2084,12 @@ static void generate_head(struct generator * g) {
     if (o->target_lang == LANG_CPLUSPLUS) {
         w(g, "#define SNOWBALL_RUNTIME_THROW_EXCEPTIONS~N");
     }
+    if (o->inline_runtime) {
+        w(g, "#define SNOWBALL_RUNTIME_INLINE~N");
+    }
+    if (o->encoding == ENC_WIDECHARS) {
+        w(g, "#define SNOWBALL_WIDECHARS~N");
+    }
     if (g->analyser->debug_used) {
         w(g, "#define SNOWBALL_DEBUG_COMMAND_USED~N");
     }
@@ -1706,16 +2207,85 @@ static void generate_head(struct generator * g) {
     }
 }
 
+// Check that the commands in p can't put a non-ASCII character in the text
+// or in a string variable (from which it could then be inserted).
+static int writes_only_ascii(struct node * p) {
+    for (; p; p = p->right) {
+        switch (p->type) {
+            case c_insert:
+            case c_attach:
+            case c_assign:
+            case c_slicefrom: {
+                symbol * b = p->literalstring;
+                if (b == NULL) break;
+                for (int i = 0; i < SIZE(b); i++) {
+                    if (b[i] >= 0x80) return false;
+                }
+                break;
+            }
+        }
+        if (p->type == c_among) {
+            struct among * x = p->among;
+            for (int i = 0; i < x->command_count; i++) {
+                if (!writes_only_ascii(x->commands[i])) return false;
+            }
+        }
+        if (!writes_only_ascii(p->left) || !writes_only_ascii(p->aux))
+            return false;
+    }
+    return true;
+}
+
+// Should we generate a second copy of each routine specialised for input
+// which is all ASCII?  On such input the UTF-8 code steps a byte at a time
+// anyway, so the copies can use the single-byte code instead, provided the
+// program never writes a non-ASCII character.
+static int ascii_specialised(struct generator * g) {
+    return g->options->ascii && g->options->encoding == ENC_UTF8 &&
+           !g->options->coverage &&
+           writes_only_ascii(g->analyser->program);
+}
+
+// Mark the routines called from the commands in p (and so from their ASCII
+// versions).  Routines only used as among functions are always called from
+// find_among() using the table, so don't need an ASCII version.
+static void mark_ascii_calls(struct node * p) {
+    for (; p; p = p->right) {
+        if (p->type == c_call) {
+            struct name * q = p->name;
+            if (q->type == t_routine && !q->ascii_called) {
+                q->ascii_called = true;
+                mark_ascii_calls(q->definition->left);
+            }
+        } else if (p->type == c_among) {
+            struct among * x = p->among;
+            for (int i = 0; i < x->command_count; i++) {
+                mark_ascii_calls(x->commands[i]);
+            }
+        }
+        mark_ascii_calls(p->left);
+        mark_ascii_calls(p->aux);
+    }
+}
+
+// Does routine or external q need an ASCII version?
+static int ascii_version_needed(struct name * q) {
+    return q->type == t_external || q->ascii_called;
+}
+
 static void generate_routine_declarations(struct generator * g) {
+    int variants = ascii_specialised(g) ? 2 : 1;
     if (g->options->target_lang == LANG_C) {
         w(g, "#ifdef __cplusplus~N"
              "extern \"C\" {~N"
              "#endif~N");
         for (struct name * q = g->analyser->names; q; q = q->next) {
             if (q->type == t_external) {
-                w(g, "extern int ");
-                write_varname(g, q);
-                w(g, "(struct SN_env * z);~N");
+                for (g->ascii = 0; g->ascii < variants; g->ascii++) {
+                    w(g, "extern int ");
+                    write_varname(g, q);
+                    w(g, "(struct SN_env * z);~N");
+                }
             }
         }
         w(g, "#ifdef __cplusplus~N"
@@ -1726,13 +2296,178 @@ static void generate_routine_declarations(struct generator * g) {
     if (g->analyser->name_count[t_routine]) {
         for (struct name * q = g->analyser->names; q; q = q->next) {
             if (q->type == t_routine) {
-                w(g, "static int ");
-                write_varname(g, q);
-                w(g, "(struct SN_env * z);~N");
+                for (g->ascii = 0; g->ascii < variants; g->ascii++) {
+                    if (g->ascii && !ascii_version_needed(q)) continue;
+                    w(g, "static int ");
+                    write_varname(g, q);
+                    w(g, "(struct SN_env * z);~N");
+                }
             }
         }
         write_newline(g);
     }
+    g->ascii = false;
+}
+
+// Generate af_N() to call the condition routine for among x which is
+// selected by z->af (only needed if it uses more than one).
+static void generate_among_function_dispatch(struct generator * g, struct among * x) {
+    struct amongvec * v = x->b;
+
+    if (x->function_count <= 1) return;
+
+    g->I[0] = x->number;
+    w(g, "~N~Mstatic int af_~I0(struct SN_env * z) {~N~+");
+    w(g, "~Mswitch (z->af) {~N~+");
+    for (int n = 1; n <= x->function_count; n++) {
+        w(g, "~Mcase ");
+        write_int(g, n);
+        w(g, ": return ");
+        for (int i = 0; i < x->literalstring_count; i++) {
+            if (v[i].function_index == n) {
+                write_varref(g, v[i].function);
+                w(g, "(z);~N");
+                break;
+            }
+        }
+    }
+    w(g, "~-~M}~N");
+    w(g, "~Mreturn -1;~N");
+    w(g, "~-~M}~N");
+}
+
+// The hash of the string in v (matching find_among_b_hash() in the runtime).
+static unsigned long among_hash_key(const struct amongvec * v, unsigned long seed) {
+    unsigned long x = seed;
+    for (int i = v->size - 1; i >= 0; i--) {
+        x = ((x ^ v->b[i]) * 16777619UL) & 0xffffffffUL;
+    }
+    return x ^ (x >> 15);
+}
+
+// Try to place the n strings in among x whose indices are in ids into slots
+// using hash seed, choosing a displacement for each bucket (largest buckets
+// first).  Returns false if two strings can't be separated.
+static int build_among_hash(struct among * x, const int * ids, int n,
+                            unsigned long seed, int slot_bits, int bucket_bits,
+                            int * slots, int * displace) {
+    int n_slots = 1 << slot_bits;
+    int n_buckets = 1 << bucket_bits;
+    unsigned long * keys = MALLOC(n * sizeof(unsigned long));
+    int * bucket_size = MALLOC(n_buckets * sizeof(int));
+    int max_size = 0;
+    int ok = true;
+
+    for (int i = 0; i < n_slots; i++) slots[i] = 0;
+    for (int b = 0; b < n_buckets; b++) {
+        displace[b] = 0;
+        bucket_size[b] = 0;
+    }
+    for (int k = 0; k < n; k++) {
+        keys[k] = among_hash_key(&x->b[ids[k]], seed);
+        int b = keys[k] & (n_buckets - 1);
+        if (++bucket_size[b] > max_size) max_size = bucket_size[b];
+    }
+
+    for (int size = max_size; ok && size > 0; size--) {
+        for (int b = 0; ok && b < n_buckets; b++) {
+            if (bucket_size[b] != size) continue;
+            int d;
+            for (d = 0; d < n_slots; d++) {
+                int k;
+                for (k = 0; k < n; k++) {
+                    if ((int)(keys[k] & (n_buckets - 1)) != b) continue;
+                    int slot = ((keys[k] >> 16) ^ d) & (n_slots - 1);
+                    if (slots[slot]) break;
+                    // Claim the slot so later keys in this bucket collide.
+                    slots[slot] = ids[k] + 1;
+                }
+                if (k == n) break;
+                // Undo the slots claimed for this bucket.
+                for (int j = 0; j < k; j++) {
+                    if ((int)(keys[j] & (n_buckets - 1)) != b) continue;
+                    slots[((keys[j] >> 16) ^ d) & (n_slots - 1)] = 0;
+                }
+            }
+            if (d == n_slots) {
+                ok = false;
+            } else {
+                displace[b] = d;
+            }
+        }
+    }
+    FREE(bucket_size);
+    FREE(keys);
+    return ok;
+}
+
+static void write_int_array(struct generator * g, const int * a, int n) {
+    w(g, "{~+");
+    for (int i = 0; i < n; i++) {
+        if (i % 16 == 0) {
+            w(g, "~N~M");
+        } else {
+            write_char(g, ' ');
+        }
+        write_int(g, a[i]);
+        if (i < n - 1) write_char(g, ',');
+    }
+    w(g, "~N~-~M};~N");
+}
+
+static void generate_among_hash(struct generator * g, struct among * x) {
+    int * ids = MALLOC(x->literalstring_count * sizeof(int));
+    int n = 0;
+    unsigned long sizes = 0;
+    for (int i = 0; i < x->literalstring_count; i++) {
+        int size = x->b[i].size;
+        if (size == 0) continue;
+        ids[n++] = i;
+        if (size <= 32) sizes |= 1UL << (size - 1);
+    }
+
+    int slot_bits = 1;
+    while ((1 << slot_bits) < 2 * n) ++slot_bits;
+    for ( ; slot_bits <= 16; slot_bits++) {
+        // Aim for an average of at most four strings in each bucket.
+        int bucket_bits = slot_bits > 3 ? slot_bits - 3 : 0;
+        int * slots = MALLOC((1 << slot_bits) * sizeof(int));
+        int * displace = MALLOC((1 << bucket_bits) * sizeof(int));
+        for (int attempt = 0; attempt < 100; attempt++) {
+            unsigned long seed = (2166136261UL + attempt * 0x9e3779b9UL) & 0xffffffffUL;
+            if (!build_among_hash(x, ids, n, seed, slot_bits, bucket_bits,
+                                  slots, displace)) {
+                continue;
+            }
+
+            char buf[64];
+            g->I[0] = x->number;
+            g->I[1] = 1 << slot_bits;
+            g->I[2] = 1 << bucket_bits;
+            w(g, "~N~Mstatic const unsigned short a_~I0_slots[~I1] = ");
+            write_int_array(g, slots, 1 << slot_bits);
+            w(g, "~Mstatic const unsigned short a_~I0_displace[~I2] = ");
+            write_int_array(g, displace, 1 << bucket_bits);
+            g->I[1] = slot_bits;
+            g->I[2] = bucket_bits;
+            g->I[3] = x->longest_size;
+            w(g, "~Mstatic const struct among_hash a_~I0_hash = {~N~+");
+            checked_snprintf(buf, sizeof(buf), "%luUL", seed);
+            g->S[1] = buf;
+            w(g, "~Ma_~I0_slots, a_~I0_displace, ~S1, ~I1, ~I2, ~I3, ");
+            checked_snprintf(buf, sizeof(buf), "0x%lxUL", sizes);
+            w(g, "~S1~N~-~M};~N");
+            FREE(displace);
+            FREE(slots);
+            FREE(ids);
+            return;
+        }
+        FREE(displace);
+        FREE(slots);
+    }
+    fprintf(stderr, "%s:%d: failed to generate hash table for among\n",
+            g->analyser->tokeniser->file, x->node->line_number);
+    exit(1);
 }
 
 static void generate_among_table(struct generator * g, struct among * x) {
@@ -1799,47 +2534,352 @@ static void generate_among_table(struct generator * g, struct among * x) {
     }
     w(g, "~N};~N");
 
-    if (x->function_count <= 1) return;
+    if (counting_coverage(g)) {
+        g->I[0] = x->number;
+        g->I[1] = x->literalstring_count + 1;
+        w(g, "~Mstatic unsigned long a_~I0_counts[~I1];~N");
+    }
 
-    w(g, "~N~Mstatic int af_~I0(struct SN_env * z) {~N~+");
-    w(g, "~Mswitch (z->af) {~N~+");
-    for (int n = 1; n <= x->function_count; n++) {
-        w(g, "~Mcase ");
-        write_int(g, n);
-        w(g, ": return ");
-        for (int i = 0; i < x->literalstring_count; i++) {
-            if (v[i].function_index == n) {
-                write_varref(g, v[i].function);
-                w(g, "(z);~N");
-                break;
+    if (among_hash(g, x)) generate_among_hash(g, x);
+
+    generate_among_function_dispatch(g, x);
+}
+
+// The symbol of among string v which is compared at depth (counting from
+// the cursor in the direction of matching).
+static symbol trie_symbol(const struct amongvec * v, int mode, int depth) {
+    return mode == m_forward ? v->b[depth] : v->b[v->size - 1 - depth];
+}
+
+// Generate the decision tree for the n strings listed in ids, all of which
+// are at least depth symbols long and agree on their first depth symbols.
+static void generate_trie_node(struct generator * g, struct among * x,
+                               int mode, const int * ids, int n, int depth) {
+    struct amongvec * v = x->b;
+    int n_longer = 0;
+    for (int k = 0; k < n; k++) {
+        const struct amongvec * u = &v[ids[k]];
+        if (u->size == depth) {
+            g->I[2] = u->size;
+            g->I[3] = u->result;
+            g->I[4] = ids[k];
+            if (x->function_count) {
+                w(g, "~Mw = ~I4;~N");
+            } else {
+                w(g, "~Mr = ~I3; n = ~I2;~N");
             }
+        } else {
+            ++n_longer;
+        }
+    }
+    if (n_longer == 0) return;
+
+    // Group the longer strings by their next symbol.
+    int * next = MALLOC(n_longer * sizeof(int));
+    symbol * cases = MALLOC(n_longer * sizeof(symbol));
+    int n_cases = 0;
+    for (int k = 0; k < n; k++) {
+        const struct amongvec * u = &v[ids[k]];
+        if (u->size == depth) continue;
+        symbol ch = trie_symbol(u, mode, depth);
+        int j = 0;
+        while (j < n_cases && cases[j] != ch) ++j;
+        if (j == n_cases) cases[n_cases++] = ch;
+    }
+
+    g->I[2] = depth;
+    g->I[3] = depth + 1;
+    if (mode == m_forward) {
+        g->S[1] = depth ? "c + ~I2 < z->l" : "c < z->l";
+        g->S[2] = depth ? "p[c + ~I2]" : "p[c]";
+    } else {
+        g->S[1] = depth ? "c - ~I2 > z->lb" : "c > z->lb";
+        g->S[2] = "p[c - ~I3]";
+    }
+    w(g, "~Mif (");
+    w(g, g->S[1]);
+    if (n_cases == 1) {
+        w(g, " && ");
+        w(g, g->S[2]);
+        g->I[4] = cases[0];
+        w(g, " == ~c4) {~N~+");
+    } else {
+        w(g, ") {~N~+~Mswitch (");
+        w(g, g->S[2]);
+        w(g, ") {~N~+");
+    }
+    for (int j = 0; j < n_cases; j++) {
+        int m = 0;
+        for (int k = 0; k < n; k++) {
+            const struct amongvec * u = &v[ids[k]];
+            if (u->size > depth && trie_symbol(u, mode, depth) == cases[j]) {
+                next[m++] = ids[k];
+            }
+        }
+        if (n_cases > 1) {
+            g->I[4] = cases[j];
+            w(g, "~Mcase ~c4:~N~+");
+        }
+        generate_trie_node(g, x, mode, next, m, depth + 1);
+        if (n_cases > 1) {
+            w(g, "~Mbreak;~N~-");
+        }
+    }
+    if (n_cases > 1) {
+        w(g, "~-~M}~N");
+    }
+    w(g, "~-~M}~N");
+    FREE(cases);
+    FREE(next);
+}
+
+// Generate fa_N(), which does the same as calling find_among() or
+// find_among_b() on among x but tests the symbols in the string directly.
+// Like find_among() it first finds the longest string which matches and then
+// tries the conditions of it and of its substrings in turn.
+static void generate_among_trie(struct generator * g, struct among * x) {
+    struct amongvec * v = x->b;
+    int mode = x->node->mode;
+
+    write_newline(g);
+    write_comment(g, x->node);
+
+    g->I[0] = x->number;
+    g->S[0] = mode == m_forward ? "+" : "-";
+    // The empty string (if present) matches without looking at the string.
+    int empty = -1;
+    int * ids = MALLOC(x->literalstring_count * sizeof(int));
+    int n = 0;
+    for (int i = 0; i < x->literalstring_count; i++) {
+        if (v[i].size) {
+            ids[n++] = i;
+        } else {
+            empty = i;
+        }
+    }
+
+    w(g, "~Mstatic int fa_~I0(struct SN_env * z) {~N~+");
+    if (n) w(g, "~Mconst symbol * p = z->p;~N");
+    w(g, "~Mint c = z->c;~N");
+    if (x->function_count) {
+        g->I[1] = empty;
+        w(g, "~Mint w = ~I1;~N");
+    } else {
+        g->I[1] = empty >= 0 ? v[empty].result : 0;
+        w(g, "~Mint r = ~I1, n = 0;~N");
+    }
+
+    generate_trie_node(g, x, mode, ids, n, 0);
+    FREE(ids);
+
+    g->I[0] = x->number;
+    g->S[0] = mode == m_forward ? "+" : "-";
+    if (!x->function_count) {
+        w(g, "~Mif (r) z->c = c ~S0 n;~N");
+        w(g, "~Mreturn r;~N");
+        w(g, "~-~M}~N");
+        return;
+    }
+
+    w(g, "~Mwhile (w >= 0) {~N~+");
+    w(g, "~Mswitch (w) {~N~+");
+    for (int i = 0; i < x->literalstring_count; i++) {
+        g->I[1] = i;
+        g->I[2] = v[i].size;
+        g->I[3] = v[i].result;
+        g->I[4] = v[i].i;
+        w(g, "~Mcase ~I1:~N~+");
+        w(g, "~Mz->c = c ~S0 ~I2;~N");
+        if (v[i].function) {
+            w(g, "~Mif (");
+            write_varref(g, v[i].function);
+            w(g, "(z)) {~N~+");
+            w(g, "~Mz->c = c ~S0 ~I2;~N");
+            w(g, "~Mreturn ~I3;~N");
+            w(g, "~-~M}~N");
+            w(g, "~Mw = ~I4;~N");
+            w(g, "~Mbreak;~N~-");
+        } else {
+            w(g, "~Mreturn ~I3;~N~-");
         }
     }
     w(g, "~-~M}~N");
-    w(g, "~Mreturn -1;~N");
     w(g, "~-~M}~N");
+    w(g, "~Mreturn 0;~N");
+    w(g, "~-~M}~N");
+}
+
+static int compare_amongvec_size(const void * a, const void * b) {
+    const struct amongvec * u = *(const struct amongvec * const *)a;
+    const struct amongvec * v = *(const struct amongvec * const *)b;
+    return v->size - u->size;
+}
+
+// Find where string v occurs in the first pool_size symbols of pool, or
+// return -1 if it doesn't.
+static int find_in_pool(const symbol * pool, int pool_size, const struct amongvec * v) {
+    for (int offset = 0; offset + v->size <= pool_size; offset++) {
+        if (memcmp(pool + offset, v->b, v->size * sizeof(symbol)) == 0) {
+            return offset;
+        }
+    }
+    return -1;
+}
+
+// Pack the strings of all the amongs using the compact form into a pool.
+// Strings are added longest first, so any string which occurs within one
+// already added (often as a suffix) doesn't need adding again.  If the pool
+// would be too big for the offsets to fit in an unsigned short then none of
+// the amongs use the compact form.
+//
+// This needs to be called before generating any code, since whether an
+// among uses the compact form affects how it's called.  Some amongs may
+// turn out not to need a table once their code is generated, but any
+// strings of theirs in the pool are harmless.
+static void build_among_pool(struct generator * g) {
+    int n = 0;
+    int total_size = 0;
+    for (struct among * x = g->analyser->amongs; x; x = x->next) {
+        if (!x->used || !among_compact(g, x)) continue;
+        for (int i = 0; i < x->literalstring_count; i++) {
+            total_size += x->b[i].size;
+        }
+        n += x->literalstring_count;
+    }
+    if (n == 0) return;
+
+    struct amongvec ** by_size = MALLOC(n * sizeof(struct amongvec *));
+    n = 0;
+    for (struct among * x = g->analyser->amongs; x; x = x->next) {
+        if (!x->used || !among_compact(g, x)) continue;
+        for (int i = 0; i < x->literalstring_count; i++) {
+            by_size[n++] = &x->b[i];
+        }
+    }
+    qsort(by_size, n, sizeof(struct amongvec *), compare_amongvec_size);
+
+    symbol * pool = MALLOC((total_size + 1) * sizeof(symbol));
+    int pool_size = 0;
+    for (int k = 0; k < n; k++) {
+        if (find_in_pool(pool, pool_size, by_size[k]) < 0) {
+            memcpy(pool + pool_size, by_size[k]->b, by_size[k]->size * sizeof(symbol));
+            pool_size += by_size[k]->size;
+        }
+    }
+    FREE(by_size);
+    if (pool_size > 65535) {
+        FREE(pool);
+        g->among_pool_too_big = true;
+        return;
+    }
+
+    g->among_pool = pool;
+    g->among_pool_size = pool_size;
+}
+
+// Generate a_pool, holding the strings packed by build_among_pool(), and set
+// offsets to the position of each string in it (in order of among and then
+// string).
+static void generate_among_pool(struct generator * g, int * offsets) {
+    int pool_size = g->among_pool_size;
+    int n = 0;
+    for (struct among * x = g->analyser->amongs; x; x = x->next) {
+        if (!x->used || !among_compact(g, x)) continue;
+        for (int i = 0; i < x->literalstring_count; i++) {
+            offsets[n++] = find_in_pool(g->among_pool, pool_size, &x->b[i]);
+        }
+    }
+
+    if (pool_size) {
+        g->I[0] = pool_size;
+        w(g, "~N~Mstatic const symbol a_pool[~I0] = {~+");
+        for (int i = 0; i < pool_size; i++) {
+            if (i % 16 == 0) {
+                w(g, "~N~M");
+            } else {
+                write_char(g, ' ');
+            }
+            wlitch(g, g->among_pool[i]);
+            if (i < pool_size - 1) write_char(g, ',');
+        }
+        w(g, "~N~-~M};~N");
+    }
+}
+
+// Generate among x in the compact form, with its strings at offsets in
+// a_pool.
+static void generate_among_compact(struct generator * g, struct among * x,
+                                   const int * offsets) {
+    struct amongvec * v = x->b;
+    int n = x->literalstring_count;
+    int * a = MALLOC(n * sizeof(int));
+
+    write_newline(g);
+    write_comment(g, x->node);
+
+    g->I[0] = x->number;
+    g->I[1] = n;
+    w(g, "~Mstatic const unsigned short a_~I0_offset[~I1] = ");
+    write_int_array(g, offsets, n);
+    for (int i = 0; i < n; i++) a[i] = v[i].size;
+    w(g, "~Mstatic const unsigned char a_~I0_size[~I1] = ");
+    write_int_array(g, a, n);
+    for (int i = 0; i < n; i++) a[i] = v[i].i >= 0 ? v[i].i - i : 0;
+    w(g, "~Mstatic const short a_~I0_substring_i[~I1] = ");
+    write_int_array(g, a, n);
+    for (int i = 0; i < n; i++) a[i] = v[i].result;
+    w(g, "~Mstatic const unsigned char a_~I0_result[~I1] = ");
+    write_int_array(g, a, n);
+    if (x->function_count) {
+        for (int i = 0; i < n; i++) a[i] = v[i].function_index;
+        w(g, "~Mstatic const unsigned char a_~I0_function[~I1] = ");
+        write_int_array(g, a, n);
+    }
+    FREE(a);
+
+    // a_pool doesn't exist if the only string is empty.
+    g->S[1] = x->longest_size ? "a_pool" : "0";
+    g->S[2] = x->function_count ? "a_~I0_function" : "0";
+    w(g, "~Mstatic const struct among_compact a_~I0 = {~N~+"
+         "~M~S1, a_~I0_offset, a_~I0_size, a_~I0_substring_i, a_~I0_result, ");
+    w(g, g->S[2]);
+    w(g, "~N~-~M};~N");
+
+    generate_among_function_dispatch(g, x);
 }
 
 static void generate_amongs(struct generator * g) {
     struct str * s = g->outbuf;
     g->outbuf = g->declarations;
+
+    int n = 0;
     for (struct among * x = g->analyser->amongs; x; x = x->next) {
-        if (x->used) generate_among_table(g, x);
+        n += x->literalstring_count;
+    }
+    int * offsets = MALLOC((n + 1) * sizeof(int));
+    int * next_offsets = offsets;
+    generate_among_pool(g, offsets);
+
+    for (struct among * x = g->analyser->amongs; x; x = x->next) {
+        if (!x->used) continue;
+        if (among_trie(g, x)) {
+            generate_among_trie(g, x);
+        } else if (among_compact(g, x)) {
+            generate_among_compact(g, x, next_offsets);
+            next_offsets += x->literalstring_count;
+        } else {
+            generate_among_table(g, x);
+        }
     }
+    FREE(offsets);
+    FREE(g->among_pool);
     g->outbuf = s;
 }
 
-static void set_bit(symbol * b, int i) { b[i >> 3] |= 1 << (i & 7); }
 
 static void generate_grouping_table(struct generator * g, struct grouping * q) {
-    int range = q->largest_ch - q->smallest_ch + 1;
-    int size = (range + 7) / 8;  /* assume 8 bits per symbol */
-    symbol * b = q->b;
-    symbol * map = create_b(size);
-
-    for (int i = 0; i < size; i++) map[i] = 0;
-
-    for (int i = 0; i < SIZE(b); i++) set_bit(map, b[i] - q->smallest_ch);
+    symbol * map = grouping_bitmap(q);
+    int size = SIZE(map);
 
     w(g, "~Nstatic const unsigned char ");
     write_varname(g, q->name);
@@ -1848,6 +2888,23 @@ static void generate_grouping_table(struct generator * g, struct grouping * q) {
         if (i) w(g, ", ");
         write_int(g, map[i]);
     }
+    byte * tables;
+    int tables_size = utf8_grouping_tables(g, q, map, &tables);
+    if (tables_size) {
+        // The lookup tables for in_grouping_U_table() etc.
+        w(g, ",~+");
+        for (int i = 0; i < tables_size; i++) {
+            if (i % 16 == 0) {
+                w(g, "~N~M");
+            } else {
+                write_char(g, ' ');
+            }
+            write_int(g, tables[i]);
+            if (i < tables_size - 1) write_char(g, ',');
+        }
+        w(g, "~-~N");
+        FREE(tables);
+    }
     if (g->options->coverage) {
         char buf[1024];
         checked_snprintf(buf, sizeof(buf), "%s:%d: grouping %.*s",
@@ -1859,7 +2916,13 @@ static void generate_grouping_table(struct generator * g, struct grouping * q) {
         }
         w(g, ", '\\0'");
     }
-    w(g, " };~N");
+    w(g, tables_size ? "};~N" : " };~N");
+
+    if (counting_coverage(g)) {
+        w(g, "static unsigned long ");
+        write_varname(g, q->name);
+        w(g, "_counts[4];~N");
+    }
 
     lose_b(map);
 }
@@ -1875,12 +2938,17 @@ static void generate_groupings(struct generator * g) {
 
 static void generate_create(struct generator * g) {
     w(g, "~N"
-         "extern struct SN_env * ~pcreate_env(void) {~N~+");
+         "extern struct SN_env * ~pcreate_env(void) {~N~+"
+         "~Mreturn ~pcreate_env_with_allocator(NULL);~N"
+         "~-}~N");
+
+    w(g, "~N"
+         "extern struct SN_env * ~pcreate_env_with_allocator(const struct SN_allocator * allocator) {~N~+");
 
     if (g->analyser->variable_count == 0) {
-        w(g, "~Mreturn SN_new_env(sizeof(struct SN_env));~N");
+        w(g, "~Mreturn SN_new_env_with_allocator(sizeof(struct SN_env), allocator);~N");
     } else {
-        w(g, "~Mstruct SN_env * z = SN_new_env(sizeof(SN_local));~N"
+        w(g, "~Mstruct SN_env * z = SN_new_env_with_allocator(sizeof(SN_local), allocator);~N"
              "~Mif (z) {~N~+");
 
         for (struct name * name = g->analyser->names; name; name = name->next) {
@@ -1920,7 +2988,7 @@ static void generate_create(struct generator * g) {
                         case t_string:
                             w(g, "~Mif ((");
                             write_varref(g, name);
-                            w(g, " = create_s()) == NULL) {~N~+"
+                            w(g, " = create_s_env(z)) == NULL) {~N~+"
                                  "~M~pclose_env(z);~N"
                                  "~Mreturn NULL;~N~-"
                                  "~M}~N");
@@ -1945,7 +3013,7 @@ static void generate_close(struct generator * g) {
 
         for (struct name * name = g->analyser->names; name; name = name->next) {
             if (!name->local_to && name->type == t_string) {
-                w(g, "~Mlose_s(");
+                w(g, "~Mlose_s_env(z, ");
                 write_varref(g, name);
                 w(g, ");~N");
             }
@@ -1957,6 +3025,26 @@ static void generate_close(struct generator * g) {
          "~-}~N~N");
 }
 
+static void generate_coverage_dump(struct generator * g) {
+    w(g, "~Nextern void ~pcoverage_dump(FILE * f) {~N~+");
+    for (struct among * x = g->analyser->amongs; x; x = x->next) {
+        if (!x->used) continue;
+        g->I[0] = x->number;
+        g->I[1] = x->literalstring_count;
+        w(g, "~Mdump_among_counts(f, a_~I0, ~I1, a_~I0_counts);~N");
+    }
+    for (struct grouping * q = g->analyser->groupings; q; q = q->next) {
+        g->I[0] = q->smallest_ch;
+        g->I[1] = q->largest_ch;
+        w(g, "~Mdump_grouping_counts(f, ");
+        write_varname(g, q->name);
+        w(g, ", ~I0, ~I1, ");
+        write_varname(g, q->name);
+        w(g, "_counts);~N");
+    }
+    w(g, "~-}~N");
+}
+
 static void generate_header_file(struct generator * g) {
     struct options * o = g->options;
     if (o->hheader) {
@@ -1989,15 +3077,26 @@ static void generate_header_file(struct generator * g) {
              "  public:~N~+");
     }
 
+    if (counting_coverage(g)) {
+        w(g, "#include <stdio.h>~N~N");
+    }
+
     if (o->target_lang == LANG_C) {
         w(g, "#ifdef __cplusplus~N"
              "extern \"C\" {~N"
              "#endif~N");            /* for C++ */
 
         w(g, "~N"
+             "struct SN_allocator;~N"
+             "~N"
              "extern struct SN_env * ~pcreate_env(void);~N"
+             "extern struct SN_env * ~pcreate_env_with_allocator(const struct SN_allocator * allocator);~N"
              "extern void ~pclose_env(struct SN_env * z);~N"
              "~N");
+        if (counting_coverage(g)) {
+            w(g, "extern void ~pcoverage_dump(FILE * f);~N"
+                 "~N");
+        }
     }
 
     const char * vp = o->variables_prefix;
@@ -2076,6 +3175,25 @@ static void generate_header_file(struct generator * g) {
                 w(g, "(struct SN_env * z);~N");
             }
         }
+        if (ascii_specialised(g)) {
+            // Each ASCII version is also defined as a macro naming itself so
+            // callers can test for it with #ifdef.
+            g->ascii = true;
+            write_newline(g);
+            for (struct name * q = g->analyser->names; q; q = q->next) {
+                if (q->type == t_external) {
+                    w(g, "extern int ");
+                    write_varname(g, q);
+                    w(g, "(struct SN_env * z);~N"
+                         "#define ");
+                    write_varname(g, q);
+                    write_char(g, ' ');
+                    write_varname(g, q);
+                    write_newline(g);
+                }
+            }
+            g->ascii = false;
+        }
 
         w(g, "~N"
              "#ifdef __cplusplus~N"
@@ -2135,7 +3253,7 @@ static void generate_header_file(struct generator * g) {
                 }
             }
         }
-        w(g, "~Mlose_s(z->p);~N"
+        w(g, "~Mlose_p(z);~N"
              "~-~M}~N~N");
 
         for (struct name * q = g->analyser->names; q; q = q->next) {
@@ -2152,7 +3270,7 @@ static void generate_header_file(struct generator * g) {
         w(g, "~-  public:~N~+"
              "~M~n() {~N~+"
              "~Mstruct SN_env * z = &(zlocal.z);~N"
-             "~Mz->p = create_s();~N");
+             "~Minit_p(z);~N");
         if (g->analyser->name_count[t_string] > 0) {
             w(g, "~Mtry {~N~+");
             for (struct name * name = g->analyser->names; name; name = name->next) {
@@ -2198,14 +3316,32 @@ extern void generate_program_c(struct generator * g) {
     g->failure_str = str_new();
     write_start_comment(g, "/* ", " */");
     generate_head(g);
+    if (ascii_specialised(g)) {
+        for (struct name * q = g->analyser->names; q; q = q->next) {
+            if (q->type == t_external) mark_ascii_calls(q->definition->left);
+        }
+    }
     generate_routine_declarations(g);
     g->declarations = g->outbuf;
     g->outbuf = str_new();
     g->literalstring_count = 0;
+    if (g->options->profile_use) {
+        read_profile(g);
+    }
+    build_among_pool(g);
 
     for (struct node * p = g->analyser->program; p; p = p->right) {
         generate(g, p);
     }
+    if (ascii_specialised(g)) {
+        g->ascii = true;
+        for (struct node * p = g->analyser->program; p; p = p->right) {
+            if (p->type == c_define && !ascii_version_needed(p->name)) continue;
+            generate(g, p);
+        }
+        g->ascii = false;
+    }
+    free_profile(g);
 
     generate_amongs(g);
     generate_groupings(g);
@@ -2215,6 +3351,10 @@ extern void generate_program_c(struct generator * g) {
         generate_close(g);
     }
 
+    if (counting_coverage(g)) {
+        generate_coverage_dump(g);
+    }
+
     output_str(g->options->output_src, g->declarations);
     str_delete(g->declarations);
     output_str(g->options->output_src, g->outbuf);
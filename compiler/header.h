@@ -242,6 +242,7 @@ struct name {
     struct node * used;         /* First use, or NULL if not used */
     struct name * local_to;     /* Local to one routine/external */
     int among_index;            /* for functions used in among */
+    byte ascii_called;          /* (routines) C ASCII version is called? */
     int declaration_line_number;/* Line number of declaration */
 };
 
@@ -408,6 +409,17 @@ struct generator {
     const char * varname_prefix;
     // String to indent by for each margin level (four spaces by default).
     const char * margin_indent;
+    // Counts read from the -profile-use file (only used by C/C++).
+    struct profile_count * profile;
+    // Set while generating the C routines specialised for ASCII input.
+    int ascii;
+    // Strings of the amongs using -among compact, packed by
+    // build_among_pool() (only used by C/C++).
+    symbol * among_pool;
+    int among_pool_size;
+    // Set if the strings don't fit in a pool, in which case all amongs use
+    // the ordinary tables.
+    int among_pool_too_big;
 };
 
 /* Special values for failure_label in struct generator. */
@@ -454,6 +466,24 @@ struct options {
     const char * go_snowball_runtime;
     const char * string_class;
     const char * among_class;
+    // File of counts written by a -coverage build's coverage_dump() (or NULL).
+    const char * profile_use;
+    // How C/C++ code for among lookups is generated.
+    enum {
+        AMONG_TABLE = 0, // Call find_among() on a table (the default).
+        AMONG_TRIE,      // Inline a decision tree on the string's symbols.
+        AMONG_HASH,      // Use a perfect hash for large backward amongs.
+        AMONG_COMPACT    // Use narrow arrays and one pool of strings.
+    } among_mode;
+    // How C/C++ code for UTF-8 grouping tests is generated.
+    enum {
+        GROUPING_BITMAP = 0, // Test the decoded character in a bitmap.
+        GROUPING_TABLE       // Also generate lookup tables indexed by byte.
+    } grouping_mode;
+    // Also generate C routines specialised for ASCII input (only for UTF-8).
+    byte ascii;
+    // Inline the commonest runtime functions into C/C++ code.
+    byte inline_runtime;
     struct include * includes;
     struct include * includes_end;
 };
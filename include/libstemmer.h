@@ -1,12 +1,18 @@
 
+#include <stddef.h> /* for size_t */
+
 /* Make header file work when included from C++ */
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 struct sb_stemmer;
+struct sb_stemmer_module;
 typedef unsigned char sb_symbol;
 
+/** A UTF-16 code unit, as used by sb_stemmer_stem_utf16(). */
+typedef unsigned short sb_utf16;
+
 /* FIXME - should be able to get a version number for each stemming
  * algorithm (which will be incremented each time the output changes). */
 
@@ -33,8 +39,9 @@ const char ** sb_stemmer_list(void);
  *  @param charenc The character encoding.  NULL may be passed as
  *  this value, in which case UTF-8 encoding will be assumed. Otherwise,
  *  the argument may be one of "UTF_8", "ISO_8859_1" (i.e. Latin 1),
- *  "ISO_8859_2" (i.e. Latin 2) or "KOI8_R" (Russian).  Note that case is
- *  significant in this parameter.
+ *  "ISO_8859_2" (i.e. Latin 2), "KOI8_R" (Russian) or "UTF_16" (for use
+ *  with sb_stemmer_stem_utf16()).  Note that case is significant in this
+ *  parameter.
  *
  *  @return NULL if the specified algorithm is not recognised, or the
  *  algorithm is not available for the requested encoding.  Otherwise,
@@ -45,6 +52,102 @@ const char ** sb_stemmer_list(void);
  */
 struct sb_stemmer * sb_stemmer_new(const char * algorithm, const char * charenc);
 
+/** Look up a stemming algorithm for the specified character encoding.
+ *
+ *  The parameters are interpreted in the same way as for sb_stemmer_new().
+ *
+ *  The returned module is immutable and remains valid for the lifetime of
+ *  the program, so it can be looked up once (e.g. at startup) and then shared
+ *  freely between threads.  Stemmer objects can then be created from it
+ *  with sb_stemmer_new_from_module(), which avoids repeating the lookup by
+ *  name.
+ *
+ *  @return NULL if the specified algorithm is not recognised, or the
+ *  algorithm is not available for the requested encoding.
+ */
+const struct sb_stemmer_module * sb_stemmer_module_find(const char * algorithm,
+                                                        const char * charenc);
+
+/** Create a new stemmer object for a module returned by
+ *  sb_stemmer_module_find().
+ *
+ *  Each stemmer object holds the state for stemming one word at a time, so
+ *  threads which stem concurrently need a stemmer object each, but they can
+ *  all be created from the same module.
+ *
+ *  @return A pointer to a newly created stemmer, which must be deleted by
+ *  calling sb_stemmer_delete(), or NULL if an out of memory error occurs.
+ */
+struct sb_stemmer * sb_stemmer_new_from_module(const struct sb_stemmer_module * module);
+
+/** Functions to allocate memory for a stemmer, in place of malloc(),
+ *  realloc() and free().  Each is passed context as its first argument.
+ *  All three must be set.
+ */
+struct sb_stemmer_allocator {
+    void * (*allocate)(void * context, size_t size);
+    void * (*reallocate)(void * context, void * p, size_t size);
+    void (*release)(void * context, void * p);
+    void * context;
+};
+
+/** Create a new stemmer object which allocates memory using allocator.
+ *
+ *  This is like sb_stemmer_new(), but all memory for the stemmer object
+ *  (including its working buffers and any cache enabled with
+ *  sb_stemmer_enable_cache()) is obtained from allocator.  This allows
+ *  stemmers to be created in an arena which is freed in bulk, or in memory
+ *  local to a particular NUMA node.  The allocator structure is copied, but
+ *  allocator->context must remain valid until the stemmer is deleted.
+ *
+ *  Stemmers created this way are not added to the pool by
+ *  sb_stemmer_pool_release(), which just deletes them.
+ *
+ *  @return NULL if the specified algorithm is not recognised, or an out of
+ *  memory error occurs.
+ */
+struct sb_stemmer * sb_stemmer_new_with_allocator(const char * algorithm,
+                                                  const char * charenc,
+                                                  const struct sb_stemmer_allocator * allocator);
+
+/** Get a stemmer object for a module from a pool shared by all threads.
+ *
+ *  This is intended for situations where a stemmer is needed for a short
+ *  time by whichever thread happens to be handling a request.  Taking an
+ *  idle stemmer from the pool only takes a few atomic operations, whereas
+ *  creating one requires several memory allocations.  If there are no
+ *  idle stemmers for the module, a new one is created.
+ *
+ *  The stemmer may only be used by the calling thread until it is passed to
+ *  sb_stemmer_pool_release().
+ *
+ *  If libstemmer was compiled without support for C11 atomics, this just
+ *  calls sb_stemmer_new_from_module().
+ *
+ *  @return A stemmer, or NULL if an out of memory error occurs.
+ */
+struct sb_stemmer * sb_stemmer_pool_acquire(const struct sb_stemmer_module * module);
+
+/** Return a stemmer object to the pool.
+ *
+ *  The stemmer must not be used by the caller after this call.  Stemmers
+ *  created with sb_stemmer_new() or sb_stemmer_new_from_module() may also
+ *  be passed.  If the pool already holds enough idle stemmers for this module
+ *  then the stemmer is deleted.
+ *
+ *  It is safe to pass a null pointer to this function - this will have
+ *  no effect.
+ */
+void                sb_stemmer_pool_release(struct sb_stemmer * stemmer);
+
+/** Delete all idle stemmer objects in the pool.
+ *
+ *  This must not be called concurrently with sb_stemmer_pool_acquire() or
+ *  sb_stemmer_pool_release().  It's intended for use at shutdown, for
+ *  example to avoid leak checkers reporting the pooled stemmers.
+ */
+void                sb_stemmer_pool_clear(void);
+
 /** Delete a stemmer object.
  *
  *  This frees all resources allocated for the stemmer.  After calling
@@ -72,6 +175,308 @@ void                sb_stemmer_delete(struct sb_stemmer * stemmer);
 const sb_symbol *   sb_stemmer_stem(struct sb_stemmer * stemmer,
                                     const sb_symbol * word, int size);
 
+/** Stem a word, writing the result to a buffer supplied by the caller.
+ *
+ *  This is like sb_stemmer_stem(), but the stem is written to out (which has
+ *  room for out_size symbols) so the caller doesn't need to copy the result
+ *  out of the stemmer before the next call.  The stem is not zero
+ *  terminated.
+ *
+ *  @param out_len Set to the length of the stem.  If this is more than
+ *  out_size then nothing is written to out.
+ *
+ *  @return 0 on success, 1 if out is too small to hold the stem (the size
+ *  needed is in *out_len), or -1 if an out-of-memory error occurs.
+ */
+int                 sb_stemmer_stem_into(struct sb_stemmer * stemmer,
+                                         const sb_symbol * word, int size,
+                                         sb_symbol * out, int out_size,
+                                         int * out_len);
+
+/** Space needed at the start of a buffer passed to sb_stemmer_stem_inplace()
+ *  before the word.  This must match HEAD in the runtime, which libstemmer
+ *  checks when it is compiled.
+ */
+#define SB_STEMMER_INPLACE_HEAD (2 * sizeof(int))
+
+/** Stem a word in place in a buffer supplied by the caller.
+ *
+ *  This saves copying the word into the stemmer and the stem back out,
+ *  which can help when stemming large numbers of words held in a writable
+ *  buffer.  The word is stemmed directly in the caller's buffer unless it
+ *  grows beyond capacity symbols, in which case the stemmer switches to its
+ *  own buffer.  The stemming algorithms rarely make a word longer, and then
+ *  only by a few symbols, so a little room after the word avoids this.
+ *
+ *  @param buf The buffer, which must be suitably aligned for an int (as
+ *  memory from malloc() is).  The word starts at buf +
+ *  SB_STEMMER_INPLACE_HEAD - the first SB_STEMMER_INPLACE_HEAD bytes are
+ *  used as scratch space by the stemmer.
+ *  @param size The length of the word.
+ *  @param capacity The number of symbols after buf +
+ *  SB_STEMMER_INPLACE_HEAD which the stemmer may use (at least size).
+ *
+ *  @return The length of the stem, which replaces the word in buf, or -1 if
+ *  an out-of-memory error occurs.  If the return value is greater than
+ *  capacity, the stem didn't fit and the contents of the word part of buf
+ *  are unspecified.
+ */
+int                 sb_stemmer_stem_inplace(struct sb_stemmer * stemmer,
+                                            sb_symbol * buf, int size,
+                                            int capacity);
+
+/** Stem a word encoded in UTF-16, writing the result to a buffer supplied
+ *  by the caller.
+ *
+ *  This is like sb_stemmer_stem_into(), but the word and stem are UTF-16
+ *  (in the machine's byte order), which saves callers which hold text as
+ *  UTF-16 transcoding each word to UTF-8 and back.  The stemmer must have
+ *  been created with the "UTF_16" character encoding, which uses versions
+ *  of the algorithms compiled for 16 bit characters.  These work on UTF-16
+ *  code units like the Java and C# stemmers do, so a surrogate pair is
+ *  treated as two characters which aren't letters.  A UTF-16 stemmer can't
+ *  be used with the other stemming functions, which fail for it.
+ *
+ *  @param out_len Set to the length of the stem in UTF-16 code units.  If
+ *  this is more than out_size then nothing is written to out.
+ *
+ *  @return 0 on success, 1 if out is too small to hold the stem (the size
+ *  needed is in *out_len), -1 if an out-of-memory error occurs, or -2 if
+ *  the stemmer doesn't use UTF-16.
+ */
+int                 sb_stemmer_stem_utf16(struct sb_stemmer * stemmer,
+                                          const sb_utf16 * word, int size,
+                                          sb_utf16 * out, int out_size,
+                                          int * out_len);
+
+/** Stem a batch of words.
+ *
+ *  This gives the same results as calling sb_stemmer_stem() on each word in
+ *  turn, but avoids the per-call overhead, which is significant when
+ *  stemming large numbers of (typically short) words.
+ *
+ *  The input words are packed one after another in words, with word i
+ *  being the symbols from words[offsets[i]] up to (but not including)
+ *  words[offsets[i + 1]], so offsets must have count + 1 entries.
+ *
+ *  The stems are written to out (which has room for out_size symbols) in
+ *  the same packed form, and out_offsets (which also needs count + 1 entries)
+ *  is filled in to mark where each stem starts and ends.  The stems are not
+ *  zero terminated.
+ *
+ *  @return The number of words stemmed.  This will be less than count if
+ *  out runs out of space, in which case out_offsets is only valid up to that
+ *  entry and the remaining words can be stemmed by calling this function
+ *  again (the word which didn't fit is stemmed again by that call).  If the
+ *  stem of the first word is longer than out_size, -2 is returned and
+ *  out_offsets[1] is set to the length of that stem, so the call can be
+ *  repeated with a large enough out.  If an out-of-memory error occurs, -1
+ *  is returned.
+ */
+int                 sb_stemmer_stem_batch(struct sb_stemmer * stemmer,
+                                          const sb_symbol * words,
+                                          const int * offsets, int count,
+                                          sb_symbol * out, int out_size,
+                                          int * out_offsets);
+
+/** The location of a word found by sb_stemmer_stem_text(), and its stem. */
+struct sb_stemmer_span {
+    /** Offset of the start of the word in the text. */
+    int start;
+    /** Offset of the end of the word in the text. */
+    int end;
+    /** Offset of the stem in the output buffer. */
+    int stem;
+    /** Length of the stem. */
+    int stem_len;
+};
+
+/** Split text into words, fold them to lower case and stem them.
+ *
+ *  This saves the caller implementing these steps around calls to
+ *  sb_stemmer_stem(), and processes the text in a single pass.
+ *
+ *  Words are sequences of letters, combining marks and decimal digits, and
+ *  may contain apostrophes (ASCII or U+2019) between such characters.  For
+ *  UTF-8 this uses the Unicode general categories for the Basic
+ *  Multilingual Plane (where unassigned characters count as letters);
+ *  outside it only emoji and other pictographs separate words.  Invalid
+ *  UTF-8 separates words.  For UTF-8 the Unicode simple lower case mapping
+ *  is used for the scripts used by the stemming algorithms (Latin, Greek,
+ *  Cyrillic and Armenian - the other scripts don't have case), except that
+ *  the African and historic letters in Latin Extended-B (U+0180-U+01C3
+ *  apart from U+01A0 and U+01AF, U+01F6, U+01F7 and U+023A-U+024F) and the
+ *  archaic Greek letters are left unchanged.  U+2019 is mapped to an ASCII
+ *  apostrophe.  The text should still be normalised (e.g. to NFC) first if
+ *  it may contain decomposed accents - see sb_stemmer_lower_utf8().
+ *
+ *  The stems are written one after another to out (which has room for
+ *  out_size symbols), and a span giving the location of the word in the text
+ *  and of its stem in out is written to spans for each word.  The stems are
+ *  not zero terminated.
+ *
+ *  Processing stops early if spans or out fills up (out needs room for each
+ *  word before it is stemmed, so giving out at least size symbols avoids
+ *  this unless stemming makes a word longer), in which case the rest of the
+ *  text can be processed with another call starting from text + *consumed.
+ *  If the next word or its stem doesn't fit in out at all, -2 is returned
+ *  (with *consumed set to the start of that word), and it can be processed
+ *  by calling again with a larger out.
+ *
+ *  @param consumed Set to the offset in text where processing stopped (size
+ *  if the whole text was processed).
+ *
+ *  @return The number of spans written, -1 if an out-of-memory error
+ *  occurs, or -2 if out is too small for the next word.
+ */
+int                 sb_stemmer_stem_text(struct sb_stemmer * stemmer,
+                                         const sb_symbol * text, int size,
+                                         struct sb_stemmer_span * spans,
+                                         int max_spans,
+                                         sb_symbol * out, int out_size,
+                                         int * consumed);
+
+/** Values for the NFC quick check result from sb_stemmer_lower_utf8(). */
+/** The text is definitely in Unicode NFC. */
+#define SB_NFC_YES   0
+/** The text may not be in NFC (it contains combining characters which
+ *  would compose with a preceding character if there is a suitable one). */
+#define SB_NFC_MAYBE 1
+/** The text is definitely not in NFC (or is not valid UTF-8).  This
+ *  includes combining characters which aren't in canonical order. */
+#define SB_NFC_NO    2
+
+/** Fold UTF-8 text to lower case ready for stemming.
+ *
+ *  This applies the same case folding as sb_stemmer_stem_text() to a buffer
+ *  of UTF-8 text, and at the same time performs the Unicode NFC quick
+ *  check on it.  Runs of ASCII are processed 16 bytes at a time where SIMD
+ *  instructions are available.
+ *
+ *  The stemming algorithms expect text to be in NFC or NFKC, so if the
+ *  result of the check isn't SB_NFC_YES the caller should normalise the text
+ *  (the NFC form can then be folded using this function, which will give
+ *  SB_NFC_YES).  Typically text is already in NFC, so this avoids the cost
+ *  of normalising it.
+ *
+ *  @param out Buffer for the result, which must have room for size symbols
+ *  (folding never makes the text longer).  This may be the same as text.
+ *
+ *  @param nfc If not NULL, set to SB_NFC_YES, SB_NFC_MAYBE or SB_NFC_NO.
+ *
+ *  @return The length of the result.
+ */
+int                 sb_stemmer_lower_utf8(const sb_symbol * text, int size,
+                                          sb_symbol * out, int * nfc);
+
+/** Counters for a stemmer object. */
+struct sb_stemmer_stats {
+    /** Number of words stemmed. */
+    unsigned long words;
+    /** Total length of the words stemmed. */
+    unsigned long input_symbols;
+    /** Total length of the stems. */
+    unsigned long output_symbols;
+    /** Number of words for which the stem was the same as the word. */
+    unsigned long unchanged;
+    /** Number of times a working buffer was allocated or grown. */
+    unsigned long reallocs;
+    /** Number of lookups in the algorithm's tables of strings. */
+    unsigned long among_calls;
+};
+
+/** Get the counters for a stemmer object.
+ *
+ *  The counters are totals since the stemmer was created, so the average
+ *  word and stem lengths can be found by dividing input_symbols and
+ *  output_symbols by words.  Words found in a cache are included in words
+ *  and the lengths, but don't contribute to reallocs or among_calls.
+ *
+ *  Maintaining the counters has a small cost, so they are only updated if
+ *  libstemmer and the stemming algorithms were compiled with SNOWBALL_STATS
+ *  defined.
+ *
+ *  @return 0 on success, or -1 if libstemmer was compiled without
+ *  SNOWBALL_STATS (in which case all the counters are set to 0).
+ */
+int                 sb_stemmer_stats(const struct sb_stemmer * stemmer,
+                                     struct sb_stemmer_stats * stats);
+
+/** Reserve space in a stemmer object for words of a given length.
+ *
+ *  The stemmer's working buffer grows as needed, but a caller which knows
+ *  the longest word it will pass (for example its tokeniser's maximum token
+ *  length) can call this once after creating the stemmer so that stemming
+ *  doesn't need to reallocate it.  A few algorithms also use string
+ *  variables, which grow to the size needed the first time they're used.
+ *
+ *  @param size The number of symbols to reserve space for.
+ *
+ *  @return 0 on success, or -1 if an out of memory error occurs.
+ */
+int                 sb_stemmer_reserve(struct sb_stemmer * stemmer, int size);
+
+/** Enable caching of stemming results for a stemmer object.
+ *
+ *  Words in natural language text follow a Zipfian distribution, so a small
+ *  cache of recent results can avoid running the stemming algorithm for a
+ *  large proportion of words.  The results returned are the same whether the
+ *  cache is enabled or not.
+ *
+ *  The cache is bounded - once full, the least recently used entries are
+ *  (approximately) replaced.  Very long words are not cached.
+ *
+ *  @param entries The number of words to cache (rounded up to a power of 2).
+ *  0 disables the cache and frees its memory.  Each entry takes 64 bytes.
+ *
+ *  @return 0 on success, or -1 if an out of memory error occurs (in which case
+ *  the stemmer's existing cache setting is unchanged).
+ */
+int                 sb_stemmer_enable_cache(struct sb_stemmer * stemmer,
+                                            int entries);
+
+/** Statistics for the shared cache. */
+struct sb_stemmer_cache_stats {
+    /** Number of lookups which found the word in the cache. */
+    unsigned long hits;
+    /** Number of lookups which didn't find the word in the cache. */
+    unsigned long misses;
+    /** Number of bytes of memory used by the cache. */
+    size_t memory;
+};
+
+/** Set up a cache of stemming results shared by all stemmer objects.
+ *
+ *  Once this has been called, all stemmer objects (except those with their
+ *  own cache enabled by sb_stemmer_enable_cache()) look up words in the shared
+ *  cache before running the stemming algorithm.  This is safe to use from
+ *  multiple threads at once, and avoids each thread having to populate its
+ *  own cache with the same common words.  Entries are tagged with the
+ *  algorithm and character encoding, so all stemmers can share one cache.
+ *
+ *  This must not be called concurrently with stemming.  Calling it again
+ *  replaces the existing shared cache.
+ *
+ *  @param max_bytes The maximum amount of memory to use for the cache.
+ *
+ *  @return 0 on success, or -1 if an out of memory error occurs, max_bytes
+ *  is too small, or libstemmer was compiled without support for C11 atomics.
+ */
+int                 sb_stemmer_shared_cache_init(size_t max_bytes);
+
+/** Free the shared cache.
+ *
+ *  This must not be called concurrently with stemming.  It is safe to call
+ *  this if there's no shared cache.
+ */
+void                sb_stemmer_shared_cache_free(void);
+
+/** Get statistics for the shared cache.
+ *
+ *  If there's no shared cache, all the statistics will be zero.
+ */
+void                sb_stemmer_shared_cache_stats(struct sb_stemmer_cache_stats * stats);
+
 /** Get the length of the result of the last stemmed word.
  *  This should not be called before sb_stemmer_stem() has been called.
  */
@@ -0,0 +1,1581 @@
+
+#include <stdlib.h>
+#include <string.h>
+#include "../include/libstemmer.h"
+#include "../runtime/snowball_runtime.h"
+#include "modules.h"
+
+/* The stemmer pool needs C11 atomics - without them it just creates and
+ * deletes stemmers.  Define SNOWBALL_NO_ATOMICS to force this.
+ */
+#if !defined SNOWBALL_NO_ATOMICS && \
+    defined __STDC_VERSION__ && __STDC_VERSION__ >= 201112L && \
+    !defined __STDC_NO_ATOMICS__
+# include <stdatomic.h>
+# define SB_HAVE_ATOMICS
+#endif
+
+/* Use SIMD to process runs of ASCII in sb_stemmer_lower_utf8() and to check
+ * for words which are all ASCII if we can.
+ */
+#if defined __SSE2__ || defined _M_X64 || (defined _M_IX86_FP && _M_IX86_FP >= 2)
+# include <emmintrin.h>
+# define SB_HAVE_SSE2
+#elif defined __ARM_NEON && defined __aarch64__
+# include <arm_neon.h>
+# define SB_HAVE_NEON
+#endif
+
+#define NUM_MODULES (sizeof(modules) / sizeof(modules[0]) - 1)
+
+/* Number of idle stemmers the pool keeps for each module. */
+#define POOL_SLOTS 8
+
+/* Number of entries in each set of a word cache. */
+#define CACHE_WAYS 4
+
+/* Words or stems longer than this aren't cached (chosen so an entry is
+ * 64 bytes).
+ */
+#define CACHE_MAX_LEN 24
+
+/* An entry in a word cache (a hash of 0 means the entry is unused). */
+struct cache_entry {
+    /* The algorithm the entry is for, which is needed because the shared
+     * cache holds entries for all stemmers. */
+    int (*algorithm)(struct SN_env *);
+    unsigned int hash;
+    unsigned char word_len;
+    unsigned char stem_len;
+    /* CLOCK reference bit, set when the entry is used. */
+    unsigned char referenced;
+    sb_symbol word[CACHE_MAX_LEN];
+    sb_symbol stem[CACHE_MAX_LEN];
+};
+
+/* Character sets for which sb_stemmer_stem_text() knows how to fold case,
+ * plus UTF-16 (which is only used by sb_stemmer_stem_utf16()).
+ */
+typedef enum {
+    CHARSET_UTF_8,
+    CHARSET_ISO_8859_1,
+    CHARSET_ISO_8859_2,
+    CHARSET_KOI8_R,
+    CHARSET_UTF_16
+} charset_t;
+
+#ifdef SB_HAVE_UTF_16
+/* Functions from the runtime built for 16 bit symbols (see runtime/api.h),
+ * for use on the environments of the UTF-16 stemmers.
+ */
+extern int SN_set_current_w(struct SN_env * z, int size, const sb_utf16 * s);
+extern int SN_reserve_w(struct SN_env * z, int n);
+#endif
+
+struct sb_stemmer {
+    const struct sb_stemmer_module * module;
+    charset_t charset;
+    void (*close)(struct SN_env *);
+    int (*stem)(struct SN_env *);
+    /* Version of stem for words which are all ASCII (or NULL if none). */
+    int (*stem_ascii)(struct SN_env *);
+
+    struct SN_env * env;
+
+    /* Optional word cache (NULL if not enabled), organised as sets of
+     * CACHE_WAYS entries. */
+    struct cache_entry * cache;
+    /* Number of sets in cache minus one (the number is a power of 2). */
+    unsigned int cache_mask;
+
+    /* Allocator to use (allocate is NULL to use malloc() and free()). */
+    struct SN_allocator allocator;
+
+    /* Counters (only updated if compiled with SNOWBALL_STATS). */
+    struct sb_stemmer_stats stats;
+    struct SN_stats env_stats;
+};
+
+/* Allocate and free memory for a stemmer. */
+static void *
+sb_allocate(struct sb_stemmer * stemmer, size_t size)
+{
+    if (stemmer->allocator.allocate)
+        return stemmer->allocator.allocate(stemmer->allocator.context, size);
+    return malloc(size);
+}
+
+static void
+sb_release(struct sb_stemmer * stemmer, void * p)
+{
+    if (stemmer->allocator.allocate)
+        stemmer->allocator.release(stemmer->allocator.context, p);
+    else
+        free(p);
+}
+
+/* FNV-1a hash of a word (mkmodules.pl has a matching implementation). */
+static unsigned int
+sb_hash(const sb_symbol * word, int size)
+{
+    unsigned int h = 2166136261U;
+    int i;
+    for (i = 0; i < size; i++) {
+        h = (h ^ word[i]) * 16777619U;
+    }
+    return h;
+}
+
+extern const char **
+sb_stemmer_list(void)
+{
+    return algorithm_names;
+}
+
+static stemmer_encoding_t
+sb_getenc(const char * charenc)
+{
+    const struct stemmer_encoding * encoding;
+    if (charenc == NULL) return ENC_UTF_8;
+    for (encoding = encodings; encoding->name != 0; encoding++) {
+        if (strcmp(encoding->name, charenc) == 0) break;
+    }
+    if (encoding->name == NULL) return ENC_UNKNOWN;
+    return encoding->enc;
+}
+
+static charset_t
+sb_getcharset(stemmer_encoding_t enc)
+{
+    const struct stemmer_encoding * encoding;
+    for (encoding = encodings; encoding->name != 0; encoding++) {
+        if (encoding->enc == enc) break;
+    }
+    if (encoding->name == NULL) return CHARSET_UTF_8;
+    if (strcmp(encoding->name, "ISO_8859_1") == 0) return CHARSET_ISO_8859_1;
+    if (strcmp(encoding->name, "ISO_8859_2") == 0) return CHARSET_ISO_8859_2;
+    if (strcmp(encoding->name, "KOI8_R") == 0) return CHARSET_KOI8_R;
+    if (strcmp(encoding->name, "UTF_16") == 0) return CHARSET_UTF_16;
+    return CHARSET_UTF_8;
+}
+
+extern const struct sb_stemmer_module *
+sb_stemmer_module_find(const char * algorithm, const char * charenc)
+{
+    stemmer_encoding_t enc;
+    const struct sb_stemmer_module * module;
+
+    unsigned int i;
+
+    enc = sb_getenc(charenc);
+    if (enc == ENC_UNKNOWN) return NULL;
+
+    i = sb_hash((const sb_symbol *)algorithm, strlen(algorithm));
+    while (1) {
+        i &= MODULE_HASH_SIZE - 1;
+        if (module_hash[i] < 0) return NULL;
+        module = modules + module_hash[i];
+        if (strcmp(module->name, algorithm) == 0) break;
+        ++i;
+    }
+
+    /* The rows for each encoding of this name follow on consecutively. */
+    do {
+        if (module->enc == enc) return module;
+        ++module;
+    } while (module->name != 0 && strcmp(module->name, algorithm) == 0);
+    return NULL;
+}
+
+/* Create a stemmer for module, allocating memory using allocator (or
+ * malloc() and free() if allocator is NULL).
+ */
+static struct sb_stemmer *
+sb_create(const struct sb_stemmer_module * module,
+          const struct sb_stemmer_allocator * allocator)
+{
+    struct sb_stemmer * stemmer;
+
+    if (allocator)
+        stemmer = (struct sb_stemmer *)
+            allocator->allocate(allocator->context, sizeof(struct sb_stemmer));
+    else
+        stemmer = (struct sb_stemmer *) malloc(sizeof(struct sb_stemmer));
+    if (stemmer == NULL) return NULL;
+
+    stemmer->module = module;
+    stemmer->charset = sb_getcharset(module->enc);
+    stemmer->cache = NULL;
+    stemmer->cache_mask = 0;
+    stemmer->close = module->close;
+    stemmer->stem = module->stem;
+    stemmer->stem_ascii = module->stem_ascii;
+    memset(&stemmer->stats, 0, sizeof(stemmer->stats));
+    memset(&stemmer->env_stats, 0, sizeof(stemmer->env_stats));
+    if (allocator) {
+        stemmer->allocator.allocate = allocator->allocate;
+        stemmer->allocator.reallocate = allocator->reallocate;
+        stemmer->allocator.release = allocator->release;
+        stemmer->allocator.context = allocator->context;
+        stemmer->env = module->create(&stemmer->allocator);
+    } else {
+        stemmer->allocator.allocate = NULL;
+        stemmer->allocator.reallocate = NULL;
+        stemmer->allocator.release = NULL;
+        stemmer->allocator.context = NULL;
+        stemmer->env = module->create(NULL);
+    }
+    if (stemmer->env == NULL)
+    {
+        sb_stemmer_delete(stemmer);
+        return NULL;
+    }
+    stemmer->env->stats = &stemmer->env_stats;
+
+    return stemmer;
+}
+
+extern struct sb_stemmer *
+sb_stemmer_new_from_module(const struct sb_stemmer_module * module)
+{
+    return sb_create(module, NULL);
+}
+
+extern struct sb_stemmer *
+sb_stemmer_new(const char * algorithm, const char * charenc)
+{
+    const struct sb_stemmer_module * module;
+
+    module = sb_stemmer_module_find(algorithm, charenc);
+    if (module == NULL) return NULL;
+    return sb_create(module, NULL);
+}
+
+extern struct sb_stemmer *
+sb_stemmer_new_with_allocator(const char * algorithm, const char * charenc,
+                              const struct sb_stemmer_allocator * allocator)
+{
+    const struct sb_stemmer_module * module;
+
+    module = sb_stemmer_module_find(algorithm, charenc);
+    if (module == NULL) return NULL;
+    return sb_create(module, allocator);
+}
+
+#ifdef SB_HAVE_ATOMICS
+/* A slot holds an idle stemmer, or NULL if empty.  Stemmers are taken from
+ * and put into slots with a single atomic exchange or compare-and-swap, which
+ * means the pool is lock-free and not prone to the ABA problem a linked free
+ * list would have.
+ */
+static _Atomic(struct sb_stemmer *) pool[NUM_MODULES][POOL_SLOTS];
+#endif
+
+extern struct sb_stemmer *
+sb_stemmer_pool_acquire(const struct sb_stemmer_module * module)
+{
+#ifdef SB_HAVE_ATOMICS
+    _Atomic(struct sb_stemmer *) * slots = pool[module - modules];
+    int i;
+    for (i = 0; i < POOL_SLOTS; i++) {
+        /* Check with a plain load first to avoid contending for the cache
+         * line when the slot is empty. */
+        if (atomic_load_explicit(&slots[i], memory_order_relaxed) != NULL) {
+            struct sb_stemmer * stemmer =
+                atomic_exchange_explicit(&slots[i], NULL, memory_order_acquire);
+            if (stemmer != NULL) return stemmer;
+        }
+    }
+#endif
+    return sb_stemmer_new_from_module(module);
+}
+
+extern void
+sb_stemmer_pool_release(struct sb_stemmer * stemmer)
+{
+#ifdef SB_HAVE_ATOMICS
+    _Atomic(struct sb_stemmer *) * slots;
+    int i;
+    if (stemmer == 0) return;
+    if (stemmer->allocator.allocate) {
+        /* Don't pool stemmers using memory the caller may free in bulk. */
+        sb_stemmer_delete(stemmer);
+        return;
+    }
+    slots = pool[stemmer->module - modules];
+    for (i = 0; i < POOL_SLOTS; i++) {
+        if (atomic_load_explicit(&slots[i], memory_order_relaxed) == NULL) {
+            struct sb_stemmer * expected = NULL;
+            if (atomic_compare_exchange_strong_explicit(&slots[i], &expected,
+                                                        stemmer,
+                                                        memory_order_release,
+                                                        memory_order_relaxed))
+                return;
+        }
+    }
+#endif
+    /* The pool is full. */
+    sb_stemmer_delete(stemmer);
+}
+
+extern void
+sb_stemmer_pool_clear(void)
+{
+#ifdef SB_HAVE_ATOMICS
+    size_t m;
+    int i;
+    for (m = 0; m < NUM_MODULES; m++) {
+        for (i = 0; i < POOL_SLOTS; i++) {
+            sb_stemmer_delete(atomic_exchange(&pool[m][i], NULL));
+        }
+    }
+#endif
+}
+
+void
+sb_stemmer_delete(struct sb_stemmer * stemmer)
+{
+    if (stemmer == 0) return;
+    if (stemmer->close) {
+        stemmer->close(stemmer->env);
+        stemmer->close = 0;
+    }
+    if (stemmer->cache) sb_release(stemmer, stemmer->cache);
+    sb_release(stemmer, stemmer);
+}
+
+extern int
+sb_stemmer_stats(const struct sb_stemmer * stemmer,
+                 struct sb_stemmer_stats * stats)
+{
+#ifdef SNOWBALL_STATS
+    *stats = stemmer->stats;
+    stats->reallocs = stemmer->env_stats.reallocs;
+    stats->among_calls = stemmer->env_stats.among_calls;
+    return 0;
+#else
+    (void)stemmer;
+    memset(stats, 0, sizeof(*stats));
+    return -1;
+#endif
+}
+
+extern int
+sb_stemmer_reserve(struct sb_stemmer * stemmer, int size)
+{
+#ifdef SB_HAVE_UTF_16
+    if (stemmer->charset == CHARSET_UTF_16)
+        return SN_reserve_w(stemmer->env, size);
+#endif
+    return SN_reserve(stemmer->env, size);
+}
+
+extern int
+sb_stemmer_enable_cache(struct sb_stemmer * stemmer, int entries)
+{
+    unsigned int sets = 1;
+    struct cache_entry * cache = NULL;
+    if (entries > 0) {
+        while (sets * CACHE_WAYS < (unsigned int)entries) sets <<= 1;
+        cache = (struct cache_entry *)
+            sb_allocate(stemmer, sets * CACHE_WAYS * sizeof(struct cache_entry));
+        if (cache == NULL) return -1;
+        memset(cache, 0, sets * CACHE_WAYS * sizeof(struct cache_entry));
+    }
+    if (stemmer->cache) sb_release(stemmer, stemmer->cache);
+    stemmer->cache = cache;
+    stemmer->cache_mask = sets - 1;
+    return 0;
+}
+
+/* Find the entry for word in a cache set, or return NULL if not present. */
+static struct cache_entry *
+cache_find(struct cache_entry * set, int (*algorithm)(struct SN_env *),
+           unsigned int hash, const sb_symbol * word, int size)
+{
+    int i;
+    for (i = 0; i < CACHE_WAYS; i++) {
+        struct cache_entry * e = set + i;
+        if (e->hash == hash && e->algorithm == algorithm && e->word_len == size &&
+            memcmp(e->word, word, size) == 0) {
+            e->referenced = 1;
+            return e;
+        }
+    }
+    return NULL;
+}
+
+/* Add word and the stem in env to a cache set if they're short enough. */
+static void
+cache_add(struct cache_entry * set, int (*algorithm)(struct SN_env *),
+          unsigned int hash, const sb_symbol * word, int size,
+          const struct SN_env * env)
+{
+    struct cache_entry * victim = set;
+    int start, i;
+    if (size > CACHE_MAX_LEN || env->l > CACHE_MAX_LEN) return;
+
+    /* Pick an entry to replace using the CLOCK algorithm, starting from a
+     * position derived from the hash rather than keeping a hand per set.
+     */
+    start = hash >> 28;
+    for (i = 0; i < 2 * CACHE_WAYS; i++) {
+        struct cache_entry * e = set + (start + i) % CACHE_WAYS;
+        if (!e->referenced) {
+            victim = e;
+            break;
+        }
+        e->referenced = 0;
+    }
+    victim->algorithm = algorithm;
+    victim->hash = hash;
+    victim->word_len = size;
+    victim->stem_len = env->l;
+    victim->referenced = 0;
+    memcpy(victim->word, word, size);
+    memcpy(victim->stem, env->p, env->l);
+}
+
+/* Check if the size bytes at word are all ASCII. */
+static int
+sb_is_ascii(const sb_symbol * word, int size)
+{
+    int i = 0;
+    sb_symbol bits = 0;
+#if defined SB_HAVE_SSE2
+    for (; i + 16 <= size; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(word + i));
+        if (_mm_movemask_epi8(v)) return 0;
+    }
+#elif defined SB_HAVE_NEON
+    for (; i + 16 <= size; i += 16) {
+        if (vmaxvq_u8(vld1q_u8(word + i)) >= 0x80) return 0;
+    }
+#endif
+    for (; i < size; i++) bits |= word[i];
+    return bits < 0x80;
+}
+
+/* Run the stemming algorithm on word, which must already be the current
+ * string in stemmer->env, using the version for ASCII if there is one and
+ * it applies.  Returns the algorithm's return value.
+ */
+static int
+sb_call_stem(struct sb_stemmer * stemmer, const sb_symbol * word, int size)
+{
+    if (stemmer->stem_ascii && sb_is_ascii(word, size))
+        return stemmer->stem_ascii(stemmer->env);
+    return stemmer->stem(stemmer->env);
+}
+
+/* Run the stemming algorithm on word, leaving the result in stemmer->env.
+ * Returns 0 on success, -1 on error.
+ */
+static int
+sb_run_stem(struct sb_stemmer * stemmer, const sb_symbol * word, int size)
+{
+    if (SN_set_current(stemmer->env, size, (const symbol *)(word)))
+    {
+        stemmer->env->l = 0;
+        return -1;
+    }
+    if (sb_call_stem(stemmer, word, size) < 0) return -1;
+    return 0;
+}
+
+/* Set the current string in stemmer->env to a cached stem.
+ * Returns 0 on success, -1 on error.
+ */
+static int
+sb_set_stem(struct sb_stemmer * stemmer, const sb_symbol * stem, int len)
+{
+    if (SN_set_current(stemmer->env, len, (const symbol *)(stem)))
+    {
+        stemmer->env->l = 0;
+        return -1;
+    }
+    return 0;
+}
+
+/* Stem word using the stemmer's cache.
+ * Returns 0 on success, -1 on error.
+ */
+static int
+sb_stem_word_cached(struct sb_stemmer * stemmer,
+                    const sb_symbol * word, int size)
+{
+    unsigned int hash = sb_hash(word, size) | 1;
+    struct cache_entry * set = stemmer->cache +
+        (hash >> 1 & stemmer->cache_mask) * CACHE_WAYS;
+    struct cache_entry * e = cache_find(set, stemmer->stem, hash, word, size);
+
+    if (e) return sb_set_stem(stemmer, e->stem, e->stem_len);
+    if (sb_run_stem(stemmer, word, size) < 0) return -1;
+    cache_add(set, stemmer->stem, hash, word, size, stemmer->env);
+    return 0;
+}
+
+#ifdef SB_HAVE_ATOMICS
+/* Number of locks for the shared cache.  Each protects the sets whose index
+ * is equal to the lock's index modulo SHARED_CACHE_STRIPES.
+ */
+#define SHARED_CACHE_STRIPES 64
+
+/* A lock for the shared cache, with hit and miss counts for the sets it
+ * protects, padded to avoid false sharing between different stripes.
+ */
+union cache_stripe {
+    struct {
+        atomic_flag lock;
+        unsigned long hits;
+        unsigned long misses;
+    } s;
+    char pad[64];
+};
+
+static struct {
+    struct cache_entry * entries;
+    unsigned int mask;
+    union cache_stripe stripes[SHARED_CACHE_STRIPES];
+} shared_cache;
+
+static void
+stripe_lock(union cache_stripe * stripe)
+{
+    while (atomic_flag_test_and_set_explicit(&stripe->s.lock,
+                                             memory_order_acquire)) {
+        /* Spin - the lock is only held while probing or updating a set. */
+    }
+}
+
+static void
+stripe_unlock(union cache_stripe * stripe)
+{
+    atomic_flag_clear_explicit(&stripe->s.lock, memory_order_release);
+}
+
+/* Stem word using the shared cache.
+ * Returns 0 on success, -1 on error.
+ */
+static int
+sb_stem_word_shared(struct sb_stemmer * stemmer,
+                    const sb_symbol * word, int size)
+{
+    unsigned int hash = sb_hash(word, size) | 1;
+    unsigned int set_i = hash >> 1 & shared_cache.mask;
+    struct cache_entry * set = shared_cache.entries + set_i * CACHE_WAYS;
+    union cache_stripe * stripe =
+        &shared_cache.stripes[set_i % SHARED_CACHE_STRIPES];
+    struct cache_entry * e;
+    sb_symbol stem[CACHE_MAX_LEN];
+    int len = 0;
+
+    stripe_lock(stripe);
+    e = cache_find(set, stemmer->stem, hash, word, size);
+    if (e) {
+        ++stripe->s.hits;
+        len = e->stem_len;
+        memcpy(stem, e->stem, len);
+    } else {
+        ++stripe->s.misses;
+    }
+    stripe_unlock(stripe);
+
+    if (e) return sb_set_stem(stemmer, stem, len);
+    if (sb_run_stem(stemmer, word, size) < 0) return -1;
+    stripe_lock(stripe);
+    cache_add(set, stemmer->stem, hash, word, size, stemmer->env);
+    stripe_unlock(stripe);
+    return 0;
+}
+#endif
+
+extern int
+sb_stemmer_shared_cache_init(size_t max_bytes)
+{
+#ifdef SB_HAVE_ATOMICS
+    size_t set_bytes = CACHE_WAYS * sizeof(struct cache_entry);
+    unsigned int sets = 1;
+    int i;
+    if (max_bytes < set_bytes) return -1;
+    while (sets * 2 * set_bytes <= max_bytes) sets <<= 1;
+    sb_stemmer_shared_cache_free();
+    shared_cache.entries = (struct cache_entry *)
+        calloc(sets * CACHE_WAYS, sizeof(struct cache_entry));
+    if (shared_cache.entries == NULL) return -1;
+    shared_cache.mask = sets - 1;
+    for (i = 0; i < SHARED_CACHE_STRIPES; i++) {
+        atomic_flag_clear(&shared_cache.stripes[i].s.lock);
+        shared_cache.stripes[i].s.hits = 0;
+        shared_cache.stripes[i].s.misses = 0;
+    }
+    return 0;
+#else
+    (void)max_bytes;
+    return -1;
+#endif
+}
+
+extern void
+sb_stemmer_shared_cache_free(void)
+{
+#ifdef SB_HAVE_ATOMICS
+    free(shared_cache.entries);
+    shared_cache.entries = NULL;
+#endif
+}
+
+extern void
+sb_stemmer_shared_cache_stats(struct sb_stemmer_cache_stats * stats)
+{
+#ifdef SB_HAVE_ATOMICS
+    int i;
+#endif
+    stats->hits = 0;
+    stats->misses = 0;
+    stats->memory = 0;
+#ifdef SB_HAVE_ATOMICS
+    if (shared_cache.entries == NULL) return;
+    stats->memory = (shared_cache.mask + 1) * CACHE_WAYS *
+                    sizeof(struct cache_entry);
+    for (i = 0; i < SHARED_CACHE_STRIPES; i++) {
+        union cache_stripe * stripe = &shared_cache.stripes[i];
+        stripe_lock(stripe);
+        stats->hits += stripe->s.hits;
+        stats->misses += stripe->s.misses;
+        stripe_unlock(stripe);
+    }
+#endif
+}
+
+/* Stem word, leaving the result in stemmer->env.
+ * Returns 0 on success, -1 on error.
+ */
+static int
+sb_stem_word(struct sb_stemmer * stemmer, const sb_symbol * word, int size)
+{
+    int ret;
+    /* UTF-16 stemmers can only be used by sb_stemmer_stem_utf16(). */
+    if (stemmer->charset == CHARSET_UTF_16) return -1;
+    if (stemmer->cache) {
+        ret = sb_stem_word_cached(stemmer, word, size);
+#ifdef SB_HAVE_ATOMICS
+    } else if (shared_cache.entries) {
+        ret = sb_stem_word_shared(stemmer, word, size);
+#endif
+    } else {
+        ret = sb_run_stem(stemmer, word, size);
+    }
+#ifdef SNOWBALL_STATS
+    if (ret == 0) {
+        int len = stemmer->env->l;
+        stemmer->stats.words++;
+        stemmer->stats.input_symbols += size;
+        stemmer->stats.output_symbols += len;
+        if (len == size && memcmp(stemmer->env->p, word, size) == 0)
+            stemmer->stats.unchanged++;
+    }
+#endif
+    return ret;
+}
+
+const sb_symbol *
+sb_stemmer_stem(struct sb_stemmer * stemmer, const sb_symbol * word, int size)
+{
+    if (sb_stem_word(stemmer, word, size) < 0) return NULL;
+    stemmer->env->p[stemmer->env->l] = 0;
+    return (const sb_symbol *)(stemmer->env->p);
+}
+
+int
+sb_stemmer_stem_into(struct sb_stemmer * stemmer,
+                     const sb_symbol * word, int size,
+                     sb_symbol * out, int out_size, int * out_len)
+{
+    int len;
+    if (sb_stem_word(stemmer, word, size) < 0) return -1;
+    len = stemmer->env->l;
+    *out_len = len;
+    if (len > out_size) return 1;
+    memcpy(out, stemmer->env->p, len);
+    return 0;
+}
+
+/* The runtime keeps the size and capacity of the caller's buffer in the HEAD
+ * bytes before the word, so the public header must agree about the size of
+ * this (if it doesn't, the array size here is negative).
+ */
+typedef char sb_inplace_head_check[SB_STEMMER_INPLACE_HEAD == HEAD ? 1 : -1];
+
+int
+sb_stemmer_stem_inplace(struct sb_stemmer * stemmer,
+                        sb_symbol * buf, int size, int capacity)
+{
+    sb_symbol * word = buf + SB_STEMMER_INPLACE_HEAD;
+    struct SN_env * env = stemmer->env;
+    int ret;
+    int copy = (stemmer->cache != NULL);
+    if (stemmer->charset == CHARSET_UTF_16) return -1;
+#ifdef SB_HAVE_ATOMICS
+    if (shared_cache.entries) copy = 1;
+#endif
+#ifdef SNOWBALL_STATS
+    /* Counting unchanged words needs the original word. */
+    copy = 1;
+#endif
+    if (copy) {
+        /* Cache hits avoid running the algorithm at all, which saves more
+         * than stemming in place, so stem as usual and copy the result. */
+        if (sb_stem_word(stemmer, word, size) < 0) return -1;
+        ret = env->l;
+        if (ret <= capacity) memcpy(word, env->p, ret);
+        return ret;
+    }
+
+    SN_adopt_current(env, (symbol *)word, size, capacity);
+    ret = sb_call_stem(stemmer, word, size);
+    if (ret >= 0) {
+        ret = env->l;
+        /* If the word grew beyond capacity the stem is in the stemmer's own
+         * buffer. */
+        if (env->p != word && ret <= capacity) memcpy(word, env->p, ret);
+    }
+    SN_release_current(env);
+    return ret < 0 ? -1 : ret;
+}
+
+int
+sb_stemmer_stem_batch(struct sb_stemmer * stemmer,
+                      const sb_symbol * words, const int * offsets, int count,
+                      sb_symbol * out, int out_size, int * out_offsets)
+{
+    int i;
+    int pos = 0;
+    out_offsets[0] = 0;
+    for (i = 0; i < count; i++) {
+        int len;
+        if (sb_stem_word(stemmer, words + offsets[i],
+                         offsets[i + 1] - offsets[i]) < 0) return -1;
+        len = stemmer->env->l;
+        if (len > out_size - pos) {
+            /* If the first stem doesn't fit then calling again with the same
+             * out_size can't make progress, so report the size needed. */
+            if (i == 0) {
+                out_offsets[1] = len;
+                return -2;
+            }
+            break;
+        }
+        memcpy(out + pos, stemmer->env->p, len);
+        pos += len;
+        out_offsets[i + 1] = pos;
+    }
+    return i;
+}
+
+/* Simple (one-to-one) Unicode lowercase mapping for the scripts which the
+ * stemming algorithms handle.  Characters which have no lowercase mapping
+ * are returned unchanged.
+ */
+static int
+sb_tolower(int ch)
+{
+    if (ch < 0x80) return (ch >= 'A' && ch <= 'Z') ? ch + 0x20 : ch;
+    if (ch < 0x100) return (ch >= 0xC0 && ch <= 0xDE && ch != 0xD7) ? ch + 0x20 : ch;
+    if (ch < 0x180) {
+        /* Latin Extended-A: mostly upper and lower case pairs. */
+        if (ch == 0x130) return 'i';
+        if (ch == 0x178) return 0xFF;
+        if (ch < 0x138 || (ch >= 0x14A && ch < 0x178)) return ch | 1;
+        if ((ch >= 0x139 && ch < 0x149) || (ch >= 0x179 && ch < 0x17F))
+            return ch + (ch & 1);
+        return ch;
+    }
+    if (ch < 0x250) {
+        /* Latin Extended-B: the digraphs used for Serbo-Croatian, the
+         * letters with caron, diaeresis and macron etc at U+01CD-U+01FF
+         * (used for Pinyin, Sami and Livonian) and the pairs at
+         * U+0200-U+0233 (which includes Romanian comma-below letters), and
+         * the Vietnamese horned O and U, but not the African and historic
+         * letters at U+0180-U+01C3, U+01F6, U+01F7 and U+023A onwards. */
+        if (ch == 0x1A0 || ch == 0x1AF) return ch + 1;
+        if (ch >= 0x1C4 && ch <= 0x1CC) return ch - (ch - 0x1C4) % 3 + 2;
+        if (ch >= 0x1CD && ch <= 0x1DC) return ch + (ch & 1);
+        if (ch >= 0x1DE && ch <= 0x1EF) return ch | 1;
+        if (ch == 0x1F1 || ch == 0x1F2) return 0x1F3;
+        if (ch == 0x1F4) return 0x1F5;
+        if (ch >= 0x1F8 && ch <= 0x1FF) return ch | 1;
+        if (ch == 0x220) return 0x19E;
+        if (ch >= 0x200 && ch < 0x234) return ch | 1;
+        return ch;
+    }
+    if (ch < 0x400) {
+        /* Greek. */
+        if (ch == 0x386) return 0x3AC;
+        if (ch >= 0x388 && ch <= 0x38A) return ch + 37;
+        if (ch == 0x38C) return 0x3CC;
+        if (ch == 0x38E || ch == 0x38F) return ch + 63;
+        if (ch >= 0x391 && ch <= 0x3AB && ch != 0x3A2) return ch + 0x20;
+        return ch;
+    }
+    if (ch < 0x530) {
+        /* Cyrillic. */
+        if (ch < 0x410) return ch + 0x50;
+        if (ch < 0x430) return ch + 0x20;
+        if ((ch >= 0x460 && ch < 0x482) || (ch >= 0x48A && ch < 0x4C0) ||
+            ch >= 0x4D0) return ch | 1;
+        if (ch == 0x4C0) return 0x4CF;
+        if (ch >= 0x4C1 && ch < 0x4CF) return ch + (ch & 1);
+        return ch;
+    }
+    /* Armenian. */
+    if (ch < 0x531) return ch;
+    if (ch <= 0x556) return ch + 0x30;
+    /* Latin Extended Additional (used by Vietnamese, Welsh, etc). */
+    if (ch < 0x1E00) return ch;
+    if (ch == 0x1E9E) return 0xDF;
+    if (ch < 0x1E96 || (ch >= 0x1EA0 && ch < 0x1F00)) return ch | 1;
+    if (ch >= 0x1F00 && ch < 0x2000) {
+        /* Greek Extended: most capitals are 8 after their lower case forms
+         * in rows of 16 (with no capitals for some of the lower case
+         * letters), but the capitals with oxia are after those with vrachy
+         * and macron and map to lower case forms in U+1F70-U+1F7D. */
+        if (ch < 0x1F70) {
+            if (!(ch & 8) || ch == 0x1F1E || ch == 0x1F1F || ch == 0x1F4E ||
+                ch == 0x1F4F || (ch >= 0x1F58 && ch < 0x1F60 && !(ch & 1)))
+                return ch;
+            return ch - 8;
+        }
+        if (ch >= 0x1F80 && ch < 0x1FB0) return (ch & 8) ? ch - 8 : ch;
+        switch (ch) {
+            case 0x1FB8: case 0x1FB9: case 0x1FD8: case 0x1FD9:
+            case 0x1FE8: case 0x1FE9:
+                return ch - 8;
+            case 0x1FBA: case 0x1FBB:
+                return ch - 0x4A;
+            case 0x1FBC: case 0x1FCC: case 0x1FFC:
+                return ch - 9;
+            case 0x1FC8: case 0x1FC9: case 0x1FCA: case 0x1FCB:
+                return ch - 0x56;
+            case 0x1FDA: case 0x1FDB:
+                return ch - 0x64;
+            case 0x1FEA: case 0x1FEB:
+                return ch - 0x70;
+            case 0x1FEC:
+                return 0x1FE5;
+            case 0x1FF8: case 0x1FF9:
+                return ch - 0x80;
+            case 0x1FFA: case 0x1FFB:
+                return ch - 0x7E;
+        }
+        return ch;
+    }
+    /* Fullwidth Latin. */
+    if (ch >= 0xFF21 && ch <= 0xFF3A) return ch + 0x20;
+    return ch;
+}
+
+/* Ranges of non-ASCII characters in the Basic Multilingual Plane which
+ * separate words: those in the Unicode general categories for punctuation
+ * (P), symbols (S), separators (Z), numbers other than decimal digits (Nl and
+ * No) and control and format characters (Cc, Cf, Co and Cs), except for the
+ * zero width joiner and non-joiner which occur inside words in several
+ * scripts.  Letters (L), marks (M) and decimal digits (Nd) are part of
+ * words, as are unassigned characters.  Sorted by first character.
+ */
+static const struct separator_range {
+    unsigned short first;
+    unsigned short last;
+} separator_ranges[] = {
+    { 0x0080, 0x00A9 }, { 0x00AB, 0x00B4 }, { 0x00B6, 0x00B9 },
+    { 0x00BB, 0x00BF }, { 0x00D7, 0x00D7 }, { 0x00F7, 0x00F7 },
+    { 0x02C2, 0x02C5 }, { 0x02D2, 0x02DF }, { 0x02E5, 0x02EB },
+    { 0x02ED, 0x02ED }, { 0x02EF, 0x02FF }, { 0x0375, 0x0375 },
+    { 0x037E, 0x037E }, { 0x0384, 0x0385 }, { 0x0387, 0x0387 },
+    { 0x03F6, 0x03F6 }, { 0x0482, 0x0482 }, { 0x055A, 0x055F },
+    { 0x0589, 0x058A }, { 0x058D, 0x058F }, { 0x05BE, 0x05BE },
+    { 0x05C0, 0x05C0 }, { 0x05C3, 0x05C3 }, { 0x05C6, 0x05C6 },
+    { 0x05F3, 0x05F4 }, { 0x0600, 0x060F }, { 0x061B, 0x061F },
+    { 0x066A, 0x066D }, { 0x06D4, 0x06D4 }, { 0x06DD, 0x06DE },
+    { 0x06E9, 0x06E9 }, { 0x06FD, 0x06FE }, { 0x0700, 0x070D },
+    { 0x070F, 0x070F }, { 0x07F6, 0x07F9 }, { 0x07FE, 0x07FF },
+    { 0x0830, 0x083E }, { 0x085E, 0x085E }, { 0x0888, 0x0888 },
+    { 0x0890, 0x0891 }, { 0x08E2, 0x08E2 }, { 0x0964, 0x0965 },
+    { 0x0970, 0x0970 }, { 0x09F2, 0x09FB }, { 0x09FD, 0x09FD },
+    { 0x0A76, 0x0A76 }, { 0x0AF0, 0x0AF1 }, { 0x0B70, 0x0B70 },
+    { 0x0B72, 0x0B77 }, { 0x0BF0, 0x0BFA }, { 0x0C77, 0x0C7F },
+    { 0x0C84, 0x0C84 }, { 0x0D4F, 0x0D4F }, { 0x0D58, 0x0D5E },
+    { 0x0D70, 0x0D79 }, { 0x0DF4, 0x0DF4 }, { 0x0E3F, 0x0E3F },
+    { 0x0E4F, 0x0E4F }, { 0x0E5A, 0x0E5B }, { 0x0F01, 0x0F17 },
+    { 0x0F1A, 0x0F1F }, { 0x0F2A, 0x0F34 }, { 0x0F36, 0x0F36 },
+    { 0x0F38, 0x0F38 }, { 0x0F3A, 0x0F3D }, { 0x0F85, 0x0F85 },
+    { 0x0FBE, 0x0FC5 }, { 0x0FC7, 0x0FCC }, { 0x0FCE, 0x0FDA },
+    { 0x104A, 0x104F }, { 0x109E, 0x109F }, { 0x10FB, 0x10FB },
+    { 0x1360, 0x137C }, { 0x1390, 0x1399 }, { 0x1400, 0x1400 },
+    { 0x166D, 0x166E }, { 0x1680, 0x1680 }, { 0x169B, 0x169C },
+    { 0x16EB, 0x16F0 }, { 0x1735, 0x1736 }, { 0x17D4, 0x17D6 },
+    { 0x17D8, 0x17DB }, { 0x17F0, 0x17F9 }, { 0x1800, 0x180A },
+    { 0x180E, 0x180E }, { 0x1940, 0x1940 }, { 0x1944, 0x1945 },
+    { 0x19DA, 0x19DA }, { 0x19DE, 0x19FF }, { 0x1A1E, 0x1A1F },
+    { 0x1AA0, 0x1AA6 }, { 0x1AA8, 0x1AAD }, { 0x1B5A, 0x1B6A },
+    { 0x1B74, 0x1B7E }, { 0x1BFC, 0x1BFF }, { 0x1C3B, 0x1C3F },
+    { 0x1C7E, 0x1C7F }, { 0x1CC0, 0x1CC7 }, { 0x1CD3, 0x1CD3 },
+    { 0x1FBD, 0x1FBD }, { 0x1FBF, 0x1FC1 }, { 0x1FCD, 0x1FCF },
+    { 0x1FDD, 0x1FDF }, { 0x1FED, 0x1FEF }, { 0x1FFD, 0x1FFE },
+    { 0x2000, 0x200B }, { 0x200E, 0x2064 }, { 0x2066, 0x2070 },
+    { 0x2074, 0x207E }, { 0x2080, 0x208E }, { 0x20A0, 0x20C0 },
+    { 0x2100, 0x2101 }, { 0x2103, 0x2106 }, { 0x2108, 0x2109 },
+    { 0x2114, 0x2114 }, { 0x2116, 0x2118 }, { 0x211E, 0x2123 },
+    { 0x2125, 0x2125 }, { 0x2127, 0x2127 }, { 0x2129, 0x2129 },
+    { 0x212E, 0x212E }, { 0x213A, 0x213B }, { 0x2140, 0x2144 },
+    { 0x214A, 0x214D }, { 0x214F, 0x2182 }, { 0x2185, 0x218B },
+    { 0x2190, 0x2426 }, { 0x2440, 0x244A }, { 0x2460, 0x2B73 },
+    { 0x2B76, 0x2B95 }, { 0x2B97, 0x2BFF }, { 0x2CE5, 0x2CEA },
+    { 0x2CF9, 0x2CFF }, { 0x2D70, 0x2D70 }, { 0x2E00, 0x2E2E },
+    { 0x2E30, 0x2E5D }, { 0x2E80, 0x2E99 }, { 0x2E9B, 0x2EF3 },
+    { 0x2F00, 0x2FD5 }, { 0x2FF0, 0x2FFB }, { 0x3000, 0x3004 },
+    { 0x3007, 0x3029 }, { 0x3030, 0x3030 }, { 0x3036, 0x303A },
+    { 0x303D, 0x303F }, { 0x309B, 0x309C }, { 0x30A0, 0x30A0 },
+    { 0x30FB, 0x30FB }, { 0x3190, 0x319F }, { 0x31C0, 0x31E3 },
+    { 0x3200, 0x321E }, { 0x3220, 0x33FF }, { 0x4DC0, 0x4DFF },
+    { 0xA490, 0xA4C6 }, { 0xA4FE, 0xA4FF }, { 0xA60D, 0xA60F },
+    { 0xA673, 0xA673 }, { 0xA67E, 0xA67E }, { 0xA6E6, 0xA6EF },
+    { 0xA6F2, 0xA6F7 }, { 0xA700, 0xA716 }, { 0xA720, 0xA721 },
+    { 0xA789, 0xA78A }, { 0xA828, 0xA82B }, { 0xA830, 0xA839 },
+    { 0xA874, 0xA877 }, { 0xA8CE, 0xA8CF }, { 0xA8F8, 0xA8FA },
+    { 0xA8FC, 0xA8FC }, { 0xA92E, 0xA92F }, { 0xA95F, 0xA95F },
+    { 0xA9C1, 0xA9CD }, { 0xA9DE, 0xA9DF }, { 0xAA5C, 0xAA5F },
+    { 0xAA77, 0xAA79 }, { 0xAADE, 0xAADF }, { 0xAAF0, 0xAAF1 },
+    { 0xAB5B, 0xAB5B }, { 0xAB6A, 0xAB6B }, { 0xABEB, 0xABEB },
+    { 0xD800, 0xF8FF }, { 0xFB29, 0xFB29 }, { 0xFBB2, 0xFBC2 },
+    { 0xFD3E, 0xFD4F }, { 0xFDCF, 0xFDCF }, { 0xFDFC, 0xFDFF },
+    { 0xFE10, 0xFE19 }, { 0xFE30, 0xFE52 }, { 0xFE54, 0xFE66 },
+    { 0xFE68, 0xFE6B }, { 0xFEFF, 0xFEFF }, { 0xFF01, 0xFF0F },
+    { 0xFF1A, 0xFF20 }, { 0xFF3B, 0xFF40 }, { 0xFF5B, 0xFF65 },
+    { 0xFFE0, 0xFFE6 }, { 0xFFE8, 0xFFEE }, { 0xFFF9, 0xFFFD }
+};
+
+/* Return non-zero if non-ASCII Unicode character ch separates words. */
+static int
+sb_is_separator(int ch)
+{
+    int i = 0;
+    int j = sizeof(separator_ranges) / sizeof(separator_ranges[0]);
+    /* Outside the BMP, only emoji and other pictographs. */
+    if (ch > 0xFFFF) return ch >= 0x1F000 && ch < 0x1FB00;
+    while (i < j) {
+        int k = i + ((j - i) >> 1);
+        if (ch < separator_ranges[k].first) {
+            j = k;
+        } else if (ch > separator_ranges[k].last) {
+            i = k + 1;
+        } else {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* Decode the UTF-8 character at p (with n bytes available) into *ch.
+ * Returns the number of bytes used.  Invalid sequences decode to -1 with a
+ * width of 1.
+ */
+static int
+sb_get_utf8(const sb_symbol * p, int n, int * ch)
+{
+    int b0 = p[0];
+    int w, i, c;
+    if (b0 < 0x80) {
+        *ch = b0;
+        return 1;
+    }
+    if (b0 < 0xC2) {
+        w = 0;
+    } else if (b0 < 0xE0) {
+        w = 2; c = b0 & 0x1F;
+    } else if (b0 < 0xF0) {
+        w = 3; c = b0 & 0x0F;
+    } else if (b0 < 0xF5) {
+        w = 4; c = b0 & 0x07;
+    } else {
+        w = 0;
+    }
+    if (w == 0 || w > n) {
+        *ch = -1;
+        return 1;
+    }
+    /* Reject overlong forms, UTF-16 surrogates and code points above
+     * U+10FFFF, which are the cases where the second byte has a narrower
+     * range than 0x80-0xBF.
+     */
+    if ((b0 == 0xE0 && p[1] < 0xA0) || (b0 == 0xED && p[1] >= 0xA0) ||
+        (b0 == 0xF0 && p[1] < 0x90) || (b0 == 0xF4 && p[1] >= 0x90)) {
+        *ch = -1;
+        return 1;
+    }
+    for (i = 1; i < w; i++) {
+        if ((p[i] & 0xC0) != 0x80) {
+            *ch = -1;
+            return 1;
+        }
+        c = c << 6 | (p[i] & 0x3F);
+    }
+    *ch = c;
+    return w;
+}
+
+/* Encode ch as UTF-8 at p, returning the number of bytes written. */
+static int
+sb_put_utf8(sb_symbol * p, int ch)
+{
+    if (ch < 0x80) {
+        p[0] = ch;
+        return 1;
+    }
+    if (ch < 0x800) {
+        p[0] = 0xC0 | ch >> 6;
+        p[1] = 0x80 | (ch & 0x3F);
+        return 2;
+    }
+    if (ch < 0x10000) {
+        p[0] = 0xE0 | ch >> 12;
+        p[1] = 0x80 | (ch >> 6 & 0x3F);
+        p[2] = 0x80 | (ch & 0x3F);
+        return 3;
+    }
+    p[0] = 0xF0 | ch >> 18;
+    p[1] = 0x80 | (ch >> 12 & 0x3F);
+    p[2] = 0x80 | (ch >> 6 & 0x3F);
+    p[3] = 0x80 | (ch & 0x3F);
+    return 4;
+}
+
+/* Return the lower case form of byte b in a single byte character set, or -1
+ * if it separates words.
+ */
+static int
+sb_fold_byte(charset_t charset, int b)
+{
+    if (b < 0x80) {
+        if (b >= 'A' && b <= 'Z') return b + 0x20;
+        if ((b >= 'a' && b <= 'z') || (b >= '0' && b <= '9')) return b;
+        return -1;
+    }
+    switch (charset) {
+        case CHARSET_ISO_8859_1:
+            if (b < 0xC0) return (b == 0xAA || b == 0xB5 || b == 0xBA) ? b : -1;
+            if (b == 0xD7 || b == 0xF7) return -1;
+            return b < 0xDF ? b + 0x20 : b;
+        case CHARSET_ISO_8859_2:
+            if (b < 0xA0) return -1;
+            if (b < 0xC0) {
+                switch (b) {
+                    case 0xA0: case 0xA2: case 0xA4: case 0xA7: case 0xA8:
+                    case 0xAD: case 0xB0: case 0xB2: case 0xB4: case 0xB7:
+                    case 0xB8: case 0xBD:
+                        return -1;
+                }
+                return b < 0xB0 ? b + 0x10 : b;
+            }
+            /* Multiplication and division signs, and dot above. */
+            if (b == 0xD7 || b == 0xF7 || b == 0xFF) return -1;
+            return b < 0xDF ? b + 0x20 : b;
+        case CHARSET_KOI8_R:
+            if (b == 0xA3) return b;
+            if (b == 0xB3) return 0xA3;
+            if (b < 0xC0) return -1;
+            return b >= 0xE0 ? b - 0x20 : b;
+        default:
+            return b;
+    }
+}
+
+/* Return non-zero if the character at text[i] (where i < size) can be part
+ * of a word, and set *w to its width.
+ */
+static int
+sb_is_word_char(charset_t charset, const sb_symbol * text, int size, int i,
+                int * w)
+{
+    int b = text[i];
+    int ch;
+    if (b < 0x80) {
+        /* Fast path for ASCII. */
+        *w = 1;
+        return ((b | 0x20) >= 'a' && (b | 0x20) <= 'z') || (b >= '0' && b <= '9');
+    }
+    if (charset != CHARSET_UTF_8) {
+        *w = 1;
+        return sb_fold_byte(charset, b) >= 0;
+    }
+    *w = sb_get_utf8(text + i, size - i, &ch);
+    /* Invalid UTF-8 isn't a letter or digit. */
+    return ch >= 0 && !sb_is_separator(ch);
+}
+
+/* Return non-zero if the character at text[i] (where i < size) is an
+ * apostrophe, and set *w to its width.
+ */
+static int
+sb_is_apostrophe(charset_t charset, const sb_symbol * text, int size, int i,
+                 int * w)
+{
+    int ch;
+    *w = 1;
+    if (text[i] == '\'') return 1;
+    /* Right single quotation mark, commonly used as an apostrophe. */
+    if (charset != CHARSET_UTF_8 || text[i] != 0xE2) return 0;
+    *w = sb_get_utf8(text + i, size - i, &ch);
+    return ch == 0x2019;
+}
+
+/* Find the next word in text, starting the search at *start.  On return
+ * *start and *end are the offsets of the start and end of the word (both are
+ * size if there are no more words).
+ */
+static void
+sb_find_word(charset_t charset, const sb_symbol * text, int size,
+             int * start, int * end)
+{
+    int i = *start;
+    int w;
+    while (i < size && !sb_is_word_char(charset, text, size, i, &w)) i += w;
+    *start = i;
+    while (i < size) {
+        if (!sb_is_word_char(charset, text, size, i, &w)) {
+            /* Apostrophes are part of a word if followed by a character
+             * which is. */
+            int w2;
+            if (!sb_is_apostrophe(charset, text, size, i, &w) ||
+                i + w == size ||
+                !sb_is_word_char(charset, text, size, i + w, &w2)) break;
+        }
+        i += w;
+    }
+    *end = i;
+}
+
+/* Write the lower case form of word (found by sb_find_word()) to out, which
+ * must have room for size symbols (lower-casing never makes the word
+ * longer).  Returns the length of the result.
+ */
+static int
+sb_fold_word(charset_t charset, const sb_symbol * word, int size,
+             sb_symbol * out)
+{
+    int i = 0;
+    int len = 0;
+    while (i < size) {
+        int b = word[i];
+        int ch;
+        int w;
+        if (b < 0x80) {
+            out[len++] = (b >= 'A' && b <= 'Z') ? b + 0x20 : b;
+            i++;
+        } else if (charset != CHARSET_UTF_8) {
+            int folded = sb_fold_byte(charset, b);
+            out[len++] = folded < 0 ? b : folded;
+            i++;
+        } else {
+            w = sb_get_utf8(word + i, size - i, &ch);
+            if (ch == 0x2019) {
+                /* The stemmers expect apostrophes to be ASCII. */
+                out[len++] = '\'';
+            } else if (ch >= 0 && sb_tolower(ch) != ch) {
+                len += sb_put_utf8(out + len, sb_tolower(ch));
+            } else {
+                memcpy(out + len, word + i, w);
+                len += w;
+            }
+            i += w;
+        }
+    }
+    return len;
+}
+
+int
+sb_stemmer_stem_text(struct sb_stemmer * stemmer,
+                     const sb_symbol * text, int size,
+                     struct sb_stemmer_span * spans, int max_spans,
+                     sb_symbol * out, int out_size, int * consumed)
+{
+    int n = 0;
+    int pos = 0;
+    int out_pos = 0;
+    while (1) {
+        int start = pos;
+        int end;
+        int len;
+        sb_find_word(stemmer->charset, text, size, &start, &end);
+        pos = start;
+        if (start == size || n == max_spans) break;
+        /* The lower case word is written to out, then stemmed in place. */
+        if (end - start > out_size - out_pos) break;
+        len = sb_fold_word(stemmer->charset, text + start, end - start,
+                           out + out_pos);
+        if (sb_stem_word(stemmer, out + out_pos, len) < 0) return -1;
+        len = stemmer->env->l;
+        if (len > out_size - out_pos) break;
+        memcpy(out + out_pos, stemmer->env->p, len);
+        spans[n].start = start;
+        spans[n].end = end;
+        spans[n].stem = out_pos;
+        spans[n].stem_len = len;
+        out_pos += len;
+        pos = end;
+        ++n;
+    }
+    *consumed = pos;
+    /* If the first word doesn't fit then calling again with the same
+     * out_size can't make progress. */
+    if (n == 0 && pos < size && max_spans > 0) return -2;
+    return n;
+}
+
+/* Ranges of characters with the Unicode NFC_Quick_Check property "No" or
+ * "Maybe", sorted by first character.  This covers the Basic Multilingual
+ * Plane, which includes all the scripts the stemming algorithms handle.
+ */
+static const struct nfc_qc_range {
+    unsigned short first;
+    unsigned short last;
+    unsigned char qc;
+} nfc_qc_ranges[] = {
+    { 0x0300, 0x0304, SB_NFC_MAYBE }, { 0x0306, 0x030C, SB_NFC_MAYBE },
+    { 0x030F, 0x030F, SB_NFC_MAYBE }, { 0x0311, 0x0311, SB_NFC_MAYBE },
+    { 0x0313, 0x0314, SB_NFC_MAYBE }, { 0x031B, 0x031B, SB_NFC_MAYBE },
+    { 0x0323, 0x0328, SB_NFC_MAYBE }, { 0x032D, 0x032E, SB_NFC_MAYBE },
+    { 0x0330, 0x0331, SB_NFC_MAYBE }, { 0x0338, 0x0338, SB_NFC_MAYBE },
+    { 0x0340, 0x0341, SB_NFC_NO }, { 0x0342, 0x0342, SB_NFC_MAYBE },
+    { 0x0343, 0x0344, SB_NFC_NO }, { 0x0345, 0x0345, SB_NFC_MAYBE },
+    { 0x0374, 0x0374, SB_NFC_NO }, { 0x037E, 0x037E, SB_NFC_NO },
+    { 0x0387, 0x0387, SB_NFC_NO }, { 0x0653, 0x0655, SB_NFC_MAYBE },
+    { 0x093C, 0x093C, SB_NFC_MAYBE }, { 0x0958, 0x095F, SB_NFC_NO },
+    { 0x09BE, 0x09BE, SB_NFC_MAYBE }, { 0x09D7, 0x09D7, SB_NFC_MAYBE },
+    { 0x09DC, 0x09DD, SB_NFC_NO }, { 0x09DF, 0x09DF, SB_NFC_NO },
+    { 0x0A33, 0x0A33, SB_NFC_NO }, { 0x0A36, 0x0A36, SB_NFC_NO },
+    { 0x0A59, 0x0A5B, SB_NFC_NO }, { 0x0A5E, 0x0A5E, SB_NFC_NO },
+    { 0x0B3E, 0x0B3E, SB_NFC_MAYBE }, { 0x0B56, 0x0B57, SB_NFC_MAYBE },
+    { 0x0B5C, 0x0B5D, SB_NFC_NO }, { 0x0BBE, 0x0BBE, SB_NFC_MAYBE },
+    { 0x0BD7, 0x0BD7, SB_NFC_MAYBE }, { 0x0C56, 0x0C56, SB_NFC_MAYBE },
+    { 0x0CC2, 0x0CC2, SB_NFC_MAYBE }, { 0x0CD5, 0x0CD6, SB_NFC_MAYBE },
+    { 0x0D3E, 0x0D3E, SB_NFC_MAYBE }, { 0x0D57, 0x0D57, SB_NFC_MAYBE },
+    { 0x0DCA, 0x0DCA, SB_NFC_MAYBE }, { 0x0DCF, 0x0DCF, SB_NFC_MAYBE },
+    { 0x0DDF, 0x0DDF, SB_NFC_MAYBE }, { 0x0F43, 0x0F43, SB_NFC_NO },
+    { 0x0F4D, 0x0F4D, SB_NFC_NO }, { 0x0F52, 0x0F52, SB_NFC_NO },
+    { 0x0F57, 0x0F57, SB_NFC_NO }, { 0x0F5C, 0x0F5C, SB_NFC_NO },
+    { 0x0F69, 0x0F69, SB_NFC_NO }, { 0x0F73, 0x0F73, SB_NFC_NO },
+    { 0x0F75, 0x0F76, SB_NFC_NO }, { 0x0F78, 0x0F78, SB_NFC_NO },
+    { 0x0F81, 0x0F81, SB_NFC_NO }, { 0x0F93, 0x0F93, SB_NFC_NO },
+    { 0x0F9D, 0x0F9D, SB_NFC_NO }, { 0x0FA2, 0x0FA2, SB_NFC_NO },
+    { 0x0FA7, 0x0FA7, SB_NFC_NO }, { 0x0FAC, 0x0FAC, SB_NFC_NO },
+    { 0x0FB9, 0x0FB9, SB_NFC_NO }, { 0x102E, 0x102E, SB_NFC_MAYBE },
+    { 0x1161, 0x1175, SB_NFC_MAYBE }, { 0x11A8, 0x11C2, SB_NFC_MAYBE },
+    { 0x1B35, 0x1B35, SB_NFC_MAYBE }, { 0x1F71, 0x1F71, SB_NFC_NO },
+    { 0x1F73, 0x1F73, SB_NFC_NO }, { 0x1F75, 0x1F75, SB_NFC_NO },
+    { 0x1F77, 0x1F77, SB_NFC_NO }, { 0x1F79, 0x1F79, SB_NFC_NO },
+    { 0x1F7B, 0x1F7B, SB_NFC_NO }, { 0x1F7D, 0x1F7D, SB_NFC_NO },
+    { 0x1FBB, 0x1FBB, SB_NFC_NO }, { 0x1FBE, 0x1FBE, SB_NFC_NO },
+    { 0x1FC9, 0x1FC9, SB_NFC_NO }, { 0x1FCB, 0x1FCB, SB_NFC_NO },
+    { 0x1FD3, 0x1FD3, SB_NFC_NO }, { 0x1FDB, 0x1FDB, SB_NFC_NO },
+    { 0x1FE3, 0x1FE3, SB_NFC_NO }, { 0x1FEB, 0x1FEB, SB_NFC_NO },
+    { 0x1FEE, 0x1FEF, SB_NFC_NO }, { 0x1FF9, 0x1FF9, SB_NFC_NO },
+    { 0x1FFB, 0x1FFB, SB_NFC_NO }, { 0x1FFD, 0x1FFD, SB_NFC_NO },
+    { 0x2000, 0x2001, SB_NFC_NO }, { 0x2126, 0x2126, SB_NFC_NO },
+    { 0x212A, 0x212B, SB_NFC_NO }, { 0x2329, 0x232A, SB_NFC_NO },
+    { 0x2ADC, 0x2ADC, SB_NFC_NO }, { 0x3099, 0x309A, SB_NFC_MAYBE },
+    { 0xF900, 0xFA0D, SB_NFC_NO }, { 0xFA10, 0xFA10, SB_NFC_NO },
+    { 0xFA12, 0xFA12, SB_NFC_NO }, { 0xFA15, 0xFA1E, SB_NFC_NO },
+    { 0xFA20, 0xFA20, SB_NFC_NO }, { 0xFA22, 0xFA22, SB_NFC_NO },
+    { 0xFA25, 0xFA26, SB_NFC_NO }, { 0xFA2A, 0xFA6D, SB_NFC_NO },
+    { 0xFA70, 0xFAD9, SB_NFC_NO }, { 0xFB1D, 0xFB1D, SB_NFC_NO },
+    { 0xFB1F, 0xFB1F, SB_NFC_NO }, { 0xFB2A, 0xFB36, SB_NFC_NO },
+    { 0xFB38, 0xFB3C, SB_NFC_NO }, { 0xFB3E, 0xFB3E, SB_NFC_NO },
+    { 0xFB40, 0xFB41, SB_NFC_NO }, { 0xFB43, 0xFB44, SB_NFC_NO },
+    { 0xFB46, 0xFB4E, SB_NFC_NO }
+};
+
+/* Return the NFC_Quick_Check value for non-ASCII character ch. */
+static int
+sb_nfc_qc(int ch)
+{
+    int i = 0;
+    int j = sizeof(nfc_qc_ranges) / sizeof(nfc_qc_ranges[0]);
+    if (ch < 0x300 || ch > 0xFFFF) return SB_NFC_YES;
+    while (i < j) {
+        int k = i + ((j - i) >> 1);
+        if (ch < nfc_qc_ranges[k].first) {
+            j = k;
+        } else if (ch > nfc_qc_ranges[k].last) {
+            i = k + 1;
+        } else {
+            return nfc_qc_ranges[k].qc;
+        }
+    }
+    return SB_NFC_YES;
+}
+
+/* Ranges of characters with a non-zero Unicode Canonical_Combining_Class,
+ * sorted by first character.  Like nfc_qc_ranges this covers the Basic
+ * Multilingual Plane.
+ */
+static const struct ccc_range {
+    unsigned short first;
+    unsigned short last;
+    unsigned char ccc;
+} ccc_ranges[] = {
+    { 0x0300, 0x0314, 230 }, { 0x0315, 0x0315, 232 }, { 0x0316, 0x0319, 220 },
+    { 0x031A, 0x031A, 232 }, { 0x031B, 0x031B, 216 }, { 0x031C, 0x0320, 220 },
+    { 0x0321, 0x0322, 202 }, { 0x0323, 0x0326, 220 }, { 0x0327, 0x0328, 202 },
+    { 0x0329, 0x0333, 220 }, { 0x0334, 0x0338, 1 }, { 0x0339, 0x033C, 220 },
+    { 0x033D, 0x0344, 230 }, { 0x0345, 0x0345, 240 }, { 0x0346, 0x0346, 230 },
+    { 0x0347, 0x0349, 220 }, { 0x034A, 0x034C, 230 }, { 0x034D, 0x034E, 220 },
+    { 0x0350, 0x0352, 230 }, { 0x0353, 0x0356, 220 }, { 0x0357, 0x0357, 230 },
+    { 0x0358, 0x0358, 232 }, { 0x0359, 0x035A, 220 }, { 0x035B, 0x035B, 230 },
+    { 0x035C, 0x035C, 233 }, { 0x035D, 0x035E, 234 }, { 0x035F, 0x035F, 233 },
+    { 0x0360, 0x0361, 234 }, { 0x0362, 0x0362, 233 }, { 0x0363, 0x036F, 230 },
+    { 0x0483, 0x0487, 230 }, { 0x0591, 0x0591, 220 }, { 0x0592, 0x0595, 230 },
+    { 0x0596, 0x0596, 220 }, { 0x0597, 0x0599, 230 }, { 0x059A, 0x059A, 222 },
+    { 0x059B, 0x059B, 220 }, { 0x059C, 0x05A1, 230 }, { 0x05A2, 0x05A7, 220 },
+    { 0x05A8, 0x05A9, 230 }, { 0x05AA, 0x05AA, 220 }, { 0x05AB, 0x05AC, 230 },
+    { 0x05AD, 0x05AD, 222 }, { 0x05AE, 0x05AE, 228 }, { 0x05AF, 0x05AF, 230 },
+    { 0x05B0, 0x05B0, 10 }, { 0x05B1, 0x05B1, 11 }, { 0x05B2, 0x05B2, 12 },
+    { 0x05B3, 0x05B3, 13 }, { 0x05B4, 0x05B4, 14 }, { 0x05B5, 0x05B5, 15 },
+    { 0x05B6, 0x05B6, 16 }, { 0x05B7, 0x05B7, 17 }, { 0x05B8, 0x05B8, 18 },
+    { 0x05B9, 0x05BA, 19 }, { 0x05BB, 0x05BB, 20 }, { 0x05BC, 0x05BC, 21 },
+    { 0x05BD, 0x05BD, 22 }, { 0x05BF, 0x05BF, 23 }, { 0x05C1, 0x05C1, 24 },
+    { 0x05C2, 0x05C2, 25 }, { 0x05C4, 0x05C4, 230 }, { 0x05C5, 0x05C5, 220 },
+    { 0x05C7, 0x05C7, 18 }, { 0x0610, 0x0617, 230 }, { 0x0618, 0x0618, 30 },
+    { 0x0619, 0x0619, 31 }, { 0x061A, 0x061A, 32 }, { 0x064B, 0x064B, 27 },
+    { 0x064C, 0x064C, 28 }, { 0x064D, 0x064D, 29 }, { 0x064E, 0x064E, 30 },
+    { 0x064F, 0x064F, 31 }, { 0x0650, 0x0650, 32 }, { 0x0651, 0x0651, 33 },
+    { 0x0652, 0x0652, 34 }, { 0x0653, 0x0654, 230 }, { 0x0655, 0x0656, 220 },
+    { 0x0657, 0x065B, 230 }, { 0x065C, 0x065C, 220 }, { 0x065D, 0x065E, 230 },
+    { 0x065F, 0x065F, 220 }, { 0x0670, 0x0670, 35 }, { 0x06D6, 0x06DC, 230 },
+    { 0x06DF, 0x06E2, 230 }, { 0x06E3, 0x06E3, 220 }, { 0x06E4, 0x06E4, 230 },
+    { 0x06E7, 0x06E8, 230 }, { 0x06EA, 0x06EA, 220 }, { 0x06EB, 0x06EC, 230 },
+    { 0x06ED, 0x06ED, 220 }, { 0x0711, 0x0711, 36 }, { 0x0730, 0x0730, 230 },
+    { 0x0731, 0x0731, 220 }, { 0x0732, 0x0733, 230 }, { 0x0734, 0x0734, 220 },
+    { 0x0735, 0x0736, 230 }, { 0x0737, 0x0739, 220 }, { 0x073A, 0x073A, 230 },
+    { 0x073B, 0x073C, 220 }, { 0x073D, 0x073D, 230 }, { 0x073E, 0x073E, 220 },
+    { 0x073F, 0x0741, 230 }, { 0x0742, 0x0742, 220 }, { 0x0743, 0x0743, 230 },
+    { 0x0744, 0x0744, 220 }, { 0x0745, 0x0745, 230 }, { 0x0746, 0x0746, 220 },
+    { 0x0747, 0x0747, 230 }, { 0x0748, 0x0748, 220 }, { 0x0749, 0x074A, 230 },
+    { 0x07EB, 0x07F1, 230 }, { 0x07F2, 0x07F2, 220 }, { 0x07F3, 0x07F3, 230 },
+    { 0x07FD, 0x07FD, 220 }, { 0x0816, 0x0819, 230 }, { 0x081B, 0x0823, 230 },
+    { 0x0825, 0x0827, 230 }, { 0x0829, 0x082D, 230 }, { 0x0859, 0x085B, 220 },
+    { 0x0898, 0x0898, 230 }, { 0x0899, 0x089B, 220 }, { 0x089C, 0x089F, 230 },
+    { 0x08CA, 0x08CE, 230 }, { 0x08CF, 0x08D3, 220 }, { 0x08D4, 0x08E1, 230 },
+    { 0x08E3, 0x08E3, 220 }, { 0x08E4, 0x08E5, 230 }, { 0x08E6, 0x08E6, 220 },
+    { 0x08E7, 0x08E8, 230 }, { 0x08E9, 0x08E9, 220 }, { 0x08EA, 0x08EC, 230 },
+    { 0x08ED, 0x08EF, 220 }, { 0x08F0, 0x08F0, 27 }, { 0x08F1, 0x08F1, 28 },
+    { 0x08F2, 0x08F2, 29 }, { 0x08F3, 0x08F5, 230 }, { 0x08F6, 0x08F6, 220 },
+    { 0x08F7, 0x08F8, 230 }, { 0x08F9, 0x08FA, 220 }, { 0x08FB, 0x08FF, 230 },
+    { 0x093C, 0x093C, 7 }, { 0x094D, 0x094D, 9 }, { 0x0951, 0x0951, 230 },
+    { 0x0952, 0x0952, 220 }, { 0x0953, 0x0954, 230 }, { 0x09BC, 0x09BC, 7 },
+    { 0x09CD, 0x09CD, 9 }, { 0x09FE, 0x09FE, 230 }, { 0x0A3C, 0x0A3C, 7 },
+    { 0x0A4D, 0x0A4D, 9 }, { 0x0ABC, 0x0ABC, 7 }, { 0x0ACD, 0x0ACD, 9 },
+    { 0x0B3C, 0x0B3C, 7 }, { 0x0B4D, 0x0B4D, 9 }, { 0x0BCD, 0x0BCD, 9 },
+    { 0x0C3C, 0x0C3C, 7 }, { 0x0C4D, 0x0C4D, 9 }, { 0x0C55, 0x0C55, 84 },
+    { 0x0C56, 0x0C56, 91 }, { 0x0CBC, 0x0CBC, 7 }, { 0x0CCD, 0x0CCD, 9 },
+    { 0x0D3B, 0x0D3C, 9 }, { 0x0D4D, 0x0D4D, 9 }, { 0x0DCA, 0x0DCA, 9 },
+    { 0x0E38, 0x0E39, 103 }, { 0x0E3A, 0x0E3A, 9 }, { 0x0E48, 0x0E4B, 107 },
+    { 0x0EB8, 0x0EB9, 118 }, { 0x0EBA, 0x0EBA, 9 }, { 0x0EC8, 0x0ECB, 122 },
+    { 0x0F18, 0x0F19, 220 }, { 0x0F35, 0x0F35, 220 }, { 0x0F37, 0x0F37, 220 },
+    { 0x0F39, 0x0F39, 216 }, { 0x0F71, 0x0F71, 129 }, { 0x0F72, 0x0F72, 130 },
+    { 0x0F74, 0x0F74, 132 }, { 0x0F7A, 0x0F7D, 130 }, { 0x0F80, 0x0F80, 130 },
+    { 0x0F82, 0x0F83, 230 }, { 0x0F84, 0x0F84, 9 }, { 0x0F86, 0x0F87, 230 },
+    { 0x0FC6, 0x0FC6, 220 }, { 0x1037, 0x1037, 7 }, { 0x1039, 0x103A, 9 },
+    { 0x108D, 0x108D, 220 }, { 0x135D, 0x135F, 230 }, { 0x1714, 0x1715, 9 },
+    { 0x1734, 0x1734, 9 }, { 0x17D2, 0x17D2, 9 }, { 0x17DD, 0x17DD, 230 },
+    { 0x18A9, 0x18A9, 228 }, { 0x1939, 0x1939, 222 }, { 0x193A, 0x193A, 230 },
+    { 0x193B, 0x193B, 220 }, { 0x1A17, 0x1A17, 230 }, { 0x1A18, 0x1A18, 220 },
+    { 0x1A60, 0x1A60, 9 }, { 0x1A75, 0x1A7C, 230 }, { 0x1A7F, 0x1A7F, 220 },
+    { 0x1AB0, 0x1AB4, 230 }, { 0x1AB5, 0x1ABA, 220 }, { 0x1ABB, 0x1ABC, 230 },
+    { 0x1ABD, 0x1ABD, 220 }, { 0x1ABF, 0x1AC0, 220 }, { 0x1AC1, 0x1AC2, 230 },
+    { 0x1AC3, 0x1AC4, 220 }, { 0x1AC5, 0x1AC9, 230 }, { 0x1ACA, 0x1ACA, 220 },
+    { 0x1ACB, 0x1ACE, 230 }, { 0x1B34, 0x1B34, 7 }, { 0x1B44, 0x1B44, 9 },
+    { 0x1B6B, 0x1B6B, 230 }, { 0x1B6C, 0x1B6C, 220 }, { 0x1B6D, 0x1B73, 230 },
+    { 0x1BAA, 0x1BAB, 9 }, { 0x1BE6, 0x1BE6, 7 }, { 0x1BF2, 0x1BF3, 9 },
+    { 0x1C37, 0x1C37, 7 }, { 0x1CD0, 0x1CD2, 230 }, { 0x1CD4, 0x1CD4, 1 },
+    { 0x1CD5, 0x1CD9, 220 }, { 0x1CDA, 0x1CDB, 230 }, { 0x1CDC, 0x1CDF, 220 },
+    { 0x1CE0, 0x1CE0, 230 }, { 0x1CE2, 0x1CE8, 1 }, { 0x1CED, 0x1CED, 220 },
+    { 0x1CF4, 0x1CF4, 230 }, { 0x1CF8, 0x1CF9, 230 }, { 0x1DC0, 0x1DC1, 230 },
+    { 0x1DC2, 0x1DC2, 220 }, { 0x1DC3, 0x1DC9, 230 }, { 0x1DCA, 0x1DCA, 220 },
+    { 0x1DCB, 0x1DCC, 230 }, { 0x1DCD, 0x1DCD, 234 }, { 0x1DCE, 0x1DCE, 214 },
+    { 0x1DCF, 0x1DCF, 220 }, { 0x1DD0, 0x1DD0, 202 }, { 0x1DD1, 0x1DF5, 230 },
+    { 0x1DF6, 0x1DF6, 232 }, { 0x1DF7, 0x1DF8, 228 }, { 0x1DF9, 0x1DF9, 220 },
+    { 0x1DFA, 0x1DFA, 218 }, { 0x1DFB, 0x1DFB, 230 }, { 0x1DFC, 0x1DFC, 233 },
+    { 0x1DFD, 0x1DFD, 220 }, { 0x1DFE, 0x1DFE, 230 }, { 0x1DFF, 0x1DFF, 220 },
+    { 0x20D0, 0x20D1, 230 }, { 0x20D2, 0x20D3, 1 }, { 0x20D4, 0x20D7, 230 },
+    { 0x20D8, 0x20DA, 1 }, { 0x20DB, 0x20DC, 230 }, { 0x20E1, 0x20E1, 230 },
+    { 0x20E5, 0x20E6, 1 }, { 0x20E7, 0x20E7, 230 }, { 0x20E8, 0x20E8, 220 },
+    { 0x20E9, 0x20E9, 230 }, { 0x20EA, 0x20EB, 1 }, { 0x20EC, 0x20EF, 220 },
+    { 0x20F0, 0x20F0, 230 }, { 0x2CEF, 0x2CF1, 230 }, { 0x2D7F, 0x2D7F, 9 },
+    { 0x2DE0, 0x2DFF, 230 }, { 0x302A, 0x302A, 218 }, { 0x302B, 0x302B, 228 },
+    { 0x302C, 0x302C, 232 }, { 0x302D, 0x302D, 222 }, { 0x302E, 0x302F, 224 },
+    { 0x3099, 0x309A, 8 }, { 0xA66F, 0xA66F, 230 }, { 0xA674, 0xA67D, 230 },
+    { 0xA69E, 0xA69F, 230 }, { 0xA6F0, 0xA6F1, 230 }, { 0xA806, 0xA806, 9 },
+    { 0xA82C, 0xA82C, 9 }, { 0xA8C4, 0xA8C4, 9 }, { 0xA8E0, 0xA8F1, 230 },
+    { 0xA92B, 0xA92D, 220 }, { 0xA953, 0xA953, 9 }, { 0xA9B3, 0xA9B3, 7 },
+    { 0xA9C0, 0xA9C0, 9 }, { 0xAAB0, 0xAAB0, 230 }, { 0xAAB2, 0xAAB3, 230 },
+    { 0xAAB4, 0xAAB4, 220 }, { 0xAAB7, 0xAAB8, 230 }, { 0xAABE, 0xAABF, 230 },
+    { 0xAAC1, 0xAAC1, 230 }, { 0xAAF6, 0xAAF6, 9 }, { 0xABED, 0xABED, 9 },
+    { 0xFB1E, 0xFB1E, 26 }, { 0xFE20, 0xFE26, 230 }, { 0xFE27, 0xFE2D, 220 },
+    { 0xFE2E, 0xFE2F, 230 }
+};
+
+/* Return the Canonical_Combining_Class of non-ASCII character ch. */
+static int
+sb_ccc(int ch)
+{
+    int i = 0;
+    int j = sizeof(ccc_ranges) / sizeof(ccc_ranges[0]);
+    if (ch < 0x300 || ch > 0xFFFF) return 0;
+    while (i < j) {
+        int k = i + ((j - i) >> 1);
+        if (ch < ccc_ranges[k].first) {
+            j = k;
+        } else if (ch > ccc_ranges[k].last) {
+            i = k + 1;
+        } else {
+            return ccc_ranges[k].ccc;
+        }
+    }
+    return 0;
+}
+
+/* Lower case a run of ASCII at the start of text, stopping at the first
+ * non-ASCII byte.  Returns the number of bytes processed.
+ */
+static int
+sb_lower_ascii(const sb_symbol * text, int size, sb_symbol * out)
+{
+    int i = 0;
+#if defined SB_HAVE_SSE2
+    const __m128i before_a = _mm_set1_epi8('A' - 1);
+    const __m128i after_z = _mm_set1_epi8('Z' + 1);
+    const __m128i case_bit = _mm_set1_epi8(0x20);
+    for (; i + 16 <= size; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(text + i));
+        __m128i upper;
+        if (_mm_movemask_epi8(v)) break;
+        upper = _mm_and_si128(_mm_cmpgt_epi8(v, before_a),
+                              _mm_cmplt_epi8(v, after_z));
+        v = _mm_or_si128(v, _mm_and_si128(upper, case_bit));
+        _mm_storeu_si128((__m128i *)(out + i), v);
+    }
+#elif defined SB_HAVE_NEON
+    const uint8x16_t a = vdupq_n_u8('A');
+    const uint8x16_t z = vdupq_n_u8('Z');
+    const uint8x16_t case_bit = vdupq_n_u8(0x20);
+    for (; i + 16 <= size; i += 16) {
+        uint8x16_t v = vld1q_u8(text + i);
+        uint8x16_t upper;
+        if (vmaxvq_u8(v) >= 0x80) break;
+        upper = vandq_u8(vcgeq_u8(v, a), vcleq_u8(v, z));
+        v = vorrq_u8(v, vandq_u8(upper, case_bit));
+        vst1q_u8(out + i, v);
+    }
+#endif
+    for (; i < size; i++) {
+        int b = text[i];
+        if (b >= 0x80) break;
+        out[i] = (b >= 'A' && b <= 'Z') ? b + 0x20 : b;
+    }
+    return i;
+}
+
+int
+sb_stemmer_lower_utf8(const sb_symbol * text, int size, sb_symbol * out,
+                      int * nfc)
+{
+    int i = 0;
+    int len = 0;
+    int qc = SB_NFC_YES;
+    /* Canonical combining class of the previous character. */
+    int last_ccc = 0;
+    while (i < size) {
+        int ch;
+        int w;
+        int n = sb_lower_ascii(text + i, size - i, out + len);
+        i += n;
+        len += n;
+        if (i == size) break;
+        if (n) last_ccc = 0;
+        w = sb_get_utf8(text + i, size - i, &ch);
+        if (ch < 0) {
+            /* Invalid UTF-8, which can't be NFC. */
+            qc = SB_NFC_NO;
+            last_ccc = 0;
+            out[len++] = text[i];
+        } else {
+            int ch_qc = sb_nfc_qc(ch);
+            int ccc = sb_ccc(ch);
+            /* Combining characters which aren't in canonical order mean
+             * the text isn't NFC (as in the quick check from UAX #15). */
+            if (ccc != 0 && last_ccc > ccc) ch_qc = SB_NFC_NO;
+            last_ccc = ccc;
+            if (ch_qc > qc) qc = ch_qc;
+            if (ch == 0x2019) {
+                out[len++] = '\'';
+            } else if (sb_tolower(ch) != ch) {
+                len += sb_put_utf8(out + len, sb_tolower(ch));
+            } else {
+                /* Use memmove as out may be the same as text. */
+                memmove(out + len, text + i, w);
+                len += w;
+            }
+        }
+        i += w;
+    }
+    if (nfc) *nfc = qc;
+    return len;
+}
+
+int
+sb_stemmer_stem_utf16(struct sb_stemmer * stemmer,
+                      const sb_utf16 * word, int size,
+                      sb_utf16 * out, int out_size, int * out_len)
+{
+#ifdef SB_HAVE_UTF_16
+    struct SN_env * env = stemmer->env;
+    int len;
+
+    if (stemmer->charset != CHARSET_UTF_16) return -2;
+
+    if (SN_set_current_w(env, size, word)) {
+        env->l = 0;
+        return -1;
+    }
+    if (stemmer->stem(env) < 0) return -1;
+
+    /* env->p points to 16 bit symbols in the UTF-16 stemmers. */
+    len = env->l;
+#ifdef SNOWBALL_STATS
+    stemmer->stats.words++;
+    stemmer->stats.input_symbols += size;
+    stemmer->stats.output_symbols += len;
+    if (len == size && memcmp(env->p, word, size * sizeof(sb_utf16)) == 0)
+        stemmer->stats.unchanged++;
+#endif
+    *out_len = len;
+    if (len > out_size) return 1;
+    memcpy(out, env->p, len * sizeof(sb_utf16));
+    return 0;
+#else
+    (void)stemmer;
+    (void)word;
+    (void)size;
+    (void)out;
+    (void)out_size;
+    (void)out_len;
+    return -2;
+#endif
+}
+
+int
+sb_stemmer_length(struct sb_stemmer * stemmer)
+{
+    return stemmer->env->l;
+}
@@ -77,7 +77,7 @@ EOS
     }
     print OUT "\n";
 
-    for my $enc (qw(ISO_8859_1 ISO_8859_2 KOI8_R)) {
+    for my $enc (qw(ISO_8859_1 ISO_8859_2 KOI8_R UTF_16)) {
         print OUT "\n${enc}_algorithms =";
         foreach $lang (@algorithms) {
             print OUT "\\\n    ", $lang if exists $algorithm_encs{$lang}->{$enc};
@@ -73,6 +73,19 @@ sub readinput()
     }
 }
 
+# 32-bit FNV-1a hash, which must match sb_hash() in libstemmer_c.in.
+sub fnv1a($)
+{
+    my $h = 2166136261;
+    foreach my $c (unpack('C*', shift())) {
+        $h ^= $c;
+        # Multiply by 16777619 (0x01000193) in parts so the intermediate
+        # results can't exceed the precision of perl's numbers.
+        $h = (($h * 0x193) + ((($h & 0xff) << 24))) & 0xffffffff;
+    }
+    return $h;
+}
+
 sub printoutput()
 {
     open (OUT, ">$outname") or die "Can't open output file `$outname': $!\n";
@@ -116,6 +129,27 @@ EOS
         }
     }
 
+    # The stemmers only define the ASCII versions if they were generated with
+    # -ascii (and could be specialised), so default to not having one.
+    print OUT "\n";
+    foreach $lang (@algorithms) {
+        my $hashref = $algorithm_encs{$lang};
+        next unless exists $hashref->{'UTF_8'};
+        print OUT <<EOS;
+#ifndef ${lang}_UTF_8_stem_ascii
+# define ${lang}_UTF_8_stem_ascii 0
+#endif
+EOS
+    }
+
+    if (exists $encs{'UTF_16'}) {
+        print OUT <<EOS;
+
+/* The UTF-16 stemmers use the runtime built for 16 bit symbols. */
+#define SB_HAVE_UTF_16
+EOS
+    }
+
     print OUT <<EOS;
 
 typedef enum {
@@ -144,29 +178,65 @@ EOS
   {0,ENC_UNKNOWN}
 };
 
-struct stemmer_modules {
+struct sb_stemmer_module {
   const char * name;
   stemmer_encoding_t enc;
-  struct SN_env * (*create)(void);
+  struct SN_env * (*create)(const struct SN_allocator *);
   void (*close)(struct SN_env *);
   int (*stem)(struct SN_env *);
+  /* Version of stem specialised for ASCII input (or 0 if none). */
+  int (*stem_ascii)(struct SN_env *);
 };
-static const struct stemmer_modules modules[] = {
+static const struct sb_stemmer_module modules[] = {
 EOS
 
+    my %first_row = ();
+    my $row = 0;
     for $lang (sort keys %aliases) {
         my $l = $aliases{$lang};
         my $hashref = $algorithm_encs{$l};
         my $enc;
+        $first_row{$lang} = $row;
         foreach $enc (sort keys (%$hashref)) {
             my $p = "${l}_${enc}";
-            print OUT "  {\"$lang\", ENC_$enc, ${p}_create_env, ${p}_close_env, ${p}_stem},\n";
+            my $stem_ascii = $enc eq 'UTF_8' ? "${p}_stem_ascii" : "0";
+            print OUT "  {\"$lang\", ENC_$enc, ${p}_create_env_with_allocator, ${p}_close_env, ${p}_stem, $stem_ascii},\n";
+            ++$row;
         }
     }
 
     print OUT <<EOS;
-  {0,ENC_UNKNOWN,0,0,0}
+  {0,ENC_UNKNOWN,0,0,0,0}
 };
+EOS
+
+    # Build an open-addressing hash table (with linear probing) mapping each
+    # name to the first row in modules for that name.  The rows for the
+    # different encodings of a name are consecutive.  The table is at most
+    # half full, so lookups typically only need to compare one name.
+    my $hash_size = 1;
+    $hash_size <<= 1 while $hash_size < 2 * scalar(keys %first_row);
+    my @hash_table = (-1) x $hash_size;
+    for $lang (sort keys %first_row) {
+        my $i = fnv1a($lang) & ($hash_size - 1);
+        $i = ($i + 1) & ($hash_size - 1) while $hash_table[$i] >= 0;
+        $hash_table[$i] = $first_row{$lang};
+    }
+    print OUT <<EOS;
+
+/* Hash table of indices into modules (-1 for an empty slot), indexed by an
+ * FNV-1a hash of the name with linear probing.
+ */
+#define MODULE_HASH_SIZE $hash_size
+static const short module_hash[MODULE_HASH_SIZE] = {
+EOS
+    for (my $i = 0; $i < $hash_size; $i += 8) {
+        my $end = $i + 8 < $hash_size ? $i + 8 : $hash_size;
+        print OUT "  ", join(", ", @hash_table[$i .. $end - 1]), ",\n";
+    }
+    print OUT <<EOS;
+};
+
 EOS
 
     print OUT <<EOS;
@@ -229,9 +299,11 @@ EOS
         }
     }
 
+    my @runtime_sources = ('runtime/api.c', 'runtime/utilities.c');
+    push @runtime_sources, 'runtime/api_w.c', 'runtime/utilities_w.c'
+        if exists $encs{'UTF_16'};
     $need_sep = 0;
-    for $srcfile ('runtime/api.c',
-                  'runtime/utilities.c',
+    for $srcfile (@runtime_sources,
                   "libstemmer/libstemmer${extn}.c") {
         print OUT " \\\n" if $need_sep;
         print OUT "  $srcfile";
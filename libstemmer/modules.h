@@ -0,0 +1,596 @@
+/* libstemmer/modules.h: List of stemming modules.
+ *
+ * This file is generated by mkmodules.pl from a list of module names.
+ * Do not edit manually.
+ *
+ * Modules included by this file are: arabic, armenian, basque, catalan,
+ * danish, dutch, dutch_porter, english, esperanto, estonian, finnish, french,
+ * german, greek, hindi, hungarian, indonesian, irish, italian, lithuanian,
+ * nepali, norwegian, persian, polish, porter, portuguese, romanian, russian,
+ * serbian, spanish, swedish, tamil, turkish, yiddish
+ */
+
+#include "../src_c/stem_UTF_16_arabic.h"
+#include "../src_c/stem_UTF_8_arabic.h"
+#include "../src_c/stem_UTF_16_armenian.h"
+#include "../src_c/stem_UTF_8_armenian.h"
+#include "../src_c/stem_ISO_8859_1_basque.h"
+#include "../src_c/stem_UTF_16_basque.h"
+#include "../src_c/stem_UTF_8_basque.h"
+#include "../src_c/stem_ISO_8859_1_catalan.h"
+#include "../src_c/stem_UTF_16_catalan.h"
+#include "../src_c/stem_UTF_8_catalan.h"
+#include "../src_c/stem_ISO_8859_1_danish.h"
+#include "../src_c/stem_UTF_16_danish.h"
+#include "../src_c/stem_UTF_8_danish.h"
+#include "../src_c/stem_ISO_8859_1_dutch.h"
+#include "../src_c/stem_UTF_16_dutch.h"
+#include "../src_c/stem_UTF_8_dutch.h"
+#include "../src_c/stem_ISO_8859_1_dutch_porter.h"
+#include "../src_c/stem_UTF_16_dutch_porter.h"
+#include "../src_c/stem_UTF_8_dutch_porter.h"
+#include "../src_c/stem_ISO_8859_1_english.h"
+#include "../src_c/stem_UTF_16_english.h"
+#include "../src_c/stem_UTF_8_english.h"
+#include "../src_c/stem_UTF_16_esperanto.h"
+#include "../src_c/stem_UTF_8_esperanto.h"
+#include "../src_c/stem_UTF_16_estonian.h"
+#include "../src_c/stem_UTF_8_estonian.h"
+#include "../src_c/stem_ISO_8859_1_finnish.h"
+#include "../src_c/stem_UTF_16_finnish.h"
+#include "../src_c/stem_UTF_8_finnish.h"
+#include "../src_c/stem_ISO_8859_1_french.h"
+#include "../src_c/stem_UTF_16_french.h"
+#include "../src_c/stem_UTF_8_french.h"
+#include "../src_c/stem_ISO_8859_1_german.h"
+#include "../src_c/stem_UTF_16_german.h"
+#include "../src_c/stem_UTF_8_german.h"
+#include "../src_c/stem_UTF_16_greek.h"
+#include "../src_c/stem_UTF_8_greek.h"
+#include "../src_c/stem_UTF_16_hindi.h"
+#include "../src_c/stem_UTF_8_hindi.h"
+#include "../src_c/stem_ISO_8859_2_hungarian.h"
+#include "../src_c/stem_UTF_16_hungarian.h"
+#include "../src_c/stem_UTF_8_hungarian.h"
+#include "../src_c/stem_ISO_8859_1_indonesian.h"
+#include "../src_c/stem_UTF_16_indonesian.h"
+#include "../src_c/stem_UTF_8_indonesian.h"
+#include "../src_c/stem_ISO_8859_1_irish.h"
+#include "../src_c/stem_UTF_16_irish.h"
+#include "../src_c/stem_UTF_8_irish.h"
+#include "../src_c/stem_ISO_8859_1_italian.h"
+#include "../src_c/stem_UTF_16_italian.h"
+#include "../src_c/stem_UTF_8_italian.h"
+#include "../src_c/stem_UTF_16_lithuanian.h"
+#include "../src_c/stem_UTF_8_lithuanian.h"
+#include "../src_c/stem_UTF_16_nepali.h"
+#include "../src_c/stem_UTF_8_nepali.h"
+#include "../src_c/stem_ISO_8859_1_norwegian.h"
+#include "../src_c/stem_UTF_16_norwegian.h"
+#include "../src_c/stem_UTF_8_norwegian.h"
+#include "../src_c/stem_UTF_16_persian.h"
+#include "../src_c/stem_UTF_8_persian.h"
+#include "../src_c/stem_ISO_8859_2_polish.h"
+#include "../src_c/stem_UTF_16_polish.h"
+#include "../src_c/stem_UTF_8_polish.h"
+#include "../src_c/stem_ISO_8859_1_porter.h"
+#include "../src_c/stem_UTF_16_porter.h"
+#include "../src_c/stem_UTF_8_porter.h"
+#include "../src_c/stem_ISO_8859_1_portuguese.h"
+#include "../src_c/stem_UTF_16_portuguese.h"
+#include "../src_c/stem_UTF_8_portuguese.h"
+#include "../src_c/stem_UTF_16_romanian.h"
+#include "../src_c/stem_UTF_8_romanian.h"
+#include "../src_c/stem_KOI8_R_russian.h"
+#include "../src_c/stem_UTF_16_russian.h"
+#include "../src_c/stem_UTF_8_russian.h"
+#include "../src_c/stem_UTF_16_serbian.h"
+#include "../src_c/stem_UTF_8_serbian.h"
+#include "../src_c/stem_ISO_8859_1_spanish.h"
+#include "../src_c/stem_UTF_16_spanish.h"
+#include "../src_c/stem_UTF_8_spanish.h"
+#include "../src_c/stem_ISO_8859_1_swedish.h"
+#include "../src_c/stem_UTF_16_swedish.h"
+#include "../src_c/stem_UTF_8_swedish.h"
+#include "../src_c/stem_UTF_16_tamil.h"
+#include "../src_c/stem_UTF_8_tamil.h"
+#include "../src_c/stem_UTF_16_turkish.h"
+#include "../src_c/stem_UTF_8_turkish.h"
+#include "../src_c/stem_UTF_16_yiddish.h"
+#include "../src_c/stem_UTF_8_yiddish.h"
+
+#ifndef arabic_UTF_8_stem_ascii
+# define arabic_UTF_8_stem_ascii 0
+#endif
+#ifndef armenian_UTF_8_stem_ascii
+# define armenian_UTF_8_stem_ascii 0
+#endif
+#ifndef basque_UTF_8_stem_ascii
+# define basque_UTF_8_stem_ascii 0
+#endif
+#ifndef catalan_UTF_8_stem_ascii
+# define catalan_UTF_8_stem_ascii 0
+#endif
+#ifndef danish_UTF_8_stem_ascii
+# define danish_UTF_8_stem_ascii 0
+#endif
+#ifndef dutch_UTF_8_stem_ascii
+# define dutch_UTF_8_stem_ascii 0
+#endif
+#ifndef dutch_porter_UTF_8_stem_ascii
+# define dutch_porter_UTF_8_stem_ascii 0
+#endif
+#ifndef english_UTF_8_stem_ascii
+# define english_UTF_8_stem_ascii 0
+#endif
+#ifndef esperanto_UTF_8_stem_ascii
+# define esperanto_UTF_8_stem_ascii 0
+#endif
+#ifndef estonian_UTF_8_stem_ascii
+# define estonian_UTF_8_stem_ascii 0
+#endif
+#ifndef finnish_UTF_8_stem_ascii
+# define finnish_UTF_8_stem_ascii 0
+#endif
+#ifndef french_UTF_8_stem_ascii
+# define french_UTF_8_stem_ascii 0
+#endif
+#ifndef german_UTF_8_stem_ascii
+# define german_UTF_8_stem_ascii 0
+#endif
+#ifndef greek_UTF_8_stem_ascii
+# define greek_UTF_8_stem_ascii 0
+#endif
+#ifndef hindi_UTF_8_stem_ascii
+# define hindi_UTF_8_stem_ascii 0
+#endif
+#ifndef hungarian_UTF_8_stem_ascii
+# define hungarian_UTF_8_stem_ascii 0
+#endif
+#ifndef indonesian_UTF_8_stem_ascii
+# define indonesian_UTF_8_stem_ascii 0
+#endif
+#ifndef irish_UTF_8_stem_ascii
+# define irish_UTF_8_stem_ascii 0
+#endif
+#ifndef italian_UTF_8_stem_ascii
+# define italian_UTF_8_stem_ascii 0
+#endif
+#ifndef lithuanian_UTF_8_stem_ascii
+# define lithuanian_UTF_8_stem_ascii 0
+#endif
+#ifndef nepali_UTF_8_stem_ascii
+# define nepali_UTF_8_stem_ascii 0
+#endif
+#ifndef norwegian_UTF_8_stem_ascii
+# define norwegian_UTF_8_stem_ascii 0
+#endif
+#ifndef persian_UTF_8_stem_ascii
+# define persian_UTF_8_stem_ascii 0
+#endif
+#ifndef polish_UTF_8_stem_ascii
+# define polish_UTF_8_stem_ascii 0
+#endif
+#ifndef porter_UTF_8_stem_ascii
+# define porter_UTF_8_stem_ascii 0
+#endif
+#ifndef portuguese_UTF_8_stem_ascii
+# define portuguese_UTF_8_stem_ascii 0
+#endif
+#ifndef romanian_UTF_8_stem_ascii
+# define romanian_UTF_8_stem_ascii 0
+#endif
+#ifndef russian_UTF_8_stem_ascii
+# define russian_UTF_8_stem_ascii 0
+#endif
+#ifndef serbian_UTF_8_stem_ascii
+# define serbian_UTF_8_stem_ascii 0
+#endif
+#ifndef spanish_UTF_8_stem_ascii
+# define spanish_UTF_8_stem_ascii 0
+#endif
+#ifndef swedish_UTF_8_stem_ascii
+# define swedish_UTF_8_stem_ascii 0
+#endif
+#ifndef tamil_UTF_8_stem_ascii
+# define tamil_UTF_8_stem_ascii 0
+#endif
+#ifndef turkish_UTF_8_stem_ascii
+# define turkish_UTF_8_stem_ascii 0
+#endif
+#ifndef yiddish_UTF_8_stem_ascii
+# define yiddish_UTF_8_stem_ascii 0
+#endif
+
+/* The UTF-16 stemmers use the runtime built for 16 bit symbols. */
+#define SB_HAVE_UTF_16
+
+typedef enum {
+  ENC_UNKNOWN=0,
+  ENC_ISO_8859_1,
+  ENC_ISO_8859_2,
+  ENC_KOI8_R,
+  ENC_UTF_16,
+  ENC_UTF_8
+} stemmer_encoding_t;
+
+struct stemmer_encoding {
+  const char * name;
+  stemmer_encoding_t enc;
+};
+static const struct stemmer_encoding encodings[] = {
+  {"ISO_8859_1", ENC_ISO_8859_1},
+  {"ISO_8859_2", ENC_ISO_8859_2},
+  {"KOI8_R", ENC_KOI8_R},
+  {"UTF_16", ENC_UTF_16},
+  {"UTF_8", ENC_UTF_8},
+  {0,ENC_UNKNOWN}
+};
+
+struct sb_stemmer_module {
+  const char * name;
+  stemmer_encoding_t enc;
+  struct SN_env * (*create)(const struct SN_allocator *);
+  void (*close)(struct SN_env *);
+  int (*stem)(struct SN_env *);
+  /* Version of stem specialised for ASCII input (or 0 if none). */
+  int (*stem_ascii)(struct SN_env *);
+};
+static const struct sb_stemmer_module modules[] = {
+  {"ar", ENC_UTF_16, arabic_UTF_16_create_env_with_allocator, arabic_UTF_16_close_env, arabic_UTF_16_stem, 0},
+  {"ar", ENC_UTF_8, arabic_UTF_8_create_env_with_allocator, arabic_UTF_8_close_env, arabic_UTF_8_stem, arabic_UTF_8_stem_ascii},
+  {"ara", ENC_UTF_16, arabic_UTF_16_create_env_with_allocator, arabic_UTF_16_close_env, arabic_UTF_16_stem, 0},
+  {"ara", ENC_UTF_8, arabic_UTF_8_create_env_with_allocator, arabic_UTF_8_close_env, arabic_UTF_8_stem, arabic_UTF_8_stem_ascii},
+  {"arabic", ENC_UTF_16, arabic_UTF_16_create_env_with_allocator, arabic_UTF_16_close_env, arabic_UTF_16_stem, 0},
+  {"arabic", ENC_UTF_8, arabic_UTF_8_create_env_with_allocator, arabic_UTF_8_close_env, arabic_UTF_8_stem, arabic_UTF_8_stem_ascii},
+  {"arm", ENC_UTF_16, armenian_UTF_16_create_env_with_allocator, armenian_UTF_16_close_env, armenian_UTF_16_stem, 0},
+  {"arm", ENC_UTF_8, armenian_UTF_8_create_env_with_allocator, armenian_UTF_8_close_env, armenian_UTF_8_stem, armenian_UTF_8_stem_ascii},
+  {"armenian", ENC_UTF_16, armenian_UTF_16_create_env_with_allocator, armenian_UTF_16_close_env, armenian_UTF_16_stem, 0},
+  {"armenian", ENC_UTF_8, armenian_UTF_8_create_env_with_allocator, armenian_UTF_8_close_env, armenian_UTF_8_stem, armenian_UTF_8_stem_ascii},
+  {"baq", ENC_ISO_8859_1, basque_ISO_8859_1_create_env_with_allocator, basque_ISO_8859_1_close_env, basque_ISO_8859_1_stem, 0},
+  {"baq", ENC_UTF_16, basque_UTF_16_create_env_with_allocator, basque_UTF_16_close_env, basque_UTF_16_stem, 0},
+  {"baq", ENC_UTF_8, basque_UTF_8_create_env_with_allocator, basque_UTF_8_close_env, basque_UTF_8_stem, basque_UTF_8_stem_ascii},
+  {"basque", ENC_ISO_8859_1, basque_ISO_8859_1_create_env_with_allocator, basque_ISO_8859_1_close_env, basque_ISO_8859_1_stem, 0},
+  {"basque", ENC_UTF_16, basque_UTF_16_create_env_with_allocator, basque_UTF_16_close_env, basque_UTF_16_stem, 0},
+  {"basque", ENC_UTF_8, basque_UTF_8_create_env_with_allocator, basque_UTF_8_close_env, basque_UTF_8_stem, basque_UTF_8_stem_ascii},
+  {"ca", ENC_ISO_8859_1, catalan_ISO_8859_1_create_env_with_allocator, catalan_ISO_8859_1_close_env, catalan_ISO_8859_1_stem, 0},
+  {"ca", ENC_UTF_16, catalan_UTF_16_create_env_with_allocator, catalan_UTF_16_close_env, catalan_UTF_16_stem, 0},
+  {"ca", ENC_UTF_8, catalan_UTF_8_create_env_with_allocator, catalan_UTF_8_close_env, catalan_UTF_8_stem, catalan_UTF_8_stem_ascii},
+  {"cat", ENC_ISO_8859_1, catalan_ISO_8859_1_create_env_with_allocator, catalan_ISO_8859_1_close_env, catalan_ISO_8859_1_stem, 0},
+  {"cat", ENC_UTF_16, catalan_UTF_16_create_env_with_allocator, catalan_UTF_16_close_env, catalan_UTF_16_stem, 0},
+  {"cat", ENC_UTF_8, catalan_UTF_8_create_env_with_allocator, catalan_UTF_8_close_env, catalan_UTF_8_stem, catalan_UTF_8_stem_ascii},
+  {"catalan", ENC_ISO_8859_1, catalan_ISO_8859_1_create_env_with_allocator, catalan_ISO_8859_1_close_env, catalan_ISO_8859_1_stem, 0},
+  {"catalan", ENC_UTF_16, catalan_UTF_16_create_env_with_allocator, catalan_UTF_16_close_env, catalan_UTF_16_stem, 0},
+  {"catalan", ENC_UTF_8, catalan_UTF_8_create_env_with_allocator, catalan_UTF_8_close_env, catalan_UTF_8_stem, catalan_UTF_8_stem_ascii},
+  {"da", ENC_ISO_8859_1, danish_ISO_8859_1_create_env_with_allocator, danish_ISO_8859_1_close_env, danish_ISO_8859_1_stem, 0},
+  {"da", ENC_UTF_16, danish_UTF_16_create_env_with_allocator, danish_UTF_16_close_env, danish_UTF_16_stem, 0},
+  {"da", ENC_UTF_8, danish_UTF_8_create_env_with_allocator, danish_UTF_8_close_env, danish_UTF_8_stem, danish_UTF_8_stem_ascii},
+  {"dan", ENC_ISO_8859_1, danish_ISO_8859_1_create_env_with_allocator, danish_ISO_8859_1_close_env, danish_ISO_8859_1_stem, 0},
+  {"dan", ENC_UTF_16, danish_UTF_16_create_env_with_allocator, danish_UTF_16_close_env, danish_UTF_16_stem, 0},
+  {"dan", ENC_UTF_8, danish_UTF_8_create_env_with_allocator, danish_UTF_8_close_env, danish_UTF_8_stem, danish_UTF_8_stem_ascii},
+  {"danish", ENC_ISO_8859_1, danish_ISO_8859_1_create_env_with_allocator, danish_ISO_8859_1_close_env, danish_ISO_8859_1_stem, 0},
+  {"danish", ENC_UTF_16, danish_UTF_16_create_env_with_allocator, danish_UTF_16_close_env, danish_UTF_16_stem, 0},
+  {"danish", ENC_UTF_8, danish_UTF_8_create_env_with_allocator, danish_UTF_8_close_env, danish_UTF_8_stem, danish_UTF_8_stem_ascii},
+  {"de", ENC_ISO_8859_1, german_ISO_8859_1_create_env_with_allocator, german_ISO_8859_1_close_env, german_ISO_8859_1_stem, 0},
+  {"de", ENC_UTF_16, german_UTF_16_create_env_with_allocator, german_UTF_16_close_env, german_UTF_16_stem, 0},
+  {"de", ENC_UTF_8, german_UTF_8_create_env_with_allocator, german_UTF_8_close_env, german_UTF_8_stem, german_UTF_8_stem_ascii},
+  {"deu", ENC_ISO_8859_1, german_ISO_8859_1_create_env_with_allocator, german_ISO_8859_1_close_env, german_ISO_8859_1_stem, 0},
+  {"deu", ENC_UTF_16, german_UTF_16_create_env_with_allocator, german_UTF_16_close_env, german_UTF_16_stem, 0},
+  {"deu", ENC_UTF_8, german_UTF_8_create_env_with_allocator, german_UTF_8_close_env, german_UTF_8_stem, german_UTF_8_stem_ascii},
+  {"dut", ENC_ISO_8859_1, dutch_ISO_8859_1_create_env_with_allocator, dutch_ISO_8859_1_close_env, dutch_ISO_8859_1_stem, 0},
+  {"dut", ENC_UTF_16, dutch_UTF_16_create_env_with_allocator, dutch_UTF_16_close_env, dutch_UTF_16_stem, 0},
+  {"dut", ENC_UTF_8, dutch_UTF_8_create_env_with_allocator, dutch_UTF_8_close_env, dutch_UTF_8_stem, dutch_UTF_8_stem_ascii},
+  {"dutch", ENC_ISO_8859_1, dutch_ISO_8859_1_create_env_with_allocator, dutch_ISO_8859_1_close_env, dutch_ISO_8859_1_stem, 0},
+  {"dutch", ENC_UTF_16, dutch_UTF_16_create_env_with_allocator, dutch_UTF_16_close_env, dutch_UTF_16_stem, 0},
+  {"dutch", ENC_UTF_8, dutch_UTF_8_create_env_with_allocator, dutch_UTF_8_close_env, dutch_UTF_8_stem, dutch_UTF_8_stem_ascii},
+  {"dutch_porter", ENC_ISO_8859_1, dutch_porter_ISO_8859_1_create_env_with_allocator, dutch_porter_ISO_8859_1_close_env, dutch_porter_ISO_8859_1_stem, 0},
+  {"dutch_porter", ENC_UTF_16, dutch_porter_UTF_16_create_env_with_allocator, dutch_porter_UTF_16_close_env, dutch_porter_UTF_16_stem, 0},
+  {"dutch_porter", ENC_UTF_8, dutch_porter_UTF_8_create_env_with_allocator, dutch_porter_UTF_8_close_env, dutch_porter_UTF_8_stem, dutch_porter_UTF_8_stem_ascii},
+  {"el", ENC_UTF_16, greek_UTF_16_create_env_with_allocator, greek_UTF_16_close_env, greek_UTF_16_stem, 0},
+  {"el", ENC_UTF_8, greek_UTF_8_create_env_with_allocator, greek_UTF_8_close_env, greek_UTF_8_stem, greek_UTF_8_stem_ascii},
+  {"ell", ENC_UTF_16, greek_UTF_16_create_env_with_allocator, greek_UTF_16_close_env, greek_UTF_16_stem, 0},
+  {"ell", ENC_UTF_8, greek_UTF_8_create_env_with_allocator, greek_UTF_8_close_env, greek_UTF_8_stem, greek_UTF_8_stem_ascii},
+  {"en", ENC_ISO_8859_1, english_ISO_8859_1_create_env_with_allocator, english_ISO_8859_1_close_env, english_ISO_8859_1_stem, 0},
+  {"en", ENC_UTF_16, english_UTF_16_create_env_with_allocator, english_UTF_16_close_env, english_UTF_16_stem, 0},
+  {"en", ENC_UTF_8, english_UTF_8_create_env_with_allocator, english_UTF_8_close_env, english_UTF_8_stem, english_UTF_8_stem_ascii},
+  {"eng", ENC_ISO_8859_1, english_ISO_8859_1_create_env_with_allocator, english_ISO_8859_1_close_env, english_ISO_8859_1_stem, 0},
+  {"eng", ENC_UTF_16, english_UTF_16_create_env_with_allocator, english_UTF_16_close_env, english_UTF_16_stem, 0},
+  {"eng", ENC_UTF_8, english_UTF_8_create_env_with_allocator, english_UTF_8_close_env, english_UTF_8_stem, english_UTF_8_stem_ascii},
+  {"english", ENC_ISO_8859_1, english_ISO_8859_1_create_env_with_allocator, english_ISO_8859_1_close_env, english_ISO_8859_1_stem, 0},
+  {"english", ENC_UTF_16, english_UTF_16_create_env_with_allocator, english_UTF_16_close_env, english_UTF_16_stem, 0},
+  {"english", ENC_UTF_8, english_UTF_8_create_env_with_allocator, english_UTF_8_close_env, english_UTF_8_stem, english_UTF_8_stem_ascii},
+  {"eo", ENC_UTF_16, esperanto_UTF_16_create_env_with_allocator, esperanto_UTF_16_close_env, esperanto_UTF_16_stem, 0},
+  {"eo", ENC_UTF_8, esperanto_UTF_8_create_env_with_allocator, esperanto_UTF_8_close_env, esperanto_UTF_8_stem, esperanto_UTF_8_stem_ascii},
+  {"epo", ENC_UTF_16, esperanto_UTF_16_create_env_with_allocator, esperanto_UTF_16_close_env, esperanto_UTF_16_stem, 0},
+  {"epo", ENC_UTF_8, esperanto_UTF_8_create_env_with_allocator, esperanto_UTF_8_close_env, esperanto_UTF_8_stem, esperanto_UTF_8_stem_ascii},
+  {"es", ENC_ISO_8859_1, spanish_ISO_8859_1_create_env_with_allocator, spanish_ISO_8859_1_close_env, spanish_ISO_8859_1_stem, 0},
+  {"es", ENC_UTF_16, spanish_UTF_16_create_env_with_allocator, spanish_UTF_16_close_env, spanish_UTF_16_stem, 0},
+  {"es", ENC_UTF_8, spanish_UTF_8_create_env_with_allocator, spanish_UTF_8_close_env, spanish_UTF_8_stem, spanish_UTF_8_stem_ascii},
+  {"esl", ENC_ISO_8859_1, spanish_ISO_8859_1_create_env_with_allocator, spanish_ISO_8859_1_close_env, spanish_ISO_8859_1_stem, 0},
+  {"esl", ENC_UTF_16, spanish_UTF_16_create_env_with_allocator, spanish_UTF_16_close_env, spanish_UTF_16_stem, 0},
+  {"esl", ENC_UTF_8, spanish_UTF_8_create_env_with_allocator, spanish_UTF_8_close_env, spanish_UTF_8_stem, spanish_UTF_8_stem_ascii},
+  {"esperanto", ENC_UTF_16, esperanto_UTF_16_create_env_with_allocator, esperanto_UTF_16_close_env, esperanto_UTF_16_stem, 0},
+  {"esperanto", ENC_UTF_8, esperanto_UTF_8_create_env_with_allocator, esperanto_UTF_8_close_env, esperanto_UTF_8_stem, esperanto_UTF_8_stem_ascii},
+  {"est", ENC_UTF_16, estonian_UTF_16_create_env_with_allocator, estonian_UTF_16_close_env, estonian_UTF_16_stem, 0},
+  {"est", ENC_UTF_8, estonian_UTF_8_create_env_with_allocator, estonian_UTF_8_close_env, estonian_UTF_8_stem, estonian_UTF_8_stem_ascii},
+  {"estonian", ENC_UTF_16, estonian_UTF_16_create_env_with_allocator, estonian_UTF_16_close_env, estonian_UTF_16_stem, 0},
+  {"estonian", ENC_UTF_8, estonian_UTF_8_create_env_with_allocator, estonian_UTF_8_close_env, estonian_UTF_8_stem, estonian_UTF_8_stem_ascii},
+  {"et", ENC_UTF_16, estonian_UTF_16_create_env_with_allocator, estonian_UTF_16_close_env, estonian_UTF_16_stem, 0},
+  {"et", ENC_UTF_8, estonian_UTF_8_create_env_with_allocator, estonian_UTF_8_close_env, estonian_UTF_8_stem, estonian_UTF_8_stem_ascii},
+  {"eu", ENC_ISO_8859_1, basque_ISO_8859_1_create_env_with_allocator, basque_ISO_8859_1_close_env, basque_ISO_8859_1_stem, 0},
+  {"eu", ENC_UTF_16, basque_UTF_16_create_env_with_allocator, basque_UTF_16_close_env, basque_UTF_16_stem, 0},
+  {"eu", ENC_UTF_8, basque_UTF_8_create_env_with_allocator, basque_UTF_8_close_env, basque_UTF_8_stem, basque_UTF_8_stem_ascii},
+  {"eus", ENC_ISO_8859_1, basque_ISO_8859_1_create_env_with_allocator, basque_ISO_8859_1_close_env, basque_ISO_8859_1_stem, 0},
+  {"eus", ENC_UTF_16, basque_UTF_16_create_env_with_allocator, basque_UTF_16_close_env, basque_UTF_16_stem, 0},
+  {"eus", ENC_UTF_8, basque_UTF_8_create_env_with_allocator, basque_UTF_8_close_env, basque_UTF_8_stem, basque_UTF_8_stem_ascii},
+  {"fa", ENC_UTF_16, persian_UTF_16_create_env_with_allocator, persian_UTF_16_close_env, persian_UTF_16_stem, 0},
+  {"fa", ENC_UTF_8, persian_UTF_8_create_env_with_allocator, persian_UTF_8_close_env, persian_UTF_8_stem, persian_UTF_8_stem_ascii},
+  {"fas", ENC_UTF_16, persian_UTF_16_create_env_with_allocator, persian_UTF_16_close_env, persian_UTF_16_stem, 0},
+  {"fas", ENC_UTF_8, persian_UTF_8_create_env_with_allocator, persian_UTF_8_close_env, persian_UTF_8_stem, persian_UTF_8_stem_ascii},
+  {"fi", ENC_ISO_8859_1, finnish_ISO_8859_1_create_env_with_allocator, finnish_ISO_8859_1_close_env, finnish_ISO_8859_1_stem, 0},
+  {"fi", ENC_UTF_16, finnish_UTF_16_create_env_with_allocator, finnish_UTF_16_close_env, finnish_UTF_16_stem, 0},
+  {"fi", ENC_UTF_8, finnish_UTF_8_create_env_with_allocator, finnish_UTF_8_close_env, finnish_UTF_8_stem, finnish_UTF_8_stem_ascii},
+  {"fin", ENC_ISO_8859_1, finnish_ISO_8859_1_create_env_with_allocator, finnish_ISO_8859_1_close_env, finnish_ISO_8859_1_stem, 0},
+  {"fin", ENC_UTF_16, finnish_UTF_16_create_env_with_allocator, finnish_UTF_16_close_env, finnish_UTF_16_stem, 0},
+  {"fin", ENC_UTF_8, finnish_UTF_8_create_env_with_allocator, finnish_UTF_8_close_env, finnish_UTF_8_stem, finnish_UTF_8_stem_ascii},
+  {"finnish", ENC_ISO_8859_1, finnish_ISO_8859_1_create_env_with_allocator, finnish_ISO_8859_1_close_env, finnish_ISO_8859_1_stem, 0},
+  {"finnish", ENC_UTF_16, finnish_UTF_16_create_env_with_allocator, finnish_UTF_16_close_env, finnish_UTF_16_stem, 0},
+  {"finnish", ENC_UTF_8, finnish_UTF_8_create_env_with_allocator, finnish_UTF_8_close_env, finnish_UTF_8_stem, finnish_UTF_8_stem_ascii},
+  {"fr", ENC_ISO_8859_1, french_ISO_8859_1_create_env_with_allocator, french_ISO_8859_1_close_env, french_ISO_8859_1_stem, 0},
+  {"fr", ENC_UTF_16, french_UTF_16_create_env_with_allocator, french_UTF_16_close_env, french_UTF_16_stem, 0},
+  {"fr", ENC_UTF_8, french_UTF_8_create_env_with_allocator, french_UTF_8_close_env, french_UTF_8_stem, french_UTF_8_stem_ascii},
+  {"fra", ENC_ISO_8859_1, french_ISO_8859_1_create_env_with_allocator, french_ISO_8859_1_close_env, french_ISO_8859_1_stem, 0},
+  {"fra", ENC_UTF_16, french_UTF_16_create_env_with_allocator, french_UTF_16_close_env, french_UTF_16_stem, 0},
+  {"fra", ENC_UTF_8, french_UTF_8_create_env_with_allocator, french_UTF_8_close_env, french_UTF_8_stem, french_UTF_8_stem_ascii},
+  {"fre", ENC_ISO_8859_1, french_ISO_8859_1_create_env_with_allocator, french_ISO_8859_1_close_env, french_ISO_8859_1_stem, 0},
+  {"fre", ENC_UTF_16, french_UTF_16_create_env_with_allocator, french_UTF_16_close_env, french_UTF_16_stem, 0},
+  {"fre", ENC_UTF_8, french_UTF_8_create_env_with_allocator, french_UTF_8_close_env, french_UTF_8_stem, french_UTF_8_stem_ascii},
+  {"french", ENC_ISO_8859_1, french_ISO_8859_1_create_env_with_allocator, french_ISO_8859_1_close_env, french_ISO_8859_1_stem, 0},
+  {"french", ENC_UTF_16, french_UTF_16_create_env_with_allocator, french_UTF_16_close_env, french_UTF_16_stem, 0},
+  {"french", ENC_UTF_8, french_UTF_8_create_env_with_allocator, french_UTF_8_close_env, french_UTF_8_stem, french_UTF_8_stem_ascii},
+  {"ga", ENC_ISO_8859_1, irish_ISO_8859_1_create_env_with_allocator, irish_ISO_8859_1_close_env, irish_ISO_8859_1_stem, 0},
+  {"ga", ENC_UTF_16, irish_UTF_16_create_env_with_allocator, irish_UTF_16_close_env, irish_UTF_16_stem, 0},
+  {"ga", ENC_UTF_8, irish_UTF_8_create_env_with_allocator, irish_UTF_8_close_env, irish_UTF_8_stem, irish_UTF_8_stem_ascii},
+  {"ger", ENC_ISO_8859_1, german_ISO_8859_1_create_env_with_allocator, german_ISO_8859_1_close_env, german_ISO_8859_1_stem, 0},
+  {"ger", ENC_UTF_16, german_UTF_16_create_env_with_allocator, german_UTF_16_close_env, german_UTF_16_stem, 0},
+  {"ger", ENC_UTF_8, german_UTF_8_create_env_with_allocator, german_UTF_8_close_env, german_UTF_8_stem, german_UTF_8_stem_ascii},
+  {"german", ENC_ISO_8859_1, german_ISO_8859_1_create_env_with_allocator, german_ISO_8859_1_close_env, german_ISO_8859_1_stem, 0},
+  {"german", ENC_UTF_16, german_UTF_16_create_env_with_allocator, german_UTF_16_close_env, german_UTF_16_stem, 0},
+  {"german", ENC_UTF_8, german_UTF_8_create_env_with_allocator, german_UTF_8_close_env, german_UTF_8_stem, german_UTF_8_stem_ascii},
+  {"gle", ENC_ISO_8859_1, irish_ISO_8859_1_create_env_with_allocator, irish_ISO_8859_1_close_env, irish_ISO_8859_1_stem, 0},
+  {"gle", ENC_UTF_16, irish_UTF_16_create_env_with_allocator, irish_UTF_16_close_env, irish_UTF_16_stem, 0},
+  {"gle", ENC_UTF_8, irish_UTF_8_create_env_with_allocator, irish_UTF_8_close_env, irish_UTF_8_stem, irish_UTF_8_stem_ascii},
+  {"gre", ENC_UTF_16, greek_UTF_16_create_env_with_allocator, greek_UTF_16_close_env, greek_UTF_16_stem, 0},
+  {"gre", ENC_UTF_8, greek_UTF_8_create_env_with_allocator, greek_UTF_8_close_env, greek_UTF_8_stem, greek_UTF_8_stem_ascii},
+  {"greek", ENC_UTF_16, greek_UTF_16_create_env_with_allocator, greek_UTF_16_close_env, greek_UTF_16_stem, 0},
+  {"greek", ENC_UTF_8, greek_UTF_8_create_env_with_allocator, greek_UTF_8_close_env, greek_UTF_8_stem, greek_UTF_8_stem_ascii},
+  {"hi", ENC_UTF_16, hindi_UTF_16_create_env_with_allocator, hindi_UTF_16_close_env, hindi_UTF_16_stem, 0},
+  {"hi", ENC_UTF_8, hindi_UTF_8_create_env_with_allocator, hindi_UTF_8_close_env, hindi_UTF_8_stem, hindi_UTF_8_stem_ascii},
+  {"hin", ENC_UTF_16, hindi_UTF_16_create_env_with_allocator, hindi_UTF_16_close_env, hindi_UTF_16_stem, 0},
+  {"hin", ENC_UTF_8, hindi_UTF_8_create_env_with_allocator, hindi_UTF_8_close_env, hindi_UTF_8_stem, hindi_UTF_8_stem_ascii},
+  {"hindi", ENC_UTF_16, hindi_UTF_16_create_env_with_allocator, hindi_UTF_16_close_env, hindi_UTF_16_stem, 0},
+  {"hindi", ENC_UTF_8, hindi_UTF_8_create_env_with_allocator, hindi_UTF_8_close_env, hindi_UTF_8_stem, hindi_UTF_8_stem_ascii},
+  {"hu", ENC_ISO_8859_2, hungarian_ISO_8859_2_create_env_with_allocator, hungarian_ISO_8859_2_close_env, hungarian_ISO_8859_2_stem, 0},
+  {"hu", ENC_UTF_16, hungarian_UTF_16_create_env_with_allocator, hungarian_UTF_16_close_env, hungarian_UTF_16_stem, 0},
+  {"hu", ENC_UTF_8, hungarian_UTF_8_create_env_with_allocator, hungarian_UTF_8_close_env, hungarian_UTF_8_stem, hungarian_UTF_8_stem_ascii},
+  {"hun", ENC_ISO_8859_2, hungarian_ISO_8859_2_create_env_with_allocator, hungarian_ISO_8859_2_close_env, hungarian_ISO_8859_2_stem, 0},
+  {"hun", ENC_UTF_16, hungarian_UTF_16_create_env_with_allocator, hungarian_UTF_16_close_env, hungarian_UTF_16_stem, 0},
+  {"hun", ENC_UTF_8, hungarian_UTF_8_create_env_with_allocator, hungarian_UTF_8_close_env, hungarian_UTF_8_stem, hungarian_UTF_8_stem_ascii},
+  {"hungarian", ENC_ISO_8859_2, hungarian_ISO_8859_2_create_env_with_allocator, hungarian_ISO_8859_2_close_env, hungarian_ISO_8859_2_stem, 0},
+  {"hungarian", ENC_UTF_16, hungarian_UTF_16_create_env_with_allocator, hungarian_UTF_16_close_env, hungarian_UTF_16_stem, 0},
+  {"hungarian", ENC_UTF_8, hungarian_UTF_8_create_env_with_allocator, hungarian_UTF_8_close_env, hungarian_UTF_8_stem, hungarian_UTF_8_stem_ascii},
+  {"hy", ENC_UTF_16, armenian_UTF_16_create_env_with_allocator, armenian_UTF_16_close_env, armenian_UTF_16_stem, 0},
+  {"hy", ENC_UTF_8, armenian_UTF_8_create_env_with_allocator, armenian_UTF_8_close_env, armenian_UTF_8_stem, armenian_UTF_8_stem_ascii},
+  {"hye", ENC_UTF_16, armenian_UTF_16_create_env_with_allocator, armenian_UTF_16_close_env, armenian_UTF_16_stem, 0},
+  {"hye", ENC_UTF_8, armenian_UTF_8_create_env_with_allocator, armenian_UTF_8_close_env, armenian_UTF_8_stem, armenian_UTF_8_stem_ascii},
+  {"id", ENC_ISO_8859_1, indonesian_ISO_8859_1_create_env_with_allocator, indonesian_ISO_8859_1_close_env, indonesian_ISO_8859_1_stem, 0},
+  {"id", ENC_UTF_16, indonesian_UTF_16_create_env_with_allocator, indonesian_UTF_16_close_env, indonesian_UTF_16_stem, 0},
+  {"id", ENC_UTF_8, indonesian_UTF_8_create_env_with_allocator, indonesian_UTF_8_close_env, indonesian_UTF_8_stem, indonesian_UTF_8_stem_ascii},
+  {"ind", ENC_ISO_8859_1, indonesian_ISO_8859_1_create_env_with_allocator, indonesian_ISO_8859_1_close_env, indonesian_ISO_8859_1_stem, 0},
+  {"ind", ENC_UTF_16, indonesian_UTF_16_create_env_with_allocator, indonesian_UTF_16_close_env, indonesian_UTF_16_stem, 0},
+  {"ind", ENC_UTF_8, indonesian_UTF_8_create_env_with_allocator, indonesian_UTF_8_close_env, indonesian_UTF_8_stem, indonesian_UTF_8_stem_ascii},
+  {"indonesian", ENC_ISO_8859_1, indonesian_ISO_8859_1_create_env_with_allocator, indonesian_ISO_8859_1_close_env, indonesian_ISO_8859_1_stem, 0},
+  {"indonesian", ENC_UTF_16, indonesian_UTF_16_create_env_with_allocator, indonesian_UTF_16_close_env, indonesian_UTF_16_stem, 0},
+  {"indonesian", ENC_UTF_8, indonesian_UTF_8_create_env_with_allocator, indonesian_UTF_8_close_env, indonesian_UTF_8_stem, indonesian_UTF_8_stem_ascii},
+  {"irish", ENC_ISO_8859_1, irish_ISO_8859_1_create_env_with_allocator, irish_ISO_8859_1_close_env, irish_ISO_8859_1_stem, 0},
+  {"irish", ENC_UTF_16, irish_UTF_16_create_env_with_allocator, irish_UTF_16_close_env, irish_UTF_16_stem, 0},
+  {"irish", ENC_UTF_8, irish_UTF_8_create_env_with_allocator, irish_UTF_8_close_env, irish_UTF_8_stem, irish_UTF_8_stem_ascii},
+  {"it", ENC_ISO_8859_1, italian_ISO_8859_1_create_env_with_allocator, italian_ISO_8859_1_close_env, italian_ISO_8859_1_stem, 0},
+  {"it", ENC_UTF_16, italian_UTF_16_create_env_with_allocator, italian_UTF_16_close_env, italian_UTF_16_stem, 0},
+  {"it", ENC_UTF_8, italian_UTF_8_create_env_with_allocator, italian_UTF_8_close_env, italian_UTF_8_stem, italian_UTF_8_stem_ascii},
+  {"ita", ENC_ISO_8859_1, italian_ISO_8859_1_create_env_with_allocator, italian_ISO_8859_1_close_env, italian_ISO_8859_1_stem, 0},
+  {"ita", ENC_UTF_16, italian_UTF_16_create_env_with_allocator, italian_UTF_16_close_env, italian_UTF_16_stem, 0},
+  {"ita", ENC_UTF_8, italian_UTF_8_create_env_with_allocator, italian_UTF_8_close_env, italian_UTF_8_stem, italian_UTF_8_stem_ascii},
+  {"italian", ENC_ISO_8859_1, italian_ISO_8859_1_create_env_with_allocator, italian_ISO_8859_1_close_env, italian_ISO_8859_1_stem, 0},
+  {"italian", ENC_UTF_16, italian_UTF_16_create_env_with_allocator, italian_UTF_16_close_env, italian_UTF_16_stem, 0},
+  {"italian", ENC_UTF_8, italian_UTF_8_create_env_with_allocator, italian_UTF_8_close_env, italian_UTF_8_stem, italian_UTF_8_stem_ascii},
+  {"kraaij_pohlmann", ENC_ISO_8859_1, dutch_ISO_8859_1_create_env_with_allocator, dutch_ISO_8859_1_close_env, dutch_ISO_8859_1_stem, 0},
+  {"kraaij_pohlmann", ENC_UTF_16, dutch_UTF_16_create_env_with_allocator, dutch_UTF_16_close_env, dutch_UTF_16_stem, 0},
+  {"kraaij_pohlmann", ENC_UTF_8, dutch_UTF_8_create_env_with_allocator, dutch_UTF_8_close_env, dutch_UTF_8_stem, dutch_UTF_8_stem_ascii},
+  {"lit", ENC_UTF_16, lithuanian_UTF_16_create_env_with_allocator, lithuanian_UTF_16_close_env, lithuanian_UTF_16_stem, 0},
+  {"lit", ENC_UTF_8, lithuanian_UTF_8_create_env_with_allocator, lithuanian_UTF_8_close_env, lithuanian_UTF_8_stem, lithuanian_UTF_8_stem_ascii},
+  {"lithuanian", ENC_UTF_16, lithuanian_UTF_16_create_env_with_allocator, lithuanian_UTF_16_close_env, lithuanian_UTF_16_stem, 0},
+  {"lithuanian", ENC_UTF_8, lithuanian_UTF_8_create_env_with_allocator, lithuanian_UTF_8_close_env, lithuanian_UTF_8_stem, lithuanian_UTF_8_stem_ascii},
+  {"lt", ENC_UTF_16, lithuanian_UTF_16_create_env_with_allocator, lithuanian_UTF_16_close_env, lithuanian_UTF_16_stem, 0},
+  {"lt", ENC_UTF_8, lithuanian_UTF_8_create_env_with_allocator, lithuanian_UTF_8_close_env, lithuanian_UTF_8_stem, lithuanian_UTF_8_stem_ascii},
+  {"ne", ENC_UTF_16, nepali_UTF_16_create_env_with_allocator, nepali_UTF_16_close_env, nepali_UTF_16_stem, 0},
+  {"ne", ENC_UTF_8, nepali_UTF_8_create_env_with_allocator, nepali_UTF_8_close_env, nepali_UTF_8_stem, nepali_UTF_8_stem_ascii},
+  {"nep", ENC_UTF_16, nepali_UTF_16_create_env_with_allocator, nepali_UTF_16_close_env, nepali_UTF_16_stem, 0},
+  {"nep", ENC_UTF_8, nepali_UTF_8_create_env_with_allocator, nepali_UTF_8_close_env, nepali_UTF_8_stem, nepali_UTF_8_stem_ascii},
+  {"nepali", ENC_UTF_16, nepali_UTF_16_create_env_with_allocator, nepali_UTF_16_close_env, nepali_UTF_16_stem, 0},
+  {"nepali", ENC_UTF_8, nepali_UTF_8_create_env_with_allocator, nepali_UTF_8_close_env, nepali_UTF_8_stem, nepali_UTF_8_stem_ascii},
+  {"nl", ENC_ISO_8859_1, dutch_ISO_8859_1_create_env_with_allocator, dutch_ISO_8859_1_close_env, dutch_ISO_8859_1_stem, 0},
+  {"nl", ENC_UTF_16, dutch_UTF_16_create_env_with_allocator, dutch_UTF_16_close_env, dutch_UTF_16_stem, 0},
+  {"nl", ENC_UTF_8, dutch_UTF_8_create_env_with_allocator, dutch_UTF_8_close_env, dutch_UTF_8_stem, dutch_UTF_8_stem_ascii},
+  {"nld", ENC_ISO_8859_1, dutch_ISO_8859_1_create_env_with_allocator, dutch_ISO_8859_1_close_env, dutch_ISO_8859_1_stem, 0},
+  {"nld", ENC_UTF_16, dutch_UTF_16_create_env_with_allocator, dutch_UTF_16_close_env, dutch_UTF_16_stem, 0},
+  {"nld", ENC_UTF_8, dutch_UTF_8_create_env_with_allocator, dutch_UTF_8_close_env, dutch_UTF_8_stem, dutch_UTF_8_stem_ascii},
+  {"no", ENC_ISO_8859_1, norwegian_ISO_8859_1_create_env_with_allocator, norwegian_ISO_8859_1_close_env, norwegian_ISO_8859_1_stem, 0},
+  {"no", ENC_UTF_16, norwegian_UTF_16_create_env_with_allocator, norwegian_UTF_16_close_env, norwegian_UTF_16_stem, 0},
+  {"no", ENC_UTF_8, norwegian_UTF_8_create_env_with_allocator, norwegian_UTF_8_close_env, norwegian_UTF_8_stem, norwegian_UTF_8_stem_ascii},
+  {"nor", ENC_ISO_8859_1, norwegian_ISO_8859_1_create_env_with_allocator, norwegian_ISO_8859_1_close_env, norwegian_ISO_8859_1_stem, 0},
+  {"nor", ENC_UTF_16, norwegian_UTF_16_create_env_with_allocator, norwegian_UTF_16_close_env, norwegian_UTF_16_stem, 0},
+  {"nor", ENC_UTF_8, norwegian_UTF_8_create_env_with_allocator, norwegian_UTF_8_close_env, norwegian_UTF_8_stem, norwegian_UTF_8_stem_ascii},
+  {"norwegian", ENC_ISO_8859_1, norwegian_ISO_8859_1_create_env_with_allocator, norwegian_ISO_8859_1_close_env, norwegian_ISO_8859_1_stem, 0},
+  {"norwegian", ENC_UTF_16, norwegian_UTF_16_create_env_with_allocator, norwegian_UTF_16_close_env, norwegian_UTF_16_stem, 0},
+  {"norwegian", ENC_UTF_8, norwegian_UTF_8_create_env_with_allocator, norwegian_UTF_8_close_env, norwegian_UTF_8_stem, norwegian_UTF_8_stem_ascii},
+  {"pers", ENC_UTF_16, persian_UTF_16_create_env_with_allocator, persian_UTF_16_close_env, persian_UTF_16_stem, 0},
+  {"pers", ENC_UTF_8, persian_UTF_8_create_env_with_allocator, persian_UTF_8_close_env, persian_UTF_8_stem, persian_UTF_8_stem_ascii},
+  {"persian", ENC_UTF_16, persian_UTF_16_create_env_with_allocator, persian_UTF_16_close_env, persian_UTF_16_stem, 0},
+  {"persian", ENC_UTF_8, persian_UTF_8_create_env_with_allocator, persian_UTF_8_close_env, persian_UTF_8_stem, persian_UTF_8_stem_ascii},
+  {"pl", ENC_ISO_8859_2, polish_ISO_8859_2_create_env_with_allocator, polish_ISO_8859_2_close_env, polish_ISO_8859_2_stem, 0},
+  {"pl", ENC_UTF_16, polish_UTF_16_create_env_with_allocator, polish_UTF_16_close_env, polish_UTF_16_stem, 0},
+  {"pl", ENC_UTF_8, polish_UTF_8_create_env_with_allocator, polish_UTF_8_close_env, polish_UTF_8_stem, polish_UTF_8_stem_ascii},
+  {"pol", ENC_ISO_8859_2, polish_ISO_8859_2_create_env_with_allocator, polish_ISO_8859_2_close_env, polish_ISO_8859_2_stem, 0},
+  {"pol", ENC_UTF_16, polish_UTF_16_create_env_with_allocator, polish_UTF_16_close_env, polish_UTF_16_stem, 0},
+  {"pol", ENC_UTF_8, polish_UTF_8_create_env_with_allocator, polish_UTF_8_close_env, polish_UTF_8_stem, polish_UTF_8_stem_ascii},
+  {"polish", ENC_ISO_8859_2, polish_ISO_8859_2_create_env_with_allocator, polish_ISO_8859_2_close_env, polish_ISO_8859_2_stem, 0},
+  {"polish", ENC_UTF_16, polish_UTF_16_create_env_with_allocator, polish_UTF_16_close_env, polish_UTF_16_stem, 0},
+  {"polish", ENC_UTF_8, polish_UTF_8_create_env_with_allocator, polish_UTF_8_close_env, polish_UTF_8_stem, polish_UTF_8_stem_ascii},
+  {"por", ENC_ISO_8859_1, portuguese_ISO_8859_1_create_env_with_allocator, portuguese_ISO_8859_1_close_env, portuguese_ISO_8859_1_stem, 0},
+  {"por", ENC_UTF_16, portuguese_UTF_16_create_env_with_allocator, portuguese_UTF_16_close_env, portuguese_UTF_16_stem, 0},
+  {"por", ENC_UTF_8, portuguese_UTF_8_create_env_with_allocator, portuguese_UTF_8_close_env, portuguese_UTF_8_stem, portuguese_UTF_8_stem_ascii},
+  {"porter", ENC_ISO_8859_1, porter_ISO_8859_1_create_env_with_allocator, porter_ISO_8859_1_close_env, porter_ISO_8859_1_stem, 0},
+  {"porter", ENC_UTF_16, porter_UTF_16_create_env_with_allocator, porter_UTF_16_close_env, porter_UTF_16_stem, 0},
+  {"porter", ENC_UTF_8, porter_UTF_8_create_env_with_allocator, porter_UTF_8_close_env, porter_UTF_8_stem, porter_UTF_8_stem_ascii},
+  {"portuguese", ENC_ISO_8859_1, portuguese_ISO_8859_1_create_env_with_allocator, portuguese_ISO_8859_1_close_env, portuguese_ISO_8859_1_stem, 0},
+  {"portuguese", ENC_UTF_16, portuguese_UTF_16_create_env_with_allocator, portuguese_UTF_16_close_env, portuguese_UTF_16_stem, 0},
+  {"portuguese", ENC_UTF_8, portuguese_UTF_8_create_env_with_allocator, portuguese_UTF_8_close_env, portuguese_UTF_8_stem, portuguese_UTF_8_stem_ascii},
+  {"pt", ENC_ISO_8859_1, portuguese_ISO_8859_1_create_env_with_allocator, portuguese_ISO_8859_1_close_env, portuguese_ISO_8859_1_stem, 0},
+  {"pt", ENC_UTF_16, portuguese_UTF_16_create_env_with_allocator, portuguese_UTF_16_close_env, portuguese_UTF_16_stem, 0},
+  {"pt", ENC_UTF_8, portuguese_UTF_8_create_env_with_allocator, portuguese_UTF_8_close_env, portuguese_UTF_8_stem, portuguese_UTF_8_stem_ascii},
+  {"ro", ENC_UTF_16, romanian_UTF_16_create_env_with_allocator, romanian_UTF_16_close_env, romanian_UTF_16_stem, 0},
+  {"ro", ENC_UTF_8, romanian_UTF_8_create_env_with_allocator, romanian_UTF_8_close_env, romanian_UTF_8_stem, romanian_UTF_8_stem_ascii},
+  {"romanian", ENC_UTF_16, romanian_UTF_16_create_env_with_allocator, romanian_UTF_16_close_env, romanian_UTF_16_stem, 0},
+  {"romanian", ENC_UTF_8, romanian_UTF_8_create_env_with_allocator, romanian_UTF_8_close_env, romanian_UTF_8_stem, romanian_UTF_8_stem_ascii},
+  {"ron", ENC_UTF_16, romanian_UTF_16_create_env_with_allocator, romanian_UTF_16_close_env, romanian_UTF_16_stem, 0},
+  {"ron", ENC_UTF_8, romanian_UTF_8_create_env_with_allocator, romanian_UTF_8_close_env, romanian_UTF_8_stem, romanian_UTF_8_stem_ascii},
+  {"ru", ENC_KOI8_R, russian_KOI8_R_create_env_with_allocator, russian_KOI8_R_close_env, russian_KOI8_R_stem, 0},
+  {"ru", ENC_UTF_16, russian_UTF_16_create_env_with_allocator, russian_UTF_16_close_env, russian_UTF_16_stem, 0},
+  {"ru", ENC_UTF_8, russian_UTF_8_create_env_with_allocator, russian_UTF_8_close_env, russian_UTF_8_stem, russian_UTF_8_stem_ascii},
+  {"rum", ENC_UTF_16, romanian_UTF_16_create_env_with_allocator, romanian_UTF_16_close_env, romanian_UTF_16_stem, 0},
+  {"rum", ENC_UTF_8, romanian_UTF_8_create_env_with_allocator, romanian_UTF_8_close_env, romanian_UTF_8_stem, romanian_UTF_8_stem_ascii},
+  {"rus", ENC_KOI8_R, russian_KOI8_R_create_env_with_allocator, russian_KOI8_R_close_env, russian_KOI8_R_stem, 0},
+  {"rus", ENC_UTF_16, russian_UTF_16_create_env_with_allocator, russian_UTF_16_close_env, russian_UTF_16_stem, 0},
+  {"rus", ENC_UTF_8, russian_UTF_8_create_env_with_allocator, russian_UTF_8_close_env, russian_UTF_8_stem, russian_UTF_8_stem_ascii},
+  {"russian", ENC_KOI8_R, russian_KOI8_R_create_env_with_allocator, russian_KOI8_R_close_env, russian_KOI8_R_stem, 0},
+  {"russian", ENC_UTF_16, russian_UTF_16_create_env_with_allocator, russian_UTF_16_close_env, russian_UTF_16_stem, 0},
+  {"russian", ENC_UTF_8, russian_UTF_8_create_env_with_allocator, russian_UTF_8_close_env, russian_UTF_8_stem, russian_UTF_8_stem_ascii},
+  {"serbian", ENC_UTF_16, serbian_UTF_16_create_env_with_allocator, serbian_UTF_16_close_env, serbian_UTF_16_stem, 0},
+  {"serbian", ENC_UTF_8, serbian_UTF_8_create_env_with_allocator, serbian_UTF_8_close_env, serbian_UTF_8_stem, serbian_UTF_8_stem_ascii},
+  {"spa", ENC_ISO_8859_1, spanish_ISO_8859_1_create_env_with_allocator, spanish_ISO_8859_1_close_env, spanish_ISO_8859_1_stem, 0},
+  {"spa", ENC_UTF_16, spanish_UTF_16_create_env_with_allocator, spanish_UTF_16_close_env, spanish_UTF_16_stem, 0},
+  {"spa", ENC_UTF_8, spanish_UTF_8_create_env_with_allocator, spanish_UTF_8_close_env, spanish_UTF_8_stem, spanish_UTF_8_stem_ascii},
+  {"spanish", ENC_ISO_8859_1, spanish_ISO_8859_1_create_env_with_allocator, spanish_ISO_8859_1_close_env, spanish_ISO_8859_1_stem, 0},
+  {"spanish", ENC_UTF_16, spanish_UTF_16_create_env_with_allocator, spanish_UTF_16_close_env, spanish_UTF_16_stem, 0},
+  {"spanish", ENC_UTF_8, spanish_UTF_8_create_env_with_allocator, spanish_UTF_8_close_env, spanish_UTF_8_stem, spanish_UTF_8_stem_ascii},
+  {"sr", ENC_UTF_16, serbian_UTF_16_create_env_with_allocator, serbian_UTF_16_close_env, serbian_UTF_16_stem, 0},
+  {"sr", ENC_UTF_8, serbian_UTF_8_create_env_with_allocator, serbian_UTF_8_close_env, serbian_UTF_8_stem, serbian_UTF_8_stem_ascii},
+  {"srp", ENC_UTF_16, serbian_UTF_16_create_env_with_allocator, serbian_UTF_16_close_env, serbian_UTF_16_stem, 0},
+  {"srp", ENC_UTF_8, serbian_UTF_8_create_env_with_allocator, serbian_UTF_8_close_env, serbian_UTF_8_stem, serbian_UTF_8_stem_ascii},
+  {"sv", ENC_ISO_8859_1, swedish_ISO_8859_1_create_env_with_allocator, swedish_ISO_8859_1_close_env, swedish_ISO_8859_1_stem, 0},
+  {"sv", ENC_UTF_16, swedish_UTF_16_create_env_with_allocator, swedish_UTF_16_close_env, swedish_UTF_16_stem, 0},
+  {"sv", ENC_UTF_8, swedish_UTF_8_create_env_with_allocator, swedish_UTF_8_close_env, swedish_UTF_8_stem, swedish_UTF_8_stem_ascii},
+  {"swe", ENC_ISO_8859_1, swedish_ISO_8859_1_create_env_with_allocator, swedish_ISO_8859_1_close_env, swedish_ISO_8859_1_stem, 0},
+  {"swe", ENC_UTF_16, swedish_UTF_16_create_env_with_allocator, swedish_UTF_16_close_env, swedish_UTF_16_stem, 0},
+  {"swe", ENC_UTF_8, swedish_UTF_8_create_env_with_allocator, swedish_UTF_8_close_env, swedish_UTF_8_stem, swedish_UTF_8_stem_ascii},
+  {"swedish", ENC_ISO_8859_1, swedish_ISO_8859_1_create_env_with_allocator, swedish_ISO_8859_1_close_env, swedish_ISO_8859_1_stem, 0},
+  {"swedish", ENC_UTF_16, swedish_UTF_16_create_env_with_allocator, swedish_UTF_16_close_env, swedish_UTF_16_stem, 0},
+  {"swedish", ENC_UTF_8, swedish_UTF_8_create_env_with_allocator, swedish_UTF_8_close_env, swedish_UTF_8_stem, swedish_UTF_8_stem_ascii},
+  {"ta", ENC_UTF_16, tamil_UTF_16_create_env_with_allocator, tamil_UTF_16_close_env, tamil_UTF_16_stem, 0},
+  {"ta", ENC_UTF_8, tamil_UTF_8_create_env_with_allocator, tamil_UTF_8_close_env, tamil_UTF_8_stem, tamil_UTF_8_stem_ascii},
+  {"tam", ENC_UTF_16, tamil_UTF_16_create_env_with_allocator, tamil_UTF_16_close_env, tamil_UTF_16_stem, 0},
+  {"tam", ENC_UTF_8, tamil_UTF_8_create_env_with_allocator, tamil_UTF_8_close_env, tamil_UTF_8_stem, tamil_UTF_8_stem_ascii},
+  {"tamil", ENC_UTF_16, tamil_UTF_16_create_env_with_allocator, tamil_UTF_16_close_env, tamil_UTF_16_stem, 0},
+  {"tamil", ENC_UTF_8, tamil_UTF_8_create_env_with_allocator, tamil_UTF_8_close_env, tamil_UTF_8_stem, tamil_UTF_8_stem_ascii},
+  {"tr", ENC_UTF_16, turkish_UTF_16_create_env_with_allocator, turkish_UTF_16_close_env, turkish_UTF_16_stem, 0},
+  {"tr", ENC_UTF_8, turkish_UTF_8_create_env_with_allocator, turkish_UTF_8_close_env, turkish_UTF_8_stem, turkish_UTF_8_stem_ascii},
+  {"tur", ENC_UTF_16, turkish_UTF_16_create_env_with_allocator, turkish_UTF_16_close_env, turkish_UTF_16_stem, 0},
+  {"tur", ENC_UTF_8, turkish_UTF_8_create_env_with_allocator, turkish_UTF_8_close_env, turkish_UTF_8_stem, turkish_UTF_8_stem_ascii},
+  {"turkish", ENC_UTF_16, turkish_UTF_16_create_env_with_allocator, turkish_UTF_16_close_env, turkish_UTF_16_stem, 0},
+  {"turkish", ENC_UTF_8, turkish_UTF_8_create_env_with_allocator, turkish_UTF_8_close_env, turkish_UTF_8_stem, turkish_UTF_8_stem_ascii},
+  {"yi", ENC_UTF_16, yiddish_UTF_16_create_env_with_allocator, yiddish_UTF_16_close_env, yiddish_UTF_16_stem, 0},
+  {"yi", ENC_UTF_8, yiddish_UTF_8_create_env_with_allocator, yiddish_UTF_8_close_env, yiddish_UTF_8_stem, yiddish_UTF_8_stem_ascii},
+  {"yid", ENC_UTF_16, yiddish_UTF_16_create_env_with_allocator, yiddish_UTF_16_close_env, yiddish_UTF_16_stem, 0},
+  {"yid", ENC_UTF_8, yiddish_UTF_8_create_env_with_allocator, yiddish_UTF_8_close_env, yiddish_UTF_8_stem, yiddish_UTF_8_stem_ascii},
+  {"yiddish", ENC_UTF_16, yiddish_UTF_16_create_env_with_allocator, yiddish_UTF_16_close_env, yiddish_UTF_16_stem, 0},
+  {"yiddish", ENC_UTF_8, yiddish_UTF_8_create_env_with_allocator, yiddish_UTF_8_close_env, yiddish_UTF_8_stem, yiddish_UTF_8_stem_ascii},
+  {0,ENC_UNKNOWN,0,0,0,0}
+};
+
+/* Hash table of indices into modules (-1 for an empty slot), indexed by an
+ * FNV-1a hash of the name with linear probing.
+ */
+#define MODULE_HASH_SIZE 256
+static const short module_hash[MODULE_HASH_SIZE] = {
+  -1, 2, 219, 125, 266, -1, -1, 19,
+  -1, 4, -1, -1, 264, 64, 222, -1,
+  158, -1, -1, 117, 131, 239, 46, 56,
+  191, 167, 93, 59, 129, 62, 251, -1,
+  180, 226, 13, 228, -1, 111, -1, 272,
+  28, 276, -1, -1, -1, -1, -1, -1,
+  -1, 43, 114, -1, -1, -1, -1, 231,
+  136, 201, 139, -1, 176, 216, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, 16, 155, -1, 207, -1, -1, -1,
+  -1, 262, -1, 199, -1, -1, 25, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, 120, -1, -1, 49, 152, 260, 182,
+  86, 66, 72, 142, -1, -1, -1, -1,
+  -1, -1, 40, -1, 96, 37, 197, -1,
+  -1, 274, 76, -1, -1, -1, -1, -1,
+  -1, 88, 8, -1, 204, 108, 133, 10,
+  -1, -1, 53, 164, 224, -1, 149, 80,
+  -1, -1, -1, -1, -1, -1, -1, -1,
+  31, 51, 127, -1, -1, 22, 144, 257,
+  -1, -1, 34, -1, 178, -1, -1, 74,
+  -1, 233, -1, 194, -1, -1, -1, -1,
+  102, 268, -1, -1, 83, 6, 170, 241,
+  -1, 185, -1, 244, 270, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1,
+  90, 213, 247, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, 69,
+  146, 249, -1, 161, -1, -1, 172, 236,
+  -1, -1, -1, -1, -1, 174, -1, -1,
+  -1, 99, -1, -1, -1, -1, 210, -1,
+  -1, -1, 0, 123, 78, 105, 188, 254,
+};
+
+static const char * algorithm_names[] = {
+  "arabic", 
+  "armenian", 
+  "basque", 
+  "catalan", 
+  "danish", 
+  "dutch", 
+  "dutch_porter", 
+  "english", 
+  "esperanto", 
+  "estonian", 
+  "finnish", 
+  "french", 
+  "german", 
+  "greek", 
+  "hindi", 
+  "hungarian", 
+  "indonesian", 
+  "irish", 
+  "italian", 
+  "lithuanian", 
+  "nepali", 
+  "norwegian", 
+  "persian", 
+  "polish", 
+  "porter", 
+  "portuguese", 
+  "romanian", 
+  "russian", 
+  "serbian", 
+  "spanish", 
+  "swedish", 
+  "tamil", 
+  "turkish", 
+  "yiddish", 
+  0
+};
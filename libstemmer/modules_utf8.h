@@ -0,0 +1,361 @@
+/* libstemmer/modules_utf8.h: List of stemming modules.
+ *
+ * This file is generated by mkmodules.pl from a list of module names.
+ * Do not edit manually.
+ *
+ * Modules included by this file are: arabic, armenian, basque, catalan,
+ * danish, dutch, dutch_porter, english, esperanto, estonian, finnish, french,
+ * german, greek, hindi, hungarian, indonesian, irish, italian, lithuanian,
+ * nepali, norwegian, persian, polish, porter, portuguese, romanian, russian,
+ * serbian, spanish, swedish, tamil, turkish, yiddish
+ */
+
+#include "../src_c/stem_UTF_8_arabic.h"
+#include "../src_c/stem_UTF_8_armenian.h"
+#include "../src_c/stem_UTF_8_basque.h"
+#include "../src_c/stem_UTF_8_catalan.h"
+#include "../src_c/stem_UTF_8_danish.h"
+#include "../src_c/stem_UTF_8_dutch.h"
+#include "../src_c/stem_UTF_8_dutch_porter.h"
+#include "../src_c/stem_UTF_8_english.h"
+#include "../src_c/stem_UTF_8_esperanto.h"
+#include "../src_c/stem_UTF_8_estonian.h"
+#include "../src_c/stem_UTF_8_finnish.h"
+#include "../src_c/stem_UTF_8_french.h"
+#include "../src_c/stem_UTF_8_german.h"
+#include "../src_c/stem_UTF_8_greek.h"
+#include "../src_c/stem_UTF_8_hindi.h"
+#include "../src_c/stem_UTF_8_hungarian.h"
+#include "../src_c/stem_UTF_8_indonesian.h"
+#include "../src_c/stem_UTF_8_irish.h"
+#include "../src_c/stem_UTF_8_italian.h"
+#include "../src_c/stem_UTF_8_lithuanian.h"
+#include "../src_c/stem_UTF_8_nepali.h"
+#include "../src_c/stem_UTF_8_norwegian.h"
+#include "../src_c/stem_UTF_8_persian.h"
+#include "../src_c/stem_UTF_8_polish.h"
+#include "../src_c/stem_UTF_8_porter.h"
+#include "../src_c/stem_UTF_8_portuguese.h"
+#include "../src_c/stem_UTF_8_romanian.h"
+#include "../src_c/stem_UTF_8_russian.h"
+#include "../src_c/stem_UTF_8_serbian.h"
+#include "../src_c/stem_UTF_8_spanish.h"
+#include "../src_c/stem_UTF_8_swedish.h"
+#include "../src_c/stem_UTF_8_tamil.h"
+#include "../src_c/stem_UTF_8_turkish.h"
+#include "../src_c/stem_UTF_8_yiddish.h"
+
+#ifndef arabic_UTF_8_stem_ascii
+# define arabic_UTF_8_stem_ascii 0
+#endif
+#ifndef armenian_UTF_8_stem_ascii
+# define armenian_UTF_8_stem_ascii 0
+#endif
+#ifndef basque_UTF_8_stem_ascii
+# define basque_UTF_8_stem_ascii 0
+#endif
+#ifndef catalan_UTF_8_stem_ascii
+# define catalan_UTF_8_stem_ascii 0
+#endif
+#ifndef danish_UTF_8_stem_ascii
+# define danish_UTF_8_stem_ascii 0
+#endif
+#ifndef dutch_UTF_8_stem_ascii
+# define dutch_UTF_8_stem_ascii 0
+#endif
+#ifndef dutch_porter_UTF_8_stem_ascii
+# define dutch_porter_UTF_8_stem_ascii 0
+#endif
+#ifndef english_UTF_8_stem_ascii
+# define english_UTF_8_stem_ascii 0
+#endif
+#ifndef esperanto_UTF_8_stem_ascii
+# define esperanto_UTF_8_stem_ascii 0
+#endif
+#ifndef estonian_UTF_8_stem_ascii
+# define estonian_UTF_8_stem_ascii 0
+#endif
+#ifndef finnish_UTF_8_stem_ascii
+# define finnish_UTF_8_stem_ascii 0
+#endif
+#ifndef french_UTF_8_stem_ascii
+# define french_UTF_8_stem_ascii 0
+#endif
+#ifndef german_UTF_8_stem_ascii
+# define german_UTF_8_stem_ascii 0
+#endif
+#ifndef greek_UTF_8_stem_ascii
+# define greek_UTF_8_stem_ascii 0
+#endif
+#ifndef hindi_UTF_8_stem_ascii
+# define hindi_UTF_8_stem_ascii 0
+#endif
+#ifndef hungarian_UTF_8_stem_ascii
+# define hungarian_UTF_8_stem_ascii 0
+#endif
+#ifndef indonesian_UTF_8_stem_ascii
+# define indonesian_UTF_8_stem_ascii 0
+#endif
+#ifndef irish_UTF_8_stem_ascii
+# define irish_UTF_8_stem_ascii 0
+#endif
+#ifndef italian_UTF_8_stem_ascii
+# define italian_UTF_8_stem_ascii 0
+#endif
+#ifndef lithuanian_UTF_8_stem_ascii
+# define lithuanian_UTF_8_stem_ascii 0
+#endif
+#ifndef nepali_UTF_8_stem_ascii
+# define nepali_UTF_8_stem_ascii 0
+#endif
+#ifndef norwegian_UTF_8_stem_ascii
+# define norwegian_UTF_8_stem_ascii 0
+#endif
+#ifndef persian_UTF_8_stem_ascii
+# define persian_UTF_8_stem_ascii 0
+#endif
+#ifndef polish_UTF_8_stem_ascii
+# define polish_UTF_8_stem_ascii 0
+#endif
+#ifndef porter_UTF_8_stem_ascii
+# define porter_UTF_8_stem_ascii 0
+#endif
+#ifndef portuguese_UTF_8_stem_ascii
+# define portuguese_UTF_8_stem_ascii 0
+#endif
+#ifndef romanian_UTF_8_stem_ascii
+# define romanian_UTF_8_stem_ascii 0
+#endif
+#ifndef russian_UTF_8_stem_ascii
+# define russian_UTF_8_stem_ascii 0
+#endif
+#ifndef serbian_UTF_8_stem_ascii
+# define serbian_UTF_8_stem_ascii 0
+#endif
+#ifndef spanish_UTF_8_stem_ascii
+# define spanish_UTF_8_stem_ascii 0
+#endif
+#ifndef swedish_UTF_8_stem_ascii
+# define swedish_UTF_8_stem_ascii 0
+#endif
+#ifndef tamil_UTF_8_stem_ascii
+# define tamil_UTF_8_stem_ascii 0
+#endif
+#ifndef turkish_UTF_8_stem_ascii
+# define turkish_UTF_8_stem_ascii 0
+#endif
+#ifndef yiddish_UTF_8_stem_ascii
+# define yiddish_UTF_8_stem_ascii 0
+#endif
+
+typedef enum {
+  ENC_UNKNOWN=0,
+  ENC_UTF_8
+} stemmer_encoding_t;
+
+struct stemmer_encoding {
+  const char * name;
+  stemmer_encoding_t enc;
+};
+static const struct stemmer_encoding encodings[] = {
+  {"UTF_8", ENC_UTF_8},
+  {0,ENC_UNKNOWN}
+};
+
+struct sb_stemmer_module {
+  const char * name;
+  stemmer_encoding_t enc;
+  struct SN_env * (*create)(const struct SN_allocator *);
+  void (*close)(struct SN_env *);
+  int (*stem)(struct SN_env *);
+  /* Version of stem specialised for ASCII input (or 0 if none). */
+  int (*stem_ascii)(struct SN_env *);
+};
+static const struct sb_stemmer_module modules[] = {
+  {"ar", ENC_UTF_8, arabic_UTF_8_create_env_with_allocator, arabic_UTF_8_close_env, arabic_UTF_8_stem, arabic_UTF_8_stem_ascii},
+  {"ara", ENC_UTF_8, arabic_UTF_8_create_env_with_allocator, arabic_UTF_8_close_env, arabic_UTF_8_stem, arabic_UTF_8_stem_ascii},
+  {"arabic", ENC_UTF_8, arabic_UTF_8_create_env_with_allocator, arabic_UTF_8_close_env, arabic_UTF_8_stem, arabic_UTF_8_stem_ascii},
+  {"arm", ENC_UTF_8, armenian_UTF_8_create_env_with_allocator, armenian_UTF_8_close_env, armenian_UTF_8_stem, armenian_UTF_8_stem_ascii},
+  {"armenian", ENC_UTF_8, armenian_UTF_8_create_env_with_allocator, armenian_UTF_8_close_env, armenian_UTF_8_stem, armenian_UTF_8_stem_ascii},
+  {"baq", ENC_UTF_8, basque_UTF_8_create_env_with_allocator, basque_UTF_8_close_env, basque_UTF_8_stem, basque_UTF_8_stem_ascii},
+  {"basque", ENC_UTF_8, basque_UTF_8_create_env_with_allocator, basque_UTF_8_close_env, basque_UTF_8_stem, basque_UTF_8_stem_ascii},
+  {"ca", ENC_UTF_8, catalan_UTF_8_create_env_with_allocator, catalan_UTF_8_close_env, catalan_UTF_8_stem, catalan_UTF_8_stem_ascii},
+  {"cat", ENC_UTF_8, catalan_UTF_8_create_env_with_allocator, catalan_UTF_8_close_env, catalan_UTF_8_stem, catalan_UTF_8_stem_ascii},
+  {"catalan", ENC_UTF_8, catalan_UTF_8_create_env_with_allocator, catalan_UTF_8_close_env, catalan_UTF_8_stem, catalan_UTF_8_stem_ascii},
+  {"da", ENC_UTF_8, danish_UTF_8_create_env_with_allocator, danish_UTF_8_close_env, danish_UTF_8_stem, danish_UTF_8_stem_ascii},
+  {"dan", ENC_UTF_8, danish_UTF_8_create_env_with_allocator, danish_UTF_8_close_env, danish_UTF_8_stem, danish_UTF_8_stem_ascii},
+  {"danish", ENC_UTF_8, danish_UTF_8_create_env_with_allocator, danish_UTF_8_close_env, danish_UTF_8_stem, danish_UTF_8_stem_ascii},
+  {"de", ENC_UTF_8, german_UTF_8_create_env_with_allocator, german_UTF_8_close_env, german_UTF_8_stem, german_UTF_8_stem_ascii},
+  {"deu", ENC_UTF_8, german_UTF_8_create_env_with_allocator, german_UTF_8_close_env, german_UTF_8_stem, german_UTF_8_stem_ascii},
+  {"dut", ENC_UTF_8, dutch_UTF_8_create_env_with_allocator, dutch_UTF_8_close_env, dutch_UTF_8_stem, dutch_UTF_8_stem_ascii},
+  {"dutch", ENC_UTF_8, dutch_UTF_8_create_env_with_allocator, dutch_UTF_8_close_env, dutch_UTF_8_stem, dutch_UTF_8_stem_ascii},
+  {"dutch_porter", ENC_UTF_8, dutch_porter_UTF_8_create_env_with_allocator, dutch_porter_UTF_8_close_env, dutch_porter_UTF_8_stem, dutch_porter_UTF_8_stem_ascii},
+  {"el", ENC_UTF_8, greek_UTF_8_create_env_with_allocator, greek_UTF_8_close_env, greek_UTF_8_stem, greek_UTF_8_stem_ascii},
+  {"ell", ENC_UTF_8, greek_UTF_8_create_env_with_allocator, greek_UTF_8_close_env, greek_UTF_8_stem, greek_UTF_8_stem_ascii},
+  {"en", ENC_UTF_8, english_UTF_8_create_env_with_allocator, english_UTF_8_close_env, english_UTF_8_stem, english_UTF_8_stem_ascii},
+  {"eng", ENC_UTF_8, english_UTF_8_create_env_with_allocator, english_UTF_8_close_env, english_UTF_8_stem, english_UTF_8_stem_ascii},
+  {"english", ENC_UTF_8, english_UTF_8_create_env_with_allocator, english_UTF_8_close_env, english_UTF_8_stem, english_UTF_8_stem_ascii},
+  {"eo", ENC_UTF_8, esperanto_UTF_8_create_env_with_allocator, esperanto_UTF_8_close_env, esperanto_UTF_8_stem, esperanto_UTF_8_stem_ascii},
+  {"epo", ENC_UTF_8, esperanto_UTF_8_create_env_with_allocator, esperanto_UTF_8_close_env, esperanto_UTF_8_stem, esperanto_UTF_8_stem_ascii},
+  {"es", ENC_UTF_8, spanish_UTF_8_create_env_with_allocator, spanish_UTF_8_close_env, spanish_UTF_8_stem, spanish_UTF_8_stem_ascii},
+  {"esl", ENC_UTF_8, spanish_UTF_8_create_env_with_allocator, spanish_UTF_8_close_env, spanish_UTF_8_stem, spanish_UTF_8_stem_ascii},
+  {"esperanto", ENC_UTF_8, esperanto_UTF_8_create_env_with_allocator, esperanto_UTF_8_close_env, esperanto_UTF_8_stem, esperanto_UTF_8_stem_ascii},
+  {"est", ENC_UTF_8, estonian_UTF_8_create_env_with_allocator, estonian_UTF_8_close_env, estonian_UTF_8_stem, estonian_UTF_8_stem_ascii},
+  {"estonian", ENC_UTF_8, estonian_UTF_8_create_env_with_allocator, estonian_UTF_8_close_env, estonian_UTF_8_stem, estonian_UTF_8_stem_ascii},
+  {"et", ENC_UTF_8, estonian_UTF_8_create_env_with_allocator, estonian_UTF_8_close_env, estonian_UTF_8_stem, estonian_UTF_8_stem_ascii},
+  {"eu", ENC_UTF_8, basque_UTF_8_create_env_with_allocator, basque_UTF_8_close_env, basque_UTF_8_stem, basque_UTF_8_stem_ascii},
+  {"eus", ENC_UTF_8, basque_UTF_8_create_env_with_allocator, basque_UTF_8_close_env, basque_UTF_8_stem, basque_UTF_8_stem_ascii},
+  {"fa", ENC_UTF_8, persian_UTF_8_create_env_with_allocator, persian_UTF_8_close_env, persian_UTF_8_stem, persian_UTF_8_stem_ascii},
+  {"fas", ENC_UTF_8, persian_UTF_8_create_env_with_allocator, persian_UTF_8_close_env, persian_UTF_8_stem, persian_UTF_8_stem_ascii},
+  {"fi", ENC_UTF_8, finnish_UTF_8_create_env_with_allocator, finnish_UTF_8_close_env, finnish_UTF_8_stem, finnish_UTF_8_stem_ascii},
+  {"fin", ENC_UTF_8, finnish_UTF_8_create_env_with_allocator, finnish_UTF_8_close_env, finnish_UTF_8_stem, finnish_UTF_8_stem_ascii},
+  {"finnish", ENC_UTF_8, finnish_UTF_8_create_env_with_allocator, finnish_UTF_8_close_env, finnish_UTF_8_stem, finnish_UTF_8_stem_ascii},
+  {"fr", ENC_UTF_8, french_UTF_8_create_env_with_allocator, french_UTF_8_close_env, french_UTF_8_stem, french_UTF_8_stem_ascii},
+  {"fra", ENC_UTF_8, french_UTF_8_create_env_with_allocator, french_UTF_8_close_env, french_UTF_8_stem, french_UTF_8_stem_ascii},
+  {"fre", ENC_UTF_8, french_UTF_8_create_env_with_allocator, french_UTF_8_close_env, french_UTF_8_stem, french_UTF_8_stem_ascii},
+  {"french", ENC_UTF_8, french_UTF_8_create_env_with_allocator, french_UTF_8_close_env, french_UTF_8_stem, french_UTF_8_stem_ascii},
+  {"ga", ENC_UTF_8, irish_UTF_8_create_env_with_allocator, irish_UTF_8_close_env, irish_UTF_8_stem, irish_UTF_8_stem_ascii},
+  {"ger", ENC_UTF_8, german_UTF_8_create_env_with_allocator, german_UTF_8_close_env, german_UTF_8_stem, german_UTF_8_stem_ascii},
+  {"german", ENC_UTF_8, german_UTF_8_create_env_with_allocator, german_UTF_8_close_env, german_UTF_8_stem, german_UTF_8_stem_ascii},
+  {"gle", ENC_UTF_8, irish_UTF_8_create_env_with_allocator, irish_UTF_8_close_env, irish_UTF_8_stem, irish_UTF_8_stem_ascii},
+  {"gre", ENC_UTF_8, greek_UTF_8_create_env_with_allocator, greek_UTF_8_close_env, greek_UTF_8_stem, greek_UTF_8_stem_ascii},
+  {"greek", ENC_UTF_8, greek_UTF_8_create_env_with_allocator, greek_UTF_8_close_env, greek_UTF_8_stem, greek_UTF_8_stem_ascii},
+  {"hi", ENC_UTF_8, hindi_UTF_8_create_env_with_allocator, hindi_UTF_8_close_env, hindi_UTF_8_stem, hindi_UTF_8_stem_ascii},
+  {"hin", ENC_UTF_8, hindi_UTF_8_create_env_with_allocator, hindi_UTF_8_close_env, hindi_UTF_8_stem, hindi_UTF_8_stem_ascii},
+  {"hindi", ENC_UTF_8, hindi_UTF_8_create_env_with_allocator, hindi_UTF_8_close_env, hindi_UTF_8_stem, hindi_UTF_8_stem_ascii},
+  {"hu", ENC_UTF_8, hungarian_UTF_8_create_env_with_allocator, hungarian_UTF_8_close_env, hungarian_UTF_8_stem, hungarian_UTF_8_stem_ascii},
+  {"hun", ENC_UTF_8, hungarian_UTF_8_create_env_with_allocator, hungarian_UTF_8_close_env, hungarian_UTF_8_stem, hungarian_UTF_8_stem_ascii},
+  {"hungarian", ENC_UTF_8, hungarian_UTF_8_create_env_with_allocator, hungarian_UTF_8_close_env, hungarian_UTF_8_stem, hungarian_UTF_8_stem_ascii},
+  {"hy", ENC_UTF_8, armenian_UTF_8_create_env_with_allocator, armenian_UTF_8_close_env, armenian_UTF_8_stem, armenian_UTF_8_stem_ascii},
+  {"hye", ENC_UTF_8, armenian_UTF_8_create_env_with_allocator, armenian_UTF_8_close_env, armenian_UTF_8_stem, armenian_UTF_8_stem_ascii},
+  {"id", ENC_UTF_8, indonesian_UTF_8_create_env_with_allocator, indonesian_UTF_8_close_env, indonesian_UTF_8_stem, indonesian_UTF_8_stem_ascii},
+  {"ind", ENC_UTF_8, indonesian_UTF_8_create_env_with_allocator, indonesian_UTF_8_close_env, indonesian_UTF_8_stem, indonesian_UTF_8_stem_ascii},
+  {"indonesian", ENC_UTF_8, indonesian_UTF_8_create_env_with_allocator, indonesian_UTF_8_close_env, indonesian_UTF_8_stem, indonesian_UTF_8_stem_ascii},
+  {"irish", ENC_UTF_8, irish_UTF_8_create_env_with_allocator, irish_UTF_8_close_env, irish_UTF_8_stem, irish_UTF_8_stem_ascii},
+  {"it", ENC_UTF_8, italian_UTF_8_create_env_with_allocator, italian_UTF_8_close_env, italian_UTF_8_stem, italian_UTF_8_stem_ascii},
+  {"ita", ENC_UTF_8, italian_UTF_8_create_env_with_allocator, italian_UTF_8_close_env, italian_UTF_8_stem, italian_UTF_8_stem_ascii},
+  {"italian", ENC_UTF_8, italian_UTF_8_create_env_with_allocator, italian_UTF_8_close_env, italian_UTF_8_stem, italian_UTF_8_stem_ascii},
+  {"kraaij_pohlmann", ENC_UTF_8, dutch_UTF_8_create_env_with_allocator, dutch_UTF_8_close_env, dutch_UTF_8_stem, dutch_UTF_8_stem_ascii},
+  {"lit", ENC_UTF_8, lithuanian_UTF_8_create_env_with_allocator, lithuanian_UTF_8_close_env, lithuanian_UTF_8_stem, lithuanian_UTF_8_stem_ascii},
+  {"lithuanian", ENC_UTF_8, lithuanian_UTF_8_create_env_with_allocator, lithuanian_UTF_8_close_env, lithuanian_UTF_8_stem, lithuanian_UTF_8_stem_ascii},
+  {"lt", ENC_UTF_8, lithuanian_UTF_8_create_env_with_allocator, lithuanian_UTF_8_close_env, lithuanian_UTF_8_stem, lithuanian_UTF_8_stem_ascii},
+  {"ne", ENC_UTF_8, nepali_UTF_8_create_env_with_allocator, nepali_UTF_8_close_env, nepali_UTF_8_stem, nepali_UTF_8_stem_ascii},
+  {"nep", ENC_UTF_8, nepali_UTF_8_create_env_with_allocator, nepali_UTF_8_close_env, nepali_UTF_8_stem, nepali_UTF_8_stem_ascii},
+  {"nepali", ENC_UTF_8, nepali_UTF_8_create_env_with_allocator, nepali_UTF_8_close_env, nepali_UTF_8_stem, nepali_UTF_8_stem_ascii},
+  {"nl", ENC_UTF_8, dutch_UTF_8_create_env_with_allocator, dutch_UTF_8_close_env, dutch_UTF_8_stem, dutch_UTF_8_stem_ascii},
+  {"nld", ENC_UTF_8, dutch_UTF_8_create_env_with_allocator, dutch_UTF_8_close_env, dutch_UTF_8_stem, dutch_UTF_8_stem_ascii},
+  {"no", ENC_UTF_8, norwegian_UTF_8_create_env_with_allocator, norwegian_UTF_8_close_env, norwegian_UTF_8_stem, norwegian_UTF_8_stem_ascii},
+  {"nor", ENC_UTF_8, norwegian_UTF_8_create_env_with_allocator, norwegian_UTF_8_close_env, norwegian_UTF_8_stem, norwegian_UTF_8_stem_ascii},
+  {"norwegian", ENC_UTF_8, norwegian_UTF_8_create_env_with_allocator, norwegian_UTF_8_close_env, norwegian_UTF_8_stem, norwegian_UTF_8_stem_ascii},
+  {"pers", ENC_UTF_8, persian_UTF_8_create_env_with_allocator, persian_UTF_8_close_env, persian_UTF_8_stem, persian_UTF_8_stem_ascii},
+  {"persian", ENC_UTF_8, persian_UTF_8_create_env_with_allocator, persian_UTF_8_close_env, persian_UTF_8_stem, persian_UTF_8_stem_ascii},
+  {"pl", ENC_UTF_8, polish_UTF_8_create_env_with_allocator, polish_UTF_8_close_env, polish_UTF_8_stem, polish_UTF_8_stem_ascii},
+  {"pol", ENC_UTF_8, polish_UTF_8_create_env_with_allocator, polish_UTF_8_close_env, polish_UTF_8_stem, polish_UTF_8_stem_ascii},
+  {"polish", ENC_UTF_8, polish_UTF_8_create_env_with_allocator, polish_UTF_8_close_env, polish_UTF_8_stem, polish_UTF_8_stem_ascii},
+  {"por", ENC_UTF_8, portuguese_UTF_8_create_env_with_allocator, portuguese_UTF_8_close_env, portuguese_UTF_8_stem, portuguese_UTF_8_stem_ascii},
+  {"porter", ENC_UTF_8, porter_UTF_8_create_env_with_allocator, porter_UTF_8_close_env, porter_UTF_8_stem, porter_UTF_8_stem_ascii},
+  {"portuguese", ENC_UTF_8, portuguese_UTF_8_create_env_with_allocator, portuguese_UTF_8_close_env, portuguese_UTF_8_stem, portuguese_UTF_8_stem_ascii},
+  {"pt", ENC_UTF_8, portuguese_UTF_8_create_env_with_allocator, portuguese_UTF_8_close_env, portuguese_UTF_8_stem, portuguese_UTF_8_stem_ascii},
+  {"ro", ENC_UTF_8, romanian_UTF_8_create_env_with_allocator, romanian_UTF_8_close_env, romanian_UTF_8_stem, romanian_UTF_8_stem_ascii},
+  {"romanian", ENC_UTF_8, romanian_UTF_8_create_env_with_allocator, romanian_UTF_8_close_env, romanian_UTF_8_stem, romanian_UTF_8_stem_ascii},
+  {"ron", ENC_UTF_8, romanian_UTF_8_create_env_with_allocator, romanian_UTF_8_close_env, romanian_UTF_8_stem, romanian_UTF_8_stem_ascii},
+  {"ru", ENC_UTF_8, russian_UTF_8_create_env_with_allocator, russian_UTF_8_close_env, russian_UTF_8_stem, russian_UTF_8_stem_ascii},
+  {"rum", ENC_UTF_8, romanian_UTF_8_create_env_with_allocator, romanian_UTF_8_close_env, romanian_UTF_8_stem, romanian_UTF_8_stem_ascii},
+  {"rus", ENC_UTF_8, russian_UTF_8_create_env_with_allocator, russian_UTF_8_close_env, russian_UTF_8_stem, russian_UTF_8_stem_ascii},
+  {"russian", ENC_UTF_8, russian_UTF_8_create_env_with_allocator, russian_UTF_8_close_env, russian_UTF_8_stem, russian_UTF_8_stem_ascii},
+  {"serbian", ENC_UTF_8, serbian_UTF_8_create_env_with_allocator, serbian_UTF_8_close_env, serbian_UTF_8_stem, serbian_UTF_8_stem_ascii},
+  {"spa", ENC_UTF_8, spanish_UTF_8_create_env_with_allocator, spanish_UTF_8_close_env, spanish_UTF_8_stem, spanish_UTF_8_stem_ascii},
+  {"spanish", ENC_UTF_8, spanish_UTF_8_create_env_with_allocator, spanish_UTF_8_close_env, spanish_UTF_8_stem, spanish_UTF_8_stem_ascii},
+  {"sr", ENC_UTF_8, serbian_UTF_8_create_env_with_allocator, serbian_UTF_8_close_env, serbian_UTF_8_stem, serbian_UTF_8_stem_ascii},
+  {"srp", ENC_UTF_8, serbian_UTF_8_create_env_with_allocator, serbian_UTF_8_close_env, serbian_UTF_8_stem, serbian_UTF_8_stem_ascii},
+  {"sv", ENC_UTF_8, swedish_UTF_8_create_env_with_allocator, swedish_UTF_8_close_env, swedish_UTF_8_stem, swedish_UTF_8_stem_ascii},
+  {"swe", ENC_UTF_8, swedish_UTF_8_create_env_with_allocator, swedish_UTF_8_close_env, swedish_UTF_8_stem, swedish_UTF_8_stem_ascii},
+  {"swedish", ENC_UTF_8, swedish_UTF_8_create_env_with_allocator, swedish_UTF_8_close_env, swedish_UTF_8_stem, swedish_UTF_8_stem_ascii},
+  {"ta", ENC_UTF_8, tamil_UTF_8_create_env_with_allocator, tamil_UTF_8_close_env, tamil_UTF_8_stem, tamil_UTF_8_stem_ascii},
+  {"tam", ENC_UTF_8, tamil_UTF_8_create_env_with_allocator, tamil_UTF_8_close_env, tamil_UTF_8_stem, tamil_UTF_8_stem_ascii},
+  {"tamil", ENC_UTF_8, tamil_UTF_8_create_env_with_allocator, tamil_UTF_8_close_env, tamil_UTF_8_stem, tamil_UTF_8_stem_ascii},
+  {"tr", ENC_UTF_8, turkish_UTF_8_create_env_with_allocator, turkish_UTF_8_close_env, turkish_UTF_8_stem, turkish_UTF_8_stem_ascii},
+  {"tur", ENC_UTF_8, turkish_UTF_8_create_env_with_allocator, turkish_UTF_8_close_env, turkish_UTF_8_stem, turkish_UTF_8_stem_ascii},
+  {"turkish", ENC_UTF_8, turkish_UTF_8_create_env_with_allocator, turkish_UTF_8_close_env, turkish_UTF_8_stem, turkish_UTF_8_stem_ascii},
+  {"yi", ENC_UTF_8, yiddish_UTF_8_create_env_with_allocator, yiddish_UTF_8_close_env, yiddish_UTF_8_stem, yiddish_UTF_8_stem_ascii},
+  {"yid", ENC_UTF_8, yiddish_UTF_8_create_env_with_allocator, yiddish_UTF_8_close_env, yiddish_UTF_8_stem, yiddish_UTF_8_stem_ascii},
+  {"yiddish", ENC_UTF_8, yiddish_UTF_8_create_env_with_allocator, yiddish_UTF_8_close_env, yiddish_UTF_8_stem, yiddish_UTF_8_stem_ascii},
+  {0,ENC_UNKNOWN,0,0,0,0}
+};
+
+/* Hash table of indices into modules (-1 for an empty slot), indexed by an
+ * FNV-1a hash of the name with linear probing.
+ */
+#define MODULE_HASH_SIZE 256
+static const short module_hash[MODULE_HASH_SIZE] = {
+  -1, 1, 83, 47, 102, -1, -1, 8,
+  -1, 2, -1, -1, 101, 24, 84, -1,
+  60, -1, -1, 44, 50, 91, 17, 21,
+  73, 63, 36, 22, 49, 23, 96, -1,
+  69, 86, 6, 87, -1, 42, -1, 105,
+  11, 107, -1, -1, -1, -1, -1, -1,
+  -1, 16, 43, -1, -1, -1, -1, 88,
+  52, 77, 53, -1, 67, 82, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, 7, 59, -1, 79, -1, -1, -1,
+  -1, 100, -1, 76, -1, -1, 10, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, 45, -1, -1, 18, 58, 99, 70,
+  33, 25, 27, 54, -1, -1, -1, -1,
+  -1, -1, 15, -1, 37, 14, 75, -1,
+  -1, 106, 29, -1, -1, -1, -1, -1,
+  -1, 34, 4, -1, 78, 41, 51, 5,
+  -1, -1, 20, 62, 85, -1, 57, 31,
+  -1, -1, -1, -1, -1, -1, -1, -1,
+  12, 19, 48, -1, -1, 9, 55, 98,
+  -1, -1, 13, -1, 68, -1, -1, 28,
+  -1, 89, -1, 74, -1, -1, -1, -1,
+  39, 103, -1, -1, 32, 3, 64, 92,
+  -1, 71, -1, 93, 104, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1,
+  35, 81, 94, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, 26,
+  56, 95, -1, 61, -1, -1, 65, 90,
+  -1, -1, -1, -1, -1, 66, -1, -1,
+  -1, 38, -1, -1, -1, -1, 80, -1,
+  -1, -1, 0, 46, 30, 40, 72, 97,
+};
+
+static const char * algorithm_names[] = {
+  "arabic", 
+  "armenian", 
+  "basque", 
+  "catalan", 
+  "danish", 
+  "dutch", 
+  "dutch_porter", 
+  "english", 
+  "esperanto", 
+  "estonian", 
+  "finnish", 
+  "french", 
+  "german", 
+  "greek", 
+  "hindi", 
+  "hungarian", 
+  "indonesian", 
+  "irish", 
+  "italian", 
+  "lithuanian", 
+  "nepali", 
+  "norwegian", 
+  "persian", 
+  "polish", 
+  "porter", 
+  "portuguese", 
+  "romanian", 
+  "russian", 
+  "serbian", 
+  "spanish", 
+  "swedish", 
+  "tamil", 
+  "turkish", 
+  "yiddish", 
+  0
+};
@@ -6,22 +6,32 @@ static const struct SN_env default_SN_env;
 
 extern struct SN_env * SN_new_env(int alloc_size)
 {
-    struct SN_env * z = (struct SN_env *) malloc(alloc_size);
+    return SN_new_env_with_allocator(alloc_size, NULL);
+}
+
+extern struct SN_env * SN_new_env_with_allocator(int alloc_size,
+                                                 const struct SN_allocator * allocator)
+{
+    struct SN_env * z;
+    if (allocator)
+        z = (struct SN_env *) allocator->allocate(allocator->context, alloc_size);
+    else
+        z = (struct SN_env *) malloc(alloc_size);
     if (z == NULL) return NULL;
     *z = default_SN_env;
-    z->p = create_s();
-    if (z->p == NULL) {
-        SN_delete_env(z);
-        return NULL;
-    }
+    z->allocator = allocator;
+    init_p(z);
     return z;
 }
 
 extern void SN_delete_env(struct SN_env * z)
 {
     if (z == NULL) return;
-    if (z->p) lose_s(z->p);
-    free(z);
+    lose_p(z);
+    if (z->allocator)
+        z->allocator->release(z->allocator->context, z);
+    else
+        free(z);
 }
 
 extern int SN_set_current(struct SN_env * z, int size, const symbol * s)
@@ -30,3 +40,33 @@ extern int SN_set_current(struct SN_env * z, int size, const symbol * s)
     z->c = 0;
     return err;
 }
+
+/* Make the caller's buffer p (holding a word of size symbols, with room for
+   capacity symbols) the current string, so it is stemmed in place.  p must
+   have HEAD bytes before it which can be used for the size and capacity,
+   and be suitably aligned for an int.  If the string needs to grow beyond
+   capacity, it is moved to the runtime's own buffer, which is kept for
+   this and for use again after SN_release_current().
+*/
+extern void SN_adopt_current(struct SN_env * z, symbol * p, int size, int capacity)
+{
+    z->saved_p = z->p;
+    CAPACITY(p) = capacity;
+    SET_SIZE(p, size);
+    z->p = p;
+    z->external = p;
+    z->l = size;
+    z->c = 0;
+}
+
+/* Stop using the buffer passed to SN_adopt_current(). */
+extern void SN_release_current(struct SN_env * z)
+{
+    if (z->p == z->external) {
+        z->p = z->saved_p;
+        SET_SIZE(z->p, 0);
+        z->c = z->l = 0;
+    }
+    z->external = NULL;
+    z->saved_p = NULL;
+}
@@ -1,21 +1,84 @@
 #ifndef SNOWBALL_API_H_INCLUDED
 #define SNOWBALL_API_H_INCLUDED
 
+#include <stddef.h> /* for size_t */
+
+/* Code generated with -widechars defines SNOWBALL_WIDECHARS to use 16 bit
+   symbols (e.g. for UTF-16).
+
+   Note that sizeof(symbol) should divide HEAD, defined in snowball_runtime.h
+   as 2*sizeof(int), without remainder, otherwise there is an alignment
+   problem. In the unlikely event of a problem here, consult Martin Porter.
+*/
+#ifdef SNOWBALL_WIDECHARS
+typedef unsigned short symbol;
+#else
 typedef unsigned char symbol;
+#endif
 
-/* Or replace 'char' above with 'short' for 16 bit characters.
+/* The runtime can be compiled both ways and linked into the same program
+   (libstemmer does this for its UTF-16 stemmers), so the 16 bit versions of
+   its functions have names ending _w.  The functions in snowball_runtime.h
+   are renamed there.
+*/
+#ifdef SNOWBALL_WIDECHARS
+# define SN_new_env SN_new_env_w
+# define SN_new_env_with_allocator SN_new_env_with_allocator_w
+# define SN_delete_env SN_delete_env_w
+# define SN_set_current SN_set_current_w
+# define SN_reserve SN_reserve_w
+# define SN_adopt_current SN_adopt_current_w
+# define SN_release_current SN_release_current_w
+#endif
 
-   More precisely, replace 'char' with whatever type guarantees the
-   character width you need. Note however that sizeof(symbol) should divide
-   HEAD, defined in snowball_runtime.h as 2*sizeof(int), without remainder,
-   otherwise there is an alignment problem. In the unlikely event of a problem
-   here, consult Martin Porter.
+/* The number of symbols which p can hold before it needs to be moved from
+   the buffer inside struct SN_env to one allocated on the heap.  Most words
+   fit, so stemming them doesn't need to allocate any memory.
 */
+#ifndef SN_INLINE_SIZE
+# define SN_INLINE_SIZE 64
+#endif
+
+/* Functions used to allocate memory for a struct SN_env and its strings in
+   place of malloc(), realloc() and free().  Each is passed context as its
+   first argument.
+*/
+struct SN_allocator {
+    void * (*allocate)(void * context, size_t size);
+    void * (*reallocate)(void * context, void * p, size_t size);
+    void (*release)(void * context, void * p);
+    void * context;
+};
+
+/* Counters updated by the runtime if it is compiled with SNOWBALL_STATS
+   defined.
+*/
+struct SN_stats {
+    /* Number of times a buffer has been allocated or reallocated to grow. */
+    unsigned long reallocs;
+    /* Number of calls to find_among() and find_among_b(). */
+    unsigned long among_calls;
+};
 
 struct SN_env {
     symbol * p;
     int c; int l; int lb; int bra; int ket;
     int af;
+    /* The allocator to use, or NULL to use malloc(), realloc() and free(). */
+    const struct SN_allocator * allocator;
+    /* Buffer supplied by the caller which p is using (see
+       SN_adopt_current()), or NULL. */
+    symbol * external;
+    /* The runtime's own buffer for p, which is kept while p is using
+       external, or NULL. */
+    symbol * saved_p;
+    /* Counters to update (if compiled with SNOWBALL_STATS), or NULL. */
+    struct SN_stats * stats;
+    /* Initial buffer for p: the capacity and size header (see HEAD in
+       snowball_runtime.h) followed by room for SN_INLINE_SIZE symbols and
+       a terminating zero.
+    */
+    int inline_buf[2 + (SN_INLINE_SIZE * sizeof(symbol) + sizeof(int)) / sizeof(int)];
 };
 
 #ifdef __cplusplus
@@ -23,9 +86,14 @@ extern "C" {
 #endif
 
 extern struct SN_env * SN_new_env(int alloc_size);
+extern struct SN_env * SN_new_env_with_allocator(int alloc_size,
+                                                 const struct SN_allocator * allocator);
 extern void SN_delete_env(struct SN_env * z);
 
 extern int SN_set_current(struct SN_env * z, int size, const symbol * s);
+extern int SN_reserve(struct SN_env * z, int n);
+extern void SN_adopt_current(struct SN_env * z, symbol * p, int size, int capacity);
+extern void SN_release_current(struct SN_env * z);
 
 #ifdef __cplusplus
 }
@@ -1,6 +1,8 @@
 #ifndef SNOWBALL_INCLUDED_SNOWBALL_RUNTIME_H
 #define SNOWBALL_INCLUDED_SNOWBALL_RUNTIME_H
 
+#include <stdio.h>
+
 #include "api.h"
 
 #define HEAD 2*sizeof(int)
@@ -16,6 +18,13 @@
 # define CAPACITY(p)    ((int *)(p))[-2]
 #endif
 
+/* The buffer inside struct SN_env which p initially points to. */
+#ifdef __cplusplus
+# define INLINE_P(z)    reinterpret_cast<symbol *>((z)->inline_buf + 2)
+#else
+# define INLINE_P(z)    ((symbol *)((z)->inline_buf + 2))
+#endif
+
 #ifdef SNOWBALL_RUNTIME_THROW_EXCEPTIONS
 # define SNOWBALL_ERR void
 #else
@@ -23,7 +32,6 @@
 #endif
 
 #ifdef SNOWBALL_DEBUG_COMMAND_USED
-# include <stdio.h>
 static void debug(struct SN_env * z, int n, int line) {
     int i;
     int len = SIZE(z->p);
@@ -58,6 +66,95 @@ struct among
     int function;
 };
 
+/* Compact form of an among table, generated by `-among compact`.  The
+ * strings of all the amongs in a stemmer are packed into one pool, with
+ * strings which occur inside others stored only once, and each field of
+ * struct among is stored in a separate array of the narrowest suitable type.
+ */
+struct among_compact
+{
+    const symbol * pool;
+    /* Offset of each string in pool. */
+    const unsigned short * offset;
+    const unsigned char * size;
+    const short * substring_i;
+    const unsigned char * result;
+    /* NULL if no string has a condition routine. */
+    const unsigned char * function;
+};
+
+/* Perfect hash table for looking up the strings in an among by their last
+ * symbols, generated by `-among hash`.  The hash of the last n symbols
+ * selects a bucket whose displacement gives the slot.
+ */
+struct among_hash
+{
+    /* 1 << slot_bits entries: 0 if empty, else 1 + the index of the string
+     * in the among. */
+    const unsigned short * slots;
+    /* 1 << bucket_bits entries. */
+    const unsigned short * displace;
+    unsigned long seed;
+    int slot_bits;
+    int bucket_bits;
+    /* Length of the longest string. */
+    int longest;
+    /* Bit n - 1 is set if there's a string of length n (for n <= 32). */
+    unsigned long sizes;
+};
+
+/* The 16 bit versions of these functions have different names (see api.h). */
+#ifdef SNOWBALL_WIDECHARS
+# define create_s create_s_w
+# define lose_s lose_s_w
+# define create_s_env create_s_env_w
+# define lose_s_env lose_s_env_w
+# define init_p init_p_w
+# define lose_p lose_p_w
+# define skip_utf8 skip_utf8_w
+# define skip_b_utf8 skip_b_utf8_w
+# define in_grouping_U in_grouping_U_w
+# define in_grouping_b_U in_grouping_b_U_w
+# define out_grouping_U out_grouping_U_w
+# define out_grouping_b_U out_grouping_b_U_w
+# define in_grouping_scan in_grouping_scan_w
+# define out_grouping_scan out_grouping_scan_w
+# define in_grouping_scan_U in_grouping_scan_U_w
+# define out_grouping_scan_U out_grouping_scan_U_w
+# define in_grouping_U_table in_grouping_U_table_w
+# define in_grouping_b_U_table in_grouping_b_U_table_w
+# define out_grouping_U_table out_grouping_U_table_w
+# define out_grouping_b_U_table out_grouping_b_U_table_w
+# define in_grouping in_grouping_w
+# define in_grouping_b in_grouping_b_w
+# define out_grouping out_grouping_w
+# define out_grouping_b out_grouping_b_w
+# define eq_s eq_s_w
+# define eq_s_b eq_s_b_w
+# define eq_v eq_v_w
+# define eq_v_b eq_v_b_w
+# define find_among find_among_w
+# define find_among_b find_among_b_w
+# define find_among_compact find_among_compact_w
+# define find_among_b_compact find_among_b_compact_w
+# define find_among_b_hash find_among_b_hash_w
+# define find_among_counted find_among_counted_w
+# define find_among_b_counted find_among_b_counted_w
+# define count_grouping count_grouping_w
+# define count_grouping_scan count_grouping_scan_w
+# define dump_among_counts dump_among_counts_w
+# define dump_grouping_counts dump_grouping_counts_w
+# define replace_s replace_s_w
+# define slice_from_s slice_from_s_w
+# define slice_from_v slice_from_v_w
+# define slice_del slice_del_w
+# define insert_s insert_s_w
+# define insert_v insert_v_w
+# define slice_to slice_to_w
+# define assign_to assign_to_w
+# define len_utf8 len_utf8_w
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -65,6 +162,13 @@ extern "C" {
 extern symbol * create_s(void);
 extern void lose_s(symbol * p);
 
+extern symbol * create_s_env(struct SN_env * z);
+extern void lose_s_env(struct SN_env * z, symbol * p);
+
+extern void init_p(struct SN_env * z);
+extern void lose_p(struct SN_env * z);
+
+#ifndef SNOWBALL_RUNTIME_INLINE
 extern int skip_utf8(const symbol * p, int c, int limit, int n);
 
 extern int skip_b_utf8(const symbol * p, int c, int limit, int n);
@@ -73,7 +177,19 @@ extern int in_grouping_U(struct SN_env * z, const unsigned char * s, int min, in
 extern int in_grouping_b_U(struct SN_env * z, const unsigned char * s, int min, int max, int repeat);
 extern int out_grouping_U(struct SN_env * z, const unsigned char * s, int min, int max, int repeat);
 extern int out_grouping_b_U(struct SN_env * z, const unsigned char * s, int min, int max, int repeat);
+#endif
+
+extern int in_grouping_scan(struct SN_env * z, const unsigned char * s, int min, int max, const char * chars);
+extern int out_grouping_scan(struct SN_env * z, const unsigned char * s, int min, int max, const char * chars);
+extern int in_grouping_scan_U(struct SN_env * z, const unsigned char * s, int min, int max, const char * chars);
+extern int out_grouping_scan_U(struct SN_env * z, const unsigned char * s, int min, int max, const char * chars);
 
+extern int in_grouping_U_table(struct SN_env * z, const unsigned char * s, int min, int max, int repeat);
+extern int in_grouping_b_U_table(struct SN_env * z, const unsigned char * s, int min, int max, int repeat);
+extern int out_grouping_U_table(struct SN_env * z, const unsigned char * s, int min, int max, int repeat);
+extern int out_grouping_b_U_table(struct SN_env * z, const unsigned char * s, int min, int max, int repeat);
+
+#ifndef SNOWBALL_RUNTIME_INLINE
 extern int in_grouping(struct SN_env * z, const unsigned char * s, int min, int max, int repeat);
 extern int in_grouping_b(struct SN_env * z, const unsigned char * s, int min, int max, int repeat);
 extern int out_grouping(struct SN_env * z, const unsigned char * s, int min, int max, int repeat);
@@ -88,6 +204,31 @@ extern int find_among(struct SN_env * z, const struct among * v, int v_size,
                       int (*)(struct SN_env *));
 extern int find_among_b(struct SN_env * z, const struct among * v, int v_size,
                         int (*)(struct SN_env *));
+#endif
+
+extern int find_among_compact(struct SN_env * z, const struct among_compact * v,
+                              int v_size, int (*call_among_func)(struct SN_env*));
+extern int find_among_b_compact(struct SN_env * z, const struct among_compact * v,
+                                int v_size, int (*call_among_func)(struct SN_env*));
+
+extern int find_among_b_hash(struct SN_env * z, const struct among * v,
+                             int (*call_among_func)(struct SN_env*),
+                             const struct among_hash * h);
+
+extern int find_among_counted(struct SN_env * z, const struct among * v, int v_size,
+                              int (*call_among_func)(struct SN_env*),
+                              unsigned long * counts);
+extern int find_among_b_counted(struct SN_env * z, const struct among * v, int v_size,
+                                int (*call_among_func)(struct SN_env*),
+                                unsigned long * counts);
+
+extern int count_grouping(unsigned long * counts, int ret);
+extern int count_grouping_scan(unsigned long * counts, int ret);
+
+extern void dump_among_counts(FILE * f, const struct among * v, int v_size,
+                              const unsigned long * counts);
+extern void dump_grouping_counts(FILE * f, const unsigned char * s, int min, int max,
+                                 const unsigned long * counts);
 
 extern SNOWBALL_ERR replace_s(struct SN_env * z, int c_bra, int c_ket, int s_size, const symbol * s);
 extern SNOWBALL_ERR slice_from_s(struct SN_env * z, int s_size, const symbol * s);
@@ -106,4 +247,8 @@ extern int len_utf8(const symbol * p);
 }
 #endif
 
+#ifdef SNOWBALL_RUNTIME_INLINE
+# include "snowball_runtime_inline.h"
+#endif
+
 #endif
@@ -0,0 +1,505 @@
+#ifndef SNOWBALL_INCLUDED_SNOWBALL_RUNTIME_INLINE_H
+#define SNOWBALL_INCLUDED_SNOWBALL_RUNTIME_INLINE_H
+
+/* Definitions of the runtime functions which generated code calls most
+ * often: moving over UTF-8 characters, testing groupings, comparing strings
+ * and find_among().  utilities.c includes this to compile them as normal
+ * external functions.  If SNOWBALL_RUNTIME_INLINE is defined (which the
+ * compiler's -inline-runtime option does at the top of the generated code)
+ * then snowball_runtime.h includes this instead of declaring them, and they
+ * are static inline functions in each stemmer, so the C compiler can
+ * specialise them for their constant arguments.
+ */
+
+#include <string.h>
+
+#include "snowball_runtime.h"
+
+#if defined __cplusplus || (defined __STDC_VERSION__ && __STDC_VERSION__ >= 199901L)
+# define SN_RUNTIME_STATIC static inline
+#elif defined __GNUC__
+# define SN_RUNTIME_STATIC static __inline__
+#elif defined _MSC_VER
+# define SN_RUNTIME_STATIC static __inline
+#else
+# define SN_RUNTIME_STATIC static
+#endif
+
+#ifdef SNOWBALL_RUNTIME_INLINE
+# define SN_RUNTIME_API SN_RUNTIME_STATIC
+#else
+# define SN_RUNTIME_API extern
+#endif
+
+#ifdef SNOWBALL_STATS
+# define COUNT_STAT(Z, F) do { if ((Z)->stats) ++(Z)->stats->F; } while (0)
+#else
+# define COUNT_STAT(Z, F) ((void)0)
+#endif
+
+/* Increment counter C (as collected by -coverage code).  The counters for a
+ * stemmer are shared by all threads using it, so this uses an atomic
+ * increment (without ordering, which counting doesn't need) where we know
+ * how.  Otherwise counts may be lost if several threads are stemming.
+ */
+#if defined __ATOMIC_RELAXED
+# define SN_COUNT(C) ((void)__atomic_fetch_add(&(C), 1, __ATOMIC_RELAXED))
+#elif defined _MSC_VER
+/* unsigned long and long are the same size for MSVC. */
+# include <intrin.h>
+# define SN_COUNT(C) ((void)_InterlockedIncrement((volatile long *)&(C)))
+#else
+# define SN_COUNT(C) ((void)++(C))
+#endif
+
+/*
+   new_p = skip_utf8(p, c, l, n); skips n characters forwards from p + c.
+   new_p is the new position, or -1 on failure.
+
+   -- used to implement hop and next in the utf8 case.
+*/
+
+SN_RUNTIME_API int skip_utf8(const symbol * p, int c, int limit, int n) {
+    int b;
+    if (n < 0) return -1;
+    for (; n > 0; n--) {
+        if (c >= limit) return -1;
+        b = p[c++];
+        if (b >= 0xC0) {   /* 1100 0000 */
+            while (c < limit) {
+                b = p[c];
+                if (b >= 0xC0 || b < 0x80) break;
+                /* break unless b is 10------ */
+                c++;
+            }
+        }
+    }
+    return c;
+}
+
+/*
+   new_p = skip_b_utf8(p, c, lb, n); skips n characters backwards from p + c - 1
+   new_p is the new position, or -1 on failure.
+
+   -- used to implement hop and next in the utf8 case.
+*/
+
+SN_RUNTIME_API int skip_b_utf8(const symbol * p, int c, int limit, int n) {
+    int b;
+    if (n < 0) return -1;
+    for (; n > 0; n--) {
+        if (c <= limit) return -1;
+        b = p[--c];
+        if (b >= 0x80) {   /* 1000 0000 */
+            while (c > limit) {
+                b = p[c];
+                if (b >= 0xC0) break; /* 1100 0000 */
+                c--;
+            }
+        }
+    }
+    return c;
+}
+
+/* Code for character groupings: utf8 cases */
+
+SN_RUNTIME_STATIC int get_utf8(const symbol * p, int c, int l, int * slot) {
+    int b0, b1, b2;
+    if (c >= l) return 0;
+    b0 = p[c++];
+    if (b0 < 0xC0 || c == l) {   /* 1100 0000 */
+        *slot = b0;
+        return 1;
+    }
+    b1 = p[c++] & 0x3F;
+    if (b0 < 0xE0 || c == l) {   /* 1110 0000 */
+        *slot = (b0 & 0x1F) << 6 | b1;
+        return 2;
+    }
+    b2 = p[c++] & 0x3F;
+    if (b0 < 0xF0 || c == l) {   /* 1111 0000 */
+        *slot = (b0 & 0xF) << 12 | b1 << 6 | b2;
+        return 3;
+    }
+    *slot = (b0 & 0x7) << 18 | b1 << 12 | b2 << 6 | (p[c] & 0x3F);
+    return 4;
+}
+
+SN_RUNTIME_STATIC int get_b_utf8(const symbol * p, int c, int lb, int * slot) {
+    int a, b;
+    if (c <= lb) return 0;
+    b = p[--c];
+    if (b < 0x80 || c == lb) {   /* 1000 0000 */
+        *slot = b;
+        return 1;
+    }
+    a = b & 0x3F;
+    b = p[--c];
+    if (b >= 0xC0 || c == lb) {   /* 1100 0000 */
+        *slot = (b & 0x1F) << 6 | a;
+        return 2;
+    }
+    a |= (b & 0x3F) << 6;
+    b = p[--c];
+    if (b >= 0xE0 || c == lb) {   /* 1110 0000 */
+        *slot = (b & 0xF) << 12 | a;
+        return 3;
+    }
+    *slot = (p[--c] & 0x7) << 18 | (b & 0x3F) << 12 | a;
+    return 4;
+}
+
+#ifdef SNOWBALL_COVERAGE
+SN_RUNTIME_STATIC void report_coverage(const unsigned char * s, int min, int max, int ch, const unsigned char * p, int w) {
+    int i = 0;
+    int outof = 0;
+    /* Adjust ch be an offset from min if it's past the end of the range.  If
+     * we already subtracted min then this will condition will be false.  Only
+     * needed for the "out" case but the condition can never be true for the
+     * "in" case.
+     */
+    if (ch > max) ch -= min;
+    /* Find the index of this character in the grouping. */
+    for (int j = 0; j != max - min; ++j) {
+        if (s[j >> 3] & (0X1 << (j & 0X7))) {
+            ++outof;
+            if (j < ch) ++i;
+        }
+    }
+    s += (max - min + 8) / 8;
+    fprintf(stderr, "%s index %d of %d '%.*s'\n", s, i, outof + 1, w, p);
+}
+
+SN_RUNTIME_STATIC void report_coverage_nomatch(const unsigned char * s, int min, int max) {
+    s += (max - min + 8) / 8;
+    fprintf(stderr, "%s no match\n", s);
+}
+#endif
+
+SN_RUNTIME_API int in_grouping_U(struct SN_env * z, const unsigned char * s, int min, int max, int repeat) {
+    do {
+        int ch;
+        int w = get_utf8(z->p, z->c, z->l, & ch);
+        if (!w) return -1;
+        if (ch > max || (ch -= min) < 0 || (s[ch >> 3] & (0X1 << (ch & 0X7))) == 0) {
+#ifdef SNOWBALL_COVERAGE
+            report_coverage_nomatch(s, min, max);
+#endif
+            return w;
+        }
+#ifdef SNOWBALL_COVERAGE
+        report_coverage(s, min, max, ch, z->p + z->c, w);
+#endif
+        z->c += w;
+    } while (repeat);
+    return 0;
+}
+
+SN_RUNTIME_API int in_grouping_b_U(struct SN_env * z, const unsigned char * s, int min, int max, int repeat) {
+    do {
+        int ch;
+        int w = get_b_utf8(z->p, z->c, z->lb, & ch);
+        if (!w) return -1;
+        if (ch > max || (ch -= min) < 0 || (s[ch >> 3] & (0X1 << (ch & 0X7))) == 0) {
+#ifdef SNOWBALL_COVERAGE
+            report_coverage_nomatch(s, min, max);
+#endif
+            return w;
+        }
+#ifdef SNOWBALL_COVERAGE
+        report_coverage(s, min, max, ch, z->p + z->c - w, w);
+#endif
+        z->c -= w;
+    } while (repeat);
+    return 0;
+}
+
+SN_RUNTIME_API int out_grouping_U(struct SN_env * z, const unsigned char * s, int min, int max, int repeat) {
+    do {
+        int ch;
+        int w = get_utf8(z->p, z->c, z->l, & ch);
+        if (!w) return -1;
+        if (!(ch > max || (ch -= min) < 0 || (s[ch >> 3] & (0X1 << (ch & 0X7))) == 0)) {
+#ifdef SNOWBALL_COVERAGE
+            report_coverage(s, min, max, ch, z->p + z->c, w);
+#endif
+            return w;
+        }
+#ifdef SNOWBALL_COVERAGE
+        report_coverage_nomatch(s, min, max);
+#endif
+        z->c += w;
+    } while (repeat);
+    return 0;
+}
+
+SN_RUNTIME_API int out_grouping_b_U(struct SN_env * z, const unsigned char * s, int min, int max, int repeat) {
+    do {
+        int ch;
+        int w = get_b_utf8(z->p, z->c, z->lb, & ch);
+        if (!w) return -1;
+        if (!(ch > max || (ch -= min) < 0 || (s[ch >> 3] & (0X1 << (ch & 0X7))) == 0)) {
+#ifdef SNOWBALL_COVERAGE
+            report_coverage(s, min, max, ch, z->p + z->c - w, w);
+#endif
+            return w;
+        }
+#ifdef SNOWBALL_COVERAGE
+        report_coverage_nomatch(s, min, max);
+#endif
+        z->c -= w;
+    } while (repeat);
+    return 0;
+}
+
+/* Code for character groupings: non-utf8 cases */
+
+SN_RUNTIME_API int in_grouping(struct SN_env * z, const unsigned char * s, int min, int max, int repeat) {
+    do {
+        int ch;
+        if (z->c >= z->l) return -1;
+        ch = z->p[z->c];
+        if (ch > max || (ch -= min) < 0 || (s[ch >> 3] & (0X1 << (ch & 0X7))) == 0)
+            return 1;
+        z->c++;
+    } while (repeat);
+    return 0;
+}
+
+SN_RUNTIME_API int in_grouping_b(struct SN_env * z, const unsigned char * s, int min, int max, int repeat) {
+    do {
+        int ch;
+        if (z->c <= z->lb) return -1;
+        ch = z->p[z->c - 1];
+        if (ch > max || (ch -= min) < 0 || (s[ch >> 3] & (0X1 << (ch & 0X7))) == 0)
+            return 1;
+        z->c--;
+    } while (repeat);
+    return 0;
+}
+
+SN_RUNTIME_API int out_grouping(struct SN_env * z, const unsigned char * s, int min, int max, int repeat) {
+    do {
+        int ch;
+        if (z->c >= z->l) return -1;
+        ch = z->p[z->c];
+        if (!(ch > max || (ch -= min) < 0 || (s[ch >> 3] & (0X1 << (ch & 0X7))) == 0))
+            return 1;
+        z->c++;
+    } while (repeat);
+    return 0;
+}
+
+SN_RUNTIME_API int out_grouping_b(struct SN_env * z, const unsigned char * s, int min, int max, int repeat) {
+    do {
+        int ch;
+        if (z->c <= z->lb) return -1;
+        ch = z->p[z->c - 1];
+        if (!(ch > max || (ch -= min) < 0 || (s[ch >> 3] & (0X1 << (ch & 0X7))) == 0))
+            return 1;
+        z->c--;
+    } while (repeat);
+    return 0;
+}
+
+SN_RUNTIME_API int eq_s(struct SN_env * z, int s_size, const symbol * s) {
+    if (z->l - z->c < s_size || memcmp(z->p + z->c, s, s_size * sizeof(symbol)) != 0) return 0;
+    z->c += s_size; return 1;
+}
+
+SN_RUNTIME_API int eq_s_b(struct SN_env * z, int s_size, const symbol * s) {
+    if (z->c - z->lb < s_size || memcmp(z->p + z->c - s_size, s, s_size * sizeof(symbol)) != 0) return 0;
+    z->c -= s_size; return 1;
+}
+
+SN_RUNTIME_API int eq_v(struct SN_env * z, const symbol * p) {
+    return eq_s(z, SIZE(p), p);
+}
+
+SN_RUNTIME_API int eq_v_b(struct SN_env * z, const symbol * p) {
+    return eq_s_b(z, SIZE(p), p);
+}
+
+/* Implementation of find_among(), which also counts each result in counts
+ * (if not NULL) - see find_among_counted().
+ */
+SN_RUNTIME_STATIC int find_among_i(struct SN_env * z, const struct among * v, int v_size,
+                                   int (*call_among_func)(struct SN_env*),
+                                   unsigned long * counts) {
+
+    int i = 0;
+    int j = v_size;
+
+    int c = z->c; int l = z->l;
+    const symbol * q = z->p + c;
+
+    const struct among * w;
+
+    int common_i = 0;
+    int common_j = 0;
+
+    int first_key_inspected = 0;
+
+    COUNT_STAT(z, among_calls);
+#ifdef SNOWBALL_COVERAGE
+    if (v[v_size * 2].s_size == -1)
+        fprintf(stderr, "%s: among %d no match impossible\n", v[v_size * 2].s, v[v_size].s_size);
+#endif
+    while (1) {
+        int k = i + ((j - i) >> 1);
+        int diff = 0;
+        int common = common_i < common_j ? common_i : common_j; /* smaller */
+        w = v + k;
+        {
+            int i2; for (i2 = common; i2 < w->s_size; i2++) {
+                if (c + common == l) { diff = -1; break; }
+                diff = q[common] - w->s[i2];
+                if (diff != 0) break;
+                common++;
+            }
+        }
+        if (diff < 0) {
+            j = k;
+            common_j = common;
+        } else {
+            i = k;
+            common_i = common;
+        }
+        if (j - i <= 1) {
+            if (i > 0) break; /* v->s has been inspected */
+            if (j == i) break; /* only one item in v */
+
+            /* - but now we need to go round once more to get
+               v->s inspected. This looks messy, but is actually
+               the optimal approach.  */
+
+            if (first_key_inspected) break;
+            first_key_inspected = 1;
+        }
+    }
+    w = v + i;
+    while (1) {
+        if (common_i >= w->s_size) {
+            z->c = c + w->s_size;
+#ifdef SNOWBALL_COVERAGE
+            fprintf(stderr, "%s: among %d : %d of %d string '%.*s'\n", w[v_size].s, w[v_size].s_size, w[v_size].result, v_size, w->s_size, w->s);
+#endif
+            if (!w->function) {
+                if (counts) SN_COUNT(counts[w - v]);
+                return w->result;
+            }
+            z->af = w->function;
+            if (call_among_func(z)) {
+                z->c = c + w->s_size;
+#ifdef SNOWBALL_COVERAGE
+                fprintf(stderr, "%s: among %d : %d of %d func-t '%.*s'\n", w[v_size].s, w[v_size].s_size, w[v_size].result, v_size, w->s_size, w->s);
+#endif
+                if (counts) SN_COUNT(counts[w - v]);
+                return w->result;
+            }
+#ifdef SNOWBALL_COVERAGE
+            fprintf(stderr, "%s: among %d : %d of %d func-f '%.*s'\n", w[v_size].s, w[v_size].s_size, w[v_size].result, v_size, w->s_size, w->s);
+#endif
+        }
+        if (!w->substring_i) {
+#ifdef SNOWBALL_COVERAGE
+            fprintf(stderr, "%s: among %d no match\n", v[v_size * 2].s, v[v_size * 2].s_size);
+#endif
+            if (counts) SN_COUNT(counts[v_size]);
+            return 0;
+        }
+        w += w->substring_i;
+    }
+}
+
+SN_RUNTIME_API int find_among(struct SN_env * z, const struct among * v, int v_size,
+                              int (*call_among_func)(struct SN_env*)) {
+    return find_among_i(z, v, v_size, call_among_func, NULL);
+}
+
+/* find_among_b is for backwards processing. Same comments apply */
+SN_RUNTIME_STATIC int find_among_b_i(struct SN_env * z, const struct among * v, int v_size,
+                                     int (*call_among_func)(struct SN_env*),
+                                     unsigned long * counts) {
+
+    int i = 0;
+    int j = v_size;
+
+    int c = z->c; int lb = z->lb;
+    const symbol * q = z->p + c - 1;
+
+    const struct among * w;
+
+    int common_i = 0;
+    int common_j = 0;
+
+    int first_key_inspected = 0;
+
+    COUNT_STAT(z, among_calls);
+#ifdef SNOWBALL_COVERAGE
+    if (v[v_size * 2].s_size == -1)
+        fprintf(stderr, "%s: among %d no match impossible\n", v[v_size * 2].s, v[v_size].s_size);
+#endif
+    while (1) {
+        int k = i + ((j - i) >> 1);
+        int diff = 0;
+        int common = common_i < common_j ? common_i : common_j;
+        w = v + k;
+        {
+            int i2; for (i2 = w->s_size - 1 - common; i2 >= 0; i2--) {
+                if (c - common == lb) { diff = -1; break; }
+                diff = q[- common] - w->s[i2];
+                if (diff != 0) break;
+                common++;
+            }
+        }
+        if (diff < 0) { j = k; common_j = common; }
+                 else { i = k; common_i = common; }
+        if (j - i <= 1) {
+            if (i > 0) break;
+            if (j == i) break;
+            if (first_key_inspected) break;
+            first_key_inspected = 1;
+        }
+    }
+    w = v + i;
+    while (1) {
+        if (common_i >= w->s_size) {
+            z->c = c - w->s_size;
+#ifdef SNOWBALL_COVERAGE
+            fprintf(stderr, "%s: among %d : %d of %d string '%.*s'\n", w[v_size].s, w[v_size].s_size, w[v_size].result, v_size, w->s_size, w->s);
+#endif
+            if (!w->function) {
+                if (counts) SN_COUNT(counts[w - v]);
+                return w->result;
+            }
+            z->af = w->function;
+            if (call_among_func(z)) {
+#ifdef SNOWBALL_COVERAGE
+                fprintf(stderr, "%s: among %d : %d of %d func-t '%.*s'\n", w[v_size].s, w[v_size].s_size, w[v_size].result, v_size, w->s_size, w->s);
+#endif
+                z->c = c - w->s_size;
+                if (counts) SN_COUNT(counts[w - v]);
+                return w->result;
+            }
+#ifdef SNOWBALL_COVERAGE
+            fprintf(stderr, "%s: among %d : %d of %d func-f '%.*s'\n", w[v_size].s, w[v_size].s_size, w[v_size].result, v_size, w->s_size, w->s);
+#endif
+        }
+        if (!w->substring_i) {
+#ifdef SNOWBALL_COVERAGE
+            fprintf(stderr, "%s: among %d no match\n", v[v_size * 2].s, v[v_size * 2].s_size);
+#endif
+            if (counts) SN_COUNT(counts[v_size]);
+            return 0;
+        }
+        w += w->substring_i;
+    }
+}
+
+SN_RUNTIME_API int find_among_b(struct SN_env * z, const struct among * v, int v_size,
+                                int (*call_among_func)(struct SN_env*)) {
+    return find_among_b_i(z, v, v_size, call_among_func, NULL);
+}
+
+#endif
@@ -3,7 +3,30 @@
 #include <stdlib.h>
 #include <string.h>
 
+/* The functions in snowball_runtime_inline.h are compiled here as external
+ * functions for stemmers which don't inline them. */
+#undef SNOWBALL_RUNTIME_INLINE
 #include "snowball_runtime.h"
+#include "snowball_runtime_inline.h"
+
+/* Use SIMD to skip runs of ASCII in grouping scans if we can.  This works on
+ * bytes, so isn't used for 16 bit symbols. */
+#if defined SNOWBALL_WIDECHARS
+#elif defined __SSE2__ || defined _M_X64 || (defined _M_IX86_FP && _M_IX86_FP >= 2)
+# include <emmintrin.h>
+# define SN_HAVE_SSE2
+#elif defined __ARM_NEON && defined __aarch64__
+# include <arm_neon.h>
+# define SN_HAVE_NEON
+#endif
+
+/* With GCC or clang on x86 we can also use AVX2 when the CPU supports it,
+ * compiling just the function which uses it for AVX2. */
+#if defined SN_HAVE_SSE2 && (defined __x86_64__ || defined __i386__) && \
+    (defined __clang__ || __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+# include <immintrin.h>
+# define SN_HAVE_AVX2
+#endif
 
 #ifdef SNOWBALL_RUNTIME_THROW_EXCEPTIONS
 # include <new>
@@ -22,9 +45,24 @@
 
 #define CREATE_SIZE 1
 
-extern symbol * create_s(void) {
+/* Allocate, reallocate and free memory using allocator a, or malloc(),
+ * realloc() and free() if a is NULL.
+ */
+static void * allocate(const struct SN_allocator * a, size_t size) {
+    return a ? a->allocate(a->context, size) : malloc(size);
+}
+
+static void * reallocate(const struct SN_allocator * a, void * p, size_t size) {
+    return a ? a->reallocate(a->context, p, size) : realloc(p, size);
+}
+
+static void release(const struct SN_allocator * a, void * p) {
+    if (a) a->release(a->context, p); else free(p);
+}
+
+static symbol * create_s_a(const struct SN_allocator * a) {
     symbol * p;
-    void * mem = malloc(HEAD + (CREATE_SIZE + 1) * sizeof(symbol));
+    void * mem = allocate(a, HEAD + (CREATE_SIZE + 1) * sizeof(symbol));
     if (mem == NULL)
         SNOWBALL_RETURN_OR_THROW(NULL, std::bad_alloc());
     p = (symbol *) (HEAD + (char *) mem);
@@ -33,308 +71,319 @@ extern symbol * create_s(void) {
     return p;
 }
 
+extern symbol * create_s(void) {
+    return create_s_a(NULL);
+}
+
 extern void lose_s(symbol * p) {
     if (p == NULL) return;
     free((char *) p - HEAD);
 }
 
-/*
-   new_p = skip_utf8(p, c, l, n); skips n characters forwards from p + c.
-   new_p is the new position, or -1 on failure.
+/* Create a string using z's allocator. */
+extern symbol * create_s_env(struct SN_env * z) {
+    return create_s_a(z->allocator);
+}
 
-   -- used to implement hop and next in the utf8 case.
-*/
+/* Free a string created by create_s_env(). */
+extern void lose_s_env(struct SN_env * z, symbol * p) {
+    if (p == NULL) return;
+    release(z->allocator, (char *) p - HEAD);
+}
 
-extern int skip_utf8(const symbol * p, int c, int limit, int n) {
-    int b;
-    if (n < 0) return -1;
-    for (; n > 0; n--) {
-        if (c >= limit) return -1;
-        b = p[c++];
-        if (b >= 0xC0) {   /* 1100 0000 */
-            while (c < limit) {
-                b = p[c];
-                if (b >= 0xC0 || b < 0x80) break;
-                /* break unless b is 10------ */
-                c++;
-            }
-        }
-    }
-    return c;
+/* Point z->p at the empty buffer inside z. */
+extern void init_p(struct SN_env * z) {
+    symbol * p = INLINE_P(z);
+    CAPACITY(p) = SN_INLINE_SIZE;
+    SET_SIZE(p, 0);
+    z->p = p;
 }
 
-/*
-   new_p = skip_b_utf8(p, c, lb, n); skips n characters backwards from p + c - 1
-   new_p is the new position, or -1 on failure.
+/* Free z->p if it has been moved to the heap. */
+extern void lose_p(struct SN_env * z) {
+    if (z->p != INLINE_P(z) && z->p != z->external) lose_s_env(z, z->p);
+    if (z->saved_p != NULL && z->saved_p != INLINE_P(z)) lose_s_env(z, z->saved_p);
+}
 
-   -- used to implement hop and next in the utf8 case.
-*/
 
-extern int skip_b_utf8(const symbol * p, int c, int limit, int n) {
-    int b;
-    if (n < 0) return -1;
-    for (; n > 0; n--) {
-        if (c <= limit) return -1;
-        b = p[--c];
-        if (b >= 0x80) {   /* 1000 0000 */
-            while (c > limit) {
-                b = p[c];
-                if (b >= 0xC0) break; /* 1100 0000 */
-                c--;
+/* Code for scanning forwards over characters in (or not in) a grouping for
+ * `gopast` and `goto`, which the compiler uses for groupings of at most 16
+ * ASCII characters, listed in chars.  These return the same as calling
+ * in_grouping() etc with repeat set, but skip 16 bytes (or 32 with AVX2) at
+ * a time while they are all ASCII and all in (or not in) the grouping.
+ * Anything else is left to the functions above, one character at a time.
+ */
+
+#if defined SN_HAVE_SSE2 || defined SN_HAVE_NEON
+# ifdef SN_HAVE_AVX2
+/* Return non-zero if the CPU supports AVX2.  The result is cached (it's
+ * the same whichever thread gets there first). */
+static int have_avx2(void) {
+#  ifdef __AVX2__
+    return 1;
+#  else
+    static int cached = -1;
+    if (cached < 0) {
+        __builtin_cpu_init();
+        cached = __builtin_cpu_supports("avx2") != 0;
+    }
+    return cached;
+#  endif
+}
+
+/* As scan_ascii() below, but in blocks of 32 bytes. */
+__attribute__((target("avx2")))
+static int scan_ascii_avx2(const symbol * p, int n, const char * chars, int in) {
+    int i;
+    for (i = 0; i + 32 <= n; i += 32) {
+        const char * q;
+        __m256i v = _mm256_loadu_si256((const __m256i *)(p + i));
+        __m256i match = _mm256_setzero_si256();
+        unsigned mask;
+        for (q = chars; *q; q++) {
+            match = _mm256_or_si256(match, _mm256_cmpeq_epi8(v, _mm256_set1_epi8(*q)));
+        }
+        mask = (unsigned)_mm256_movemask_epi8(v) |
+               ((unsigned)_mm256_movemask_epi8(match) ^ (in ? 0xFFFFFFFFU : 0));
+        if (mask) {
+            while (!(mask & 1)) {
+                mask >>= 1;
+                i++;
             }
+            break;
         }
     }
-    return c;
+    return i;
 }
+# endif
 
-/* Code for character groupings: utf8 cases */
-
-static int get_utf8(const symbol * p, int c, int l, int * slot) {
-    int b0, b1, b2;
-    if (c >= l) return 0;
-    b0 = p[c++];
-    if (b0 < 0xC0 || c == l) {   /* 1100 0000 */
-        *slot = b0;
-        return 1;
-    }
-    b1 = p[c++] & 0x3F;
-    if (b0 < 0xE0 || c == l) {   /* 1110 0000 */
-        *slot = (b0 & 0x1F) << 6 | b1;
-        return 2;
-    }
-    b2 = p[c++] & 0x3F;
-    if (b0 < 0xF0 || c == l) {   /* 1111 0000 */
-        *slot = (b0 & 0xF) << 12 | b1 << 6 | b2;
-        return 3;
+/* Return how many bytes at the start of the n bytes at p can be skipped in
+ * blocks of 16 (but possibly stopping part way through a block). */
+static int scan_ascii(const symbol * p, int n, const char * chars, int in) {
+    int i = 0;
+# ifdef SN_HAVE_AVX2
+    /* If this stops before the last 32 bytes then the loop below will stop
+     * at the same place straight away. */
+    if (have_avx2()) i = scan_ascii_avx2(p, n, chars, in);
+# endif
+    for (; i + 16 <= n; i += 16) {
+        const char * q;
+# if defined SN_HAVE_SSE2
+        __m128i v = _mm_loadu_si128((const __m128i *)(p + i));
+        __m128i match = _mm_setzero_si128();
+        int mask;
+        for (q = chars; *q; q++) {
+            match = _mm_or_si128(match, _mm_cmpeq_epi8(v, _mm_set1_epi8(*q)));
+        }
+        /* Stop at non-ASCII bytes and at bytes which end the scan. */
+        mask = _mm_movemask_epi8(v) | (_mm_movemask_epi8(match) ^ (in ? 0xFFFF : 0));
+        if (mask) {
+            while (!(mask & 1)) {
+                mask >>= 1;
+                i++;
+            }
+            break;
+        }
+# else
+        uint8x16_t v = vld1q_u8(p + i);
+        uint8x16_t match = vdupq_n_u8(0);
+        for (q = chars; *q; q++) {
+            match = vorrq_u8(match, vceqq_u8(v, vdupq_n_u8((unsigned char)*q)));
+        }
+        if (in) match = vmvnq_u8(match);
+        if (vmaxvq_u8(vorrq_u8(match, vcgeq_u8(v, vdupq_n_u8(0x80))))) break;
+# endif
     }
-    *slot = (b0 & 0x7) << 18 | b1 << 12 | b2 << 6 | (p[c] & 0x3F);
-    return 4;
+    return i;
 }
 
-static int get_b_utf8(const symbol * p, int c, int lb, int * slot) {
-    int a, b;
-    if (c <= lb) return 0;
-    b = p[--c];
-    if (b < 0x80 || c == lb) {   /* 1000 0000 */
-        *slot = b;
-        return 1;
-    }
-    a = b & 0x3F;
-    b = p[--c];
-    if (b >= 0xC0 || c == lb) {   /* 1100 0000 */
-        *slot = (b & 0x1F) << 6 | a;
-        return 2;
+# define GROUPING_SCAN(F, IN) \
+    while (1) { \
+        int ret; \
+        z->c += scan_ascii(z->p + z->c, z->l - z->c, chars, IN); \
+        ret = F(z, s, min, max, 0); \
+        if (ret) return ret; \
     }
-    a |= (b & 0x3F) << 6;
-    b = p[--c];
-    if (b >= 0xE0 || c == lb) {   /* 1110 0000 */
-        *slot = (b & 0xF) << 12 | a;
-        return 3;
-    }
-    *slot = (p[--c] & 0x7) << 18 | (b & 0x3F) << 12 | a;
-    return 4;
+#else
+# define GROUPING_SCAN(F, IN) \
+    (void)chars; \
+    return F(z, s, min, max, 1);
+#endif
+
+extern int in_grouping_scan(struct SN_env * z, const unsigned char * s, int min, int max, const char * chars) {
+    GROUPING_SCAN(in_grouping, 1)
 }
 
-#ifdef SNOWBALL_COVERAGE
-static void report_coverage(const unsigned char * s, int min, int max, int ch, const unsigned char * p, int w) {
-    int i = 0;
-    int outof = 0;
-    /* Adjust ch be an offset from min if it's past the end of the range.  If
-     * we already subtracted min then this will condition will be false.  Only
-     * needed for the "out" case but the condition can never be true for the
-     * "in" case.
-     */
-    if (ch > max) ch -= min;
-    /* Find the index of this character in the grouping. */
-    for (int j = 0; j != max - min; ++j) {
-        if (s[j >> 3] & (0X1 << (j & 0X7))) {
-            ++outof;
-            if (j < ch) ++i;
-        }
-    }
-    s += (max - min + 8) / 8;
-    fprintf(stderr, "%s index %d of %d '%.*s'\n", s, i, outof + 1, w, p);
+extern int out_grouping_scan(struct SN_env * z, const unsigned char * s, int min, int max, const char * chars) {
+    GROUPING_SCAN(out_grouping, 0)
 }
 
-static void report_coverage_nomatch(const unsigned char * s, int min, int max) {
-    s += (max - min + 8) / 8;
-    fprintf(stderr, "%s no match\n", s);
+extern int in_grouping_scan_U(struct SN_env * z, const unsigned char * s, int min, int max, const char * chars) {
+    GROUPING_SCAN(in_grouping_U, 1)
 }
-#endif
 
-extern int in_grouping_U(struct SN_env * z, const unsigned char * s, int min, int max, int repeat) {
-    do {
-        int ch;
-        int w = get_utf8(z->p, z->c, z->l, & ch);
-        if (!w) return -1;
-        if (ch > max || (ch -= min) < 0 || (s[ch >> 3] & (0X1 << (ch & 0X7))) == 0) {
-#ifdef SNOWBALL_COVERAGE
-            report_coverage_nomatch(s, min, max);
-#endif
-            return w;
-        }
-#ifdef SNOWBALL_COVERAGE
-        report_coverage(s, min, max, ch, z->p + z->c, w);
-#endif
-        z->c += w;
-    } while (repeat);
-    return 0;
+extern int out_grouping_scan_U(struct SN_env * z, const unsigned char * s, int min, int max, const char * chars) {
+    GROUPING_SCAN(out_grouping_U, 0)
 }
 
-extern int in_grouping_b_U(struct SN_env * z, const unsigned char * s, int min, int max, int repeat) {
-    do {
-        int ch;
-        int w = get_b_utf8(z->p, z->c, z->lb, & ch);
-        if (!w) return -1;
-        if (ch > max || (ch -= min) < 0 || (s[ch >> 3] & (0X1 << (ch & 0X7))) == 0) {
-#ifdef SNOWBALL_COVERAGE
-            report_coverage_nomatch(s, min, max);
-#endif
-            return w;
-        }
-#ifdef SNOWBALL_COVERAGE
-        report_coverage(s, min, max, ch, z->p + z->c - w, w);
-#endif
-        z->c -= w;
-    } while (repeat);
-    return 0;
+/* Code for character groupings: utf8 cases using the lookup tables which
+ * `-grouping table` generates after the bitmap.  The first level is indexed
+ * by the first byte of the character: for a single byte character it says
+ * whether the character is in the grouping; for the first byte of a two byte
+ * character it gives a page, which is a 64 bit bitmap indexed by the second
+ * byte; for the first byte of a three byte character it gives a row of 64
+ * pages, indexed by the second byte, with the page indexed by the third
+ * byte.  Page 0 and row 0 are empty, and the number of rows is stored in the
+ * otherwise unused entry for 0xFF.  Longer characters and those cut short by
+ * the limit are decoded and looked up in the bitmap.
+ */
+
+static int in_bitmap(const unsigned char * s, int min, int max, int ch) {
+    return !(ch > max || (ch -= min) < 0 || (s[ch >> 3] & (0X1 << (ch & 0X7))) == 0);
 }
 
-extern int out_grouping_U(struct SN_env * z, const unsigned char * s, int min, int max, int repeat) {
-    do {
-        int ch;
-        int w = get_utf8(z->p, z->c, z->l, & ch);
-        if (!w) return -1;
-        if (!(ch > max || (ch -= min) < 0 || (s[ch >> 3] & (0X1 << (ch & 0X7))) == 0)) {
-#ifdef SNOWBALL_COVERAGE
-            report_coverage(s, min, max, ch, z->p + z->c, w);
-#endif
-            return w;
-        }
-#ifdef SNOWBALL_COVERAGE
-        report_coverage_nomatch(s, min, max);
-#endif
-        z->c += w;
-    } while (repeat);
-    return 0;
+static int in_page(const unsigned char * pages, int page, int b) {
+    return (pages[page * 8 + ((b & 0x3F) >> 3)] >> (b & 0x7)) & 1;
 }
 
-extern int out_grouping_b_U(struct SN_env * z, const unsigned char * s, int min, int max, int repeat) {
-    do {
-        int ch;
-        int w = get_b_utf8(z->p, z->c, z->lb, & ch);
-        if (!w) return -1;
-        if (!(ch > max || (ch -= min) < 0 || (s[ch >> 3] & (0X1 << (ch & 0X7))) == 0)) {
-#ifdef SNOWBALL_COVERAGE
-            report_coverage(s, min, max, ch, z->p + z->c - w, w);
-#endif
-            return w;
+/* Test if the character at c is in grouping s and set *w to its width. */
+static int in_table_utf8(const unsigned char * s, int min, int max,
+                         const symbol * p, int c, int l, int * w) {
+    const unsigned char * lead = s + ((max - min + 8) >> 3);
+    const unsigned char * mid = lead + 256;
+    const unsigned char * pages = mid + 64 * lead[0xFF];
+    int b0 = p[c];
+    int ch = 0;
+    if (b0 < 0xC0) {
+        *w = 1;
+        return lead[b0];
+    }
+    if (b0 < 0xE0) {
+        if (c + 1 < l) {
+            *w = 2;
+            return in_page(pages, lead[b0], p[c + 1]);
         }
-#ifdef SNOWBALL_COVERAGE
-        report_coverage_nomatch(s, min, max);
-#endif
-        z->c -= w;
-    } while (repeat);
-    return 0;
+    } else if (b0 < 0xF0) {
+        if (c + 2 < l) {
+            *w = 3;
+            return in_page(pages, mid[lead[b0] * 64 + (p[c + 1] & 0x3F)], p[c + 2]);
+        }
+    }
+    *w = get_utf8(p, c, l, &ch);
+    return in_bitmap(s, min, max, ch);
+}
+
+/* Test if the character before c is in grouping s and set *w to its width. */
+static int in_table_b_utf8(const unsigned char * s, int min, int max,
+                           const symbol * p, int c, int lb, int * w) {
+    const unsigned char * lead = s + ((max - min + 8) >> 3);
+    const unsigned char * mid = lead + 256;
+    const unsigned char * pages = mid + 64 * lead[0xFF];
+    int b = p[c - 1];
+    int ch = 0;
+    if (b < 0x80) {
+        *w = 1;
+        return lead[b];
+    }
+    if (c - 1 > lb) {
+        int b1 = p[c - 2];
+        if (b1 >= 0xC0 && b1 < 0xE0) {
+            *w = 2;
+            return in_page(pages, lead[b1], b);
+        }
+        if (b1 >= 0x80 && b1 < 0xC0 && c - 2 > lb) {
+            int b2 = p[c - 3];
+            if (b2 >= 0xE0 && b2 < 0xF0) {
+                *w = 3;
+                return in_page(pages, mid[lead[b2] * 64 + (b1 & 0x3F)], b);
+            }
+        }
+    }
+    *w = get_b_utf8(p, c, lb, &ch);
+    return in_bitmap(s, min, max, ch);
 }
 
-/* Code for character groupings: non-utf8 cases */
-
-extern int in_grouping(struct SN_env * z, const unsigned char * s, int min, int max, int repeat) {
+extern int in_grouping_U_table(struct SN_env * z, const unsigned char * s, int min, int max, int repeat) {
     do {
-        int ch;
+        int w;
         if (z->c >= z->l) return -1;
-        ch = z->p[z->c];
-        if (ch > max || (ch -= min) < 0 || (s[ch >> 3] & (0X1 << (ch & 0X7))) == 0)
-            return 1;
-        z->c++;
+        if (!in_table_utf8(s, min, max, z->p, z->c, z->l, &w)) return w;
+        z->c += w;
     } while (repeat);
     return 0;
 }
 
-extern int in_grouping_b(struct SN_env * z, const unsigned char * s, int min, int max, int repeat) {
+extern int in_grouping_b_U_table(struct SN_env * z, const unsigned char * s, int min, int max, int repeat) {
     do {
-        int ch;
+        int w;
         if (z->c <= z->lb) return -1;
-        ch = z->p[z->c - 1];
-        if (ch > max || (ch -= min) < 0 || (s[ch >> 3] & (0X1 << (ch & 0X7))) == 0)
-            return 1;
-        z->c--;
+        if (!in_table_b_utf8(s, min, max, z->p, z->c, z->lb, &w)) return w;
+        z->c -= w;
     } while (repeat);
     return 0;
 }
 
-extern int out_grouping(struct SN_env * z, const unsigned char * s, int min, int max, int repeat) {
+extern int out_grouping_U_table(struct SN_env * z, const unsigned char * s, int min, int max, int repeat) {
     do {
-        int ch;
+        int w;
         if (z->c >= z->l) return -1;
-        ch = z->p[z->c];
-        if (!(ch > max || (ch -= min) < 0 || (s[ch >> 3] & (0X1 << (ch & 0X7))) == 0))
-            return 1;
-        z->c++;
+        if (in_table_utf8(s, min, max, z->p, z->c, z->l, &w)) return w;
+        z->c += w;
     } while (repeat);
     return 0;
 }
 
-extern int out_grouping_b(struct SN_env * z, const unsigned char * s, int min, int max, int repeat) {
+extern int out_grouping_b_U_table(struct SN_env * z, const unsigned char * s, int min, int max, int repeat) {
     do {
-        int ch;
+        int w;
         if (z->c <= z->lb) return -1;
-        ch = z->p[z->c - 1];
-        if (!(ch > max || (ch -= min) < 0 || (s[ch >> 3] & (0X1 << (ch & 0X7))) == 0))
-            return 1;
-        z->c--;
+        if (in_table_b_utf8(s, min, max, z->p, z->c, z->lb, &w)) return w;
+        z->c -= w;
     } while (repeat);
     return 0;
 }
 
-extern int eq_s(struct SN_env * z, int s_size, const symbol * s) {
-    if (z->l - z->c < s_size || memcmp(z->p + z->c, s, s_size * sizeof(symbol)) != 0) return 0;
-    z->c += s_size; return 1;
-}
-
-extern int eq_s_b(struct SN_env * z, int s_size, const symbol * s) {
-    if (z->c - z->lb < s_size || memcmp(z->p + z->c - s_size, s, s_size * sizeof(symbol)) != 0) return 0;
-    z->c -= s_size; return 1;
-}
-
-extern int eq_v(struct SN_env * z, const symbol * p) {
-    return eq_s(z, SIZE(p), p);
+/* Like find_among(), but also increments counts[i] if v[i] matches, or
+ * counts[v_size] if nothing matches.
+ */
+extern int find_among_counted(struct SN_env * z, const struct among * v, int v_size,
+                              int (*call_among_func)(struct SN_env*),
+                              unsigned long * counts) {
+    return find_among_i(z, v, v_size, call_among_func, counts);
 }
 
-extern int eq_v_b(struct SN_env * z, const symbol * p) {
-    return eq_s_b(z, SIZE(p), p);
+extern int find_among_b_counted(struct SN_env * z, const struct among * v, int v_size,
+                                int (*call_among_func)(struct SN_env*),
+                                unsigned long * counts) {
+    return find_among_b_i(z, v, v_size, call_among_func, counts);
 }
 
-extern int find_among(struct SN_env * z, const struct among * v, int v_size,
-                      int (*call_among_func)(struct SN_env*)) {
-
+/* Like find_among(), but for an among in the compact form generated by
+ * `-among compact`.
+ */
+extern int find_among_compact(struct SN_env * z, const struct among_compact * v,
+                              int v_size, int (*call_among_func)(struct SN_env*)) {
     int i = 0;
     int j = v_size;
 
     int c = z->c; int l = z->l;
     const symbol * q = z->p + c;
 
-    const struct among * w;
-
     int common_i = 0;
     int common_j = 0;
 
     int first_key_inspected = 0;
 
-#ifdef SNOWBALL_COVERAGE
-    if (v[v_size * 2].s_size == -1)
-        fprintf(stderr, "%s: among %d no match impossible\n", v[v_size * 2].s, v[v_size].s_size);
-#endif
+    COUNT_STAT(z, among_calls);
     while (1) {
         int k = i + ((j - i) >> 1);
         int diff = 0;
-        int common = common_i < common_j ? common_i : common_j; /* smaller */
-        w = v + k;
+        int common = common_i < common_j ? common_i : common_j;
+        const symbol * s = v->pool + v->offset[k];
         {
-            int i2; for (i2 = common; i2 < w->s_size; i2++) {
+            int i2; for (i2 = common; i2 < v->size[k]; i2++) {
                 if (c + common == l) { diff = -1; break; }
-                diff = q[common] - w->s[i2];
+                diff = q[common] - s[i2];
                 if (diff != 0) break;
                 common++;
             }
@@ -347,78 +396,53 @@ extern int find_among(struct SN_env * z, const struct among * v, int v_size,
             common_i = common;
         }
         if (j - i <= 1) {
-            if (i > 0) break; /* v->s has been inspected */
-            if (j == i) break; /* only one item in v */
-
-            /* - but now we need to go round once more to get
-               v->s inspected. This looks messy, but is actually
-               the optimal approach.  */
-
+            if (i > 0) break;
+            if (j == i) break;
             if (first_key_inspected) break;
             first_key_inspected = 1;
         }
     }
-    w = v + i;
     while (1) {
-        if (common_i >= w->s_size) {
-            z->c = c + w->s_size;
-#ifdef SNOWBALL_COVERAGE
-            fprintf(stderr, "%s: among %d : %d of %d string '%.*s'\n", w[v_size].s, w[v_size].s_size, w[v_size].result, v_size, w->s_size, w->s);
-#endif
-            if (!w->function) return w->result;
-            z->af = w->function;
+        if (common_i >= v->size[i]) {
+            z->c = c + v->size[i];
+            if (!v->function || !v->function[i]) return v->result[i];
+            z->af = v->function[i];
             if (call_among_func(z)) {
-                z->c = c + w->s_size;
-#ifdef SNOWBALL_COVERAGE
-                fprintf(stderr, "%s: among %d : %d of %d func-t '%.*s'\n", w[v_size].s, w[v_size].s_size, w[v_size].result, v_size, w->s_size, w->s);
-#endif
-                return w->result;
+                z->c = c + v->size[i];
+                return v->result[i];
             }
-#ifdef SNOWBALL_COVERAGE
-            fprintf(stderr, "%s: among %d : %d of %d func-f '%.*s'\n", w[v_size].s, w[v_size].s_size, w[v_size].result, v_size, w->s_size, w->s);
-#endif
-        }
-        if (!w->substring_i) {
-#ifdef SNOWBALL_COVERAGE
-            fprintf(stderr, "%s: among %d no match\n", v[v_size * 2].s, v[v_size * 2].s_size);
-#endif
-            return 0;
         }
-        w += w->substring_i;
+        if (!v->substring_i[i]) return 0;
+        i += v->substring_i[i];
     }
 }
 
-/* find_among_b is for backwards processing. Same comments apply */
-
-extern int find_among_b(struct SN_env * z, const struct among * v, int v_size,
-                        int (*call_among_func)(struct SN_env*)) {
-
+/* Like find_among_b(), but for an among in the compact form generated by
+ * `-among compact`.
+ */
+extern int find_among_b_compact(struct SN_env * z, const struct among_compact * v,
+                                int v_size, int (*call_among_func)(struct SN_env*)) {
     int i = 0;
     int j = v_size;
 
     int c = z->c; int lb = z->lb;
     const symbol * q = z->p + c - 1;
 
-    const struct among * w;
-
     int common_i = 0;
     int common_j = 0;
 
     int first_key_inspected = 0;
 
-#ifdef SNOWBALL_COVERAGE
-    if (v[v_size * 2].s_size == -1)
-        fprintf(stderr, "%s: among %d no match impossible\n", v[v_size * 2].s, v[v_size].s_size);
-#endif
+    COUNT_STAT(z, among_calls);
     while (1) {
         int k = i + ((j - i) >> 1);
         int diff = 0;
         int common = common_i < common_j ? common_i : common_j;
-        w = v + k;
+        const symbol * s = v->pool + v->offset[k];
         {
-            int i2; for (i2 = w->s_size - 1 - common; i2 >= 0; i2--) {
+            int i2; for (i2 = v->size[k] - 1 - common; i2 >= 0; i2--) {
                 if (c - common == lb) { diff = -1; break; }
-                diff = q[- common] - w->s[i2];
+                diff = q[- common] - s[i2];
                 if (diff != 0) break;
                 common++;
             }
@@ -432,45 +456,134 @@ extern int find_among_b(struct SN_env * z, const struct among * v, int v_size,
             first_key_inspected = 1;
         }
     }
-    w = v + i;
     while (1) {
-        if (common_i >= w->s_size) {
-            z->c = c - w->s_size;
-#ifdef SNOWBALL_COVERAGE
-            fprintf(stderr, "%s: among %d : %d of %d string '%.*s'\n", w[v_size].s, w[v_size].s_size, w[v_size].result, v_size, w->s_size, w->s);
-#endif
-            if (!w->function) return w->result;
-            z->af = w->function;
+        if (common_i >= v->size[i]) {
+            z->c = c - v->size[i];
+            if (!v->function || !v->function[i]) return v->result[i];
+            z->af = v->function[i];
             if (call_among_func(z)) {
-#ifdef SNOWBALL_COVERAGE
-                fprintf(stderr, "%s: among %d : %d of %d func-t '%.*s'\n", w[v_size].s, w[v_size].s_size, w[v_size].result, v_size, w->s_size, w->s);
-#endif
-                z->c = c - w->s_size;
-                return w->result;
+                z->c = c - v->size[i];
+                return v->result[i];
             }
-#ifdef SNOWBALL_COVERAGE
-            fprintf(stderr, "%s: among %d : %d of %d func-f '%.*s'\n", w[v_size].s, w[v_size].s_size, w[v_size].result, v_size, w->s_size, w->s);
-#endif
         }
-        if (!w->substring_i) {
-#ifdef SNOWBALL_COVERAGE
-            fprintf(stderr, "%s: among %d no match\n", v[v_size * 2].s, v[v_size * 2].s_size);
-#endif
-            return 0;
+        if (!v->substring_i[i]) return 0;
+        i += v->substring_i[i];
+    }
+}
+
+/* Like find_among_b(), but instead of a binary search, hash the last n
+ * symbols for each length n of string in v and look them up in the perfect
+ * hash table h which the compiler generates for large amongs.
+ */
+extern int find_among_b_hash(struct SN_env * z, const struct among * v,
+                             int (*call_among_func)(struct SN_env*),
+                             const struct among_hash * h) {
+    int c = z->c;
+    const symbol * q = z->p + c;
+    int n_max = c - z->lb < h->longest ? c - z->lb : h->longest;
+    unsigned long x = h->seed;
+    unsigned long bucket_mask = (1UL << h->bucket_bits) - 1;
+    unsigned long slot_mask = (1UL << h->slot_bits) - 1;
+    /* The empty string, if present, sorts first. */
+    const struct among * w = v[0].s_size == 0 ? v : NULL;
+    int n;
+
+    COUNT_STAT(z, among_calls);
+    for (n = 1; n <= n_max; n++) {
+        x = ((x ^ q[-n]) * 16777619UL) & 0xffffffffUL;
+        if (n > 32 || ((h->sizes >> (n - 1)) & 1)) {
+            unsigned long y = x ^ (x >> 15);
+            int k = h->slots[((y >> 16) ^ h->displace[y & bucket_mask]) & slot_mask];
+            if (k && v[k - 1].s_size == n &&
+                memcmp(v[k - 1].s, q - n, n * sizeof(symbol)) == 0) {
+                w = v + k - 1;
+            }
         }
+    }
+    if (w == NULL) return 0;
+
+    /* All the substrings of w in v also match, so try them in turn as
+     * find_among_b() does. */
+    while (1) {
+        z->c = c - w->s_size;
+        if (!w->function) return w->result;
+        z->af = w->function;
+        if (call_among_func(z)) {
+            z->c = c - w->s_size;
+            return w->result;
+        }
+        if (!w->substring_i) return 0;
         w += w->substring_i;
     }
 }
 
+/* Count the result ret of a grouping test in counts[0] if it succeeded
+ * (ret is 0) or counts[1] if it failed, and return ret.
+ */
+extern int count_grouping(unsigned long * counts, int ret) {
+    SN_COUNT(counts[ret != 0]);
+    return ret;
+}
+
+/* Count the result ret of a grouping scan (for goto or gopast) in counts[2]
+ * if it succeeded or counts[3] if it failed (ret is negative), and return
+ * ret.
+ */
+extern int count_grouping_scan(unsigned long * counts, int ret) {
+    SN_COUNT(counts[ret < 0 ? 3 : 2]);
+    return ret;
+}
+
+/* Write the counts for among v, as collected by find_among_counted() or
+ * find_among_b_counted(), to f as tab-separated lines giving the source
+ * location, the string (or "(no match)") and the count.  The location is
+ * taken from the extra entries in v which -coverage generates.
+ */
+extern void dump_among_counts(FILE * f, const struct among * v, int v_size,
+                              const unsigned long * counts) {
+    int i;
+    for (i = 0; i < v_size; i++) {
+        fprintf(f, "%s\t'%.*s'\t%lu\n", (const char *)v[v_size + i].s,
+                v[i].s_size, (const char *)v[i].s, counts[i]);
+    }
+    fprintf(f, "%s\t(no match)\t%lu\n", (const char *)v[v_size * 2].s,
+            counts[v_size]);
+}
+
+/* Write the counts for grouping s, as collected by count_grouping() and
+ * count_grouping_scan(), to f in the same format as dump_among_counts().
+ * The name of the grouping follows the bitmap when -coverage is used.
+ */
+extern void dump_grouping_counts(FILE * f, const unsigned char * s, int min, int max,
+                                 const unsigned long * counts) {
+    const char * name = (const char *)(s + (max - min + 8) / 8);
+    fprintf(f, "%s\ttest matched\t%lu\n", name, counts[0]);
+    fprintf(f, "%s\ttest failed\t%lu\n", name, counts[1]);
+    fprintf(f, "%s\tscan matched\t%lu\n", name, counts[2]);
+    fprintf(f, "%s\tscan failed\t%lu\n", name, counts[3]);
+}
+
 
-/* Increase the size of the buffer pointed to by p to at least n symbols.
+/* Return the new capacity for a buffer of capacity old_size which needs to
+ * hold at least n symbols.  The capacity is at least doubled so that
+ * repeatedly growing a buffer takes amortised linear time.
+ */
+static int grow_size(int old_size, int n) {
+    int new_size = old_size * 2;
+    if (new_size < n + 20) new_size = n + 20;
+    return new_size;
+}
+
+/* Increase the size of the buffer pointed to by p (which was allocated
+ * using z's allocator) to at least n symbols.
  * On success, returns 0.  If insufficient memory, returns -1.
  */
-static int increase_size(symbol ** p, int n) {
-    int new_size = n + 20;
-    void * mem = realloc((char *) *p - HEAD,
-                         HEAD + (new_size + 1) * sizeof(symbol));
+static int increase_size(struct SN_env * z, symbol ** p, int n) {
+    int new_size = grow_size(CAPACITY(*p), n);
+    void * mem = reallocate(z->allocator, (char *) *p - HEAD,
+                            HEAD + (new_size + 1) * sizeof(symbol));
     symbol * q;
+    COUNT_STAT(z, reallocs);
     if (mem == NULL) return -1;
     q = (symbol *) (HEAD + (char *)mem);
     CAPACITY(q) = new_size;
@@ -478,6 +591,45 @@ static int increase_size(symbol ** p, int n) {
     return 0;
 }
 
+/* Increase the size of z->p to at least n symbols, moving it to the heap
+ * if it is using the buffer inside z or one supplied by the caller.  In the
+ * latter case the runtime's own buffer is used if it is big enough or on the
+ * heap.
+ * On success, returns 0.  If insufficient memory, returns -1.
+ */
+static int increase_size_p(struct SN_env * z, int n) {
+    symbol * q;
+    if (z->p != INLINE_P(z) && z->p != z->external)
+        return increase_size(z, &z->p, n);
+    if (z->p == z->external &&
+        (z->saved_p != INLINE_P(z) || CAPACITY(z->saved_p) >= n)) {
+        if (CAPACITY(z->saved_p) < n &&
+            increase_size(z, &z->saved_p, n) < 0) return -1;
+        q = z->saved_p;
+    } else {
+        int new_size = grow_size(CAPACITY(z->p), n);
+        void * mem = allocate(z->allocator, HEAD + (new_size + 1) * sizeof(symbol));
+        COUNT_STAT(z, reallocs);
+        if (mem == NULL) return -1;
+        q = (symbol *) (HEAD + (char *)mem);
+        CAPACITY(q) = new_size;
+    }
+    SET_SIZE(q, SIZE(z->p));
+    memcpy(q, z->p, SIZE(z->p) * sizeof(symbol));
+    z->p = q;
+    z->saved_p = NULL;
+    return 0;
+}
+
+/* Ensure z->p has room for at least n symbols, so stemming words of up to
+ * n symbols doesn't need to reallocate it.
+ * On success, returns 0.  If insufficient memory, returns -1.
+ */
+extern int SN_reserve(struct SN_env * z, int n) {
+    if (n <= CAPACITY(z->p)) return 0;
+    return increase_size_p(z, n);
+}
+
 /* to replace symbols between c_bra and c_ket in z->p by the
    s_size symbols at s.
    Returns 0 on success, -1 on error.
@@ -488,7 +640,7 @@ extern SNOWBALL_ERR replace_s(struct SN_env * z, int c_bra, int c_ket, int s_siz
     if (adjustment != 0) {
         int len = SIZE(z->p);
         if (adjustment + len > CAPACITY(z->p)) {
-            SNOWBALL_PROPAGATE_ERR(increase_size(&z->p, adjustment + len));
+            SNOWBALL_PROPAGATE_ERR(increase_size_p(z, adjustment + len));
         }
         memmove(z->p + c_ket + adjustment,
                 z->p + c_ket,
@@ -576,7 +728,7 @@ extern SNOWBALL_ERR slice_to(struct SN_env * z, symbol ** p) {
     {
         int len = z->ket - z->bra;
         if (CAPACITY(*p) < len) {
-            SNOWBALL_PROPAGATE_ERR(increase_size(p, len));
+            SNOWBALL_PROPAGATE_ERR(increase_size(z, p, len));
         }
         memmove(*p, z->p + z->bra, len * sizeof(symbol));
         SET_SIZE(*p, len);
@@ -587,7 +739,7 @@ extern SNOWBALL_ERR slice_to(struct SN_env * z, symbol ** p) {
 extern SNOWBALL_ERR assign_to(struct SN_env * z, symbol ** p) {
     int len = z->l;
     if (CAPACITY(*p) < len) {
-        SNOWBALL_PROPAGATE_ERR(increase_size(p, len));
+        SNOWBALL_PROPAGATE_ERR(increase_size(z, p, len));
     }
     memmove(*p, z->p, len * sizeof(symbol));
     SET_SIZE(*p, len);
@@ -0,0 +1,5 @@
+/* The runtime built for 16 bit symbols, as used by code generated with
+ * -widechars.
+ */
+#define SNOWBALL_WIDECHARS
+#include "utilities.c"
@@ -0,0 +1,17 @@
+/* Generated from norwegian.sbl by Snowball 3.0.0 - https://snowballstem.org/ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct SN_allocator;
+
+extern struct SN_env * norwegian_ISO_8859_1_create_env(void);
+extern struct SN_env * norwegian_ISO_8859_1_create_env_with_allocator(const struct SN_allocator * allocator);
+extern void norwegian_ISO_8859_1_close_env(struct SN_env * z);
+
+extern int norwegian_ISO_8859_1_stem(struct SN_env * z);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,17 @@
+/* Generated from italian.sbl by Snowball 3.0.0 - https://snowballstem.org/ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct SN_allocator;
+
+extern struct SN_env * italian_UTF_16_create_env(void);
+extern struct SN_env * italian_UTF_16_create_env_with_allocator(const struct SN_allocator * allocator);
+extern void italian_UTF_16_close_env(struct SN_env * z);
+
+extern int italian_UTF_16_stem(struct SN_env * z);
+
+#ifdef __cplusplus
+}
+#endif
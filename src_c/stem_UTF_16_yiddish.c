@@ -0,0 +1,1334 @@
+/* Generated from yiddish.sbl by Snowball 3.0.0 - https://snowballstem.org/ */
+
+#define SNOWBALL_WIDECHARS
+#include "stem_UTF_16_yiddish.h"
+
+#include <stddef.h>
+
+#include "../runtime/snowball_runtime.h"
+
+struct SN_local {
+    struct SN_env z;
+    int i_p1;
+};
+
+typedef struct SN_local SN_local;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int yiddish_UTF_16_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+
+static int r_standard_suffix(struct SN_env * z);
+static int r_R1plus3(struct SN_env * z);
+static int r_R1(struct SN_env * z);
+static int r_mark_regions(struct SN_env * z);
+static int r_prelude(struct SN_env * z);
+
+static const symbol s_0[] = { 0x5F0 };
+static const symbol s_1[] = { 0x5F1 };
+static const symbol s_2[] = { 0x5F2 };
+static const symbol s_3[] = { 0x5DB };
+static const symbol s_4[] = { 0x5DE };
+static const symbol s_5[] = { 0x5E0 };
+static const symbol s_6[] = { 0x5E4 };
+static const symbol s_7[] = { 0x5E6 };
+static const symbol s_8[] = { 0x5D2, 0x5E2 };
+static const symbol s_9[] = { 0x5DC, 0x5D8 };
+static const symbol s_10[] = { 0x5D1, 0x5E0 };
+static const symbol s_11[] = { 'G', 'E' };
+static const symbol s_12[] = { 0x5E6, 0x5D5, 0x5D2, 0x5E0 };
+static const symbol s_13[] = { 0x5E6, 0x5D5, 0x5E7, 0x5D8 };
+static const symbol s_14[] = { 0x5E6, 0x5D5, 0x5E7, 0x5E0 };
+static const symbol s_15[] = { 0x5D2, 0x5E2, 0x5D1, 0x5E0 };
+static const symbol s_16[] = { 0x5D2, 0x5E2 };
+static const symbol s_17[] = { 'G', 'E' };
+static const symbol s_18[] = { 0x5E6, 0x5D5 };
+static const symbol s_19[] = { 'T', 'S', 'U' };
+static const symbol s_20[] = { 0x5D9, 0x5E2 };
+static const symbol s_21[] = { 0x5D2, 0x5F2 };
+static const symbol s_22[] = { 0x5E0, 0x5E2, 0x5DE };
+static const symbol s_23[] = { 0x5DE, 0x5F2, 0x5D3 };
+static const symbol s_24[] = { 0x5D1, 0x5F2, 0x5D8 };
+static const symbol s_25[] = { 0x5D1, 0x5F2, 0x5E1 };
+static const symbol s_26[] = { 0x5F0, 0x5F2, 0x5D6 };
+static const symbol s_27[] = { 0x5D8, 0x5E8, 0x5F2, 0x5D1 };
+static const symbol s_28[] = { 0x5DC, 0x5F2, 0x5D8 };
+static const symbol s_29[] = { 0x5E7, 0x5DC, 0x5F2, 0x5D1 };
+static const symbol s_30[] = { 0x5E8, 0x5F2, 0x5D1 };
+static const symbol s_31[] = { 0x5E8, 0x5F2, 0x5E1 };
+static const symbol s_32[] = { 0x5E9, 0x5F0, 0x5F2, 0x5D2 };
+static const symbol s_33[] = { 0x5E9, 0x5DE, 0x5F2, 0x5E1 };
+static const symbol s_34[] = { 0x5E9, 0x5E0, 0x5F2, 0x5D3 };
+static const symbol s_35[] = { 0x5E9, 0x5E8, 0x5F2, 0x5D1 };
+static const symbol s_36[] = { 0x5D1, 0x5D9, 0x5E0, 0x5D3 };
+static const symbol s_37[] = { 0x5F0, 0x5D9, 0x5D8, 0x5E9 };
+static const symbol s_38[] = { 0x5D6, 0x5D9, 0x5E0, 0x5D2 };
+static const symbol s_39[] = { 0x5D8, 0x5E8, 0x5D9, 0x5E0, 0x5E7 };
+static const symbol s_40[] = { 0x5E6, 0x5F0, 0x5D9, 0x5E0, 0x5D2 };
+static const symbol s_41[] = { 0x5E9, 0x5DC, 0x5D9, 0x5E0, 0x5D2 };
+static const symbol s_42[] = { 0x5D1, 0x5F2, 0x5D2 };
+static const symbol s_43[] = { 0x5D4, 0x5F2, 0x5D1 };
+static const symbol s_44[] = { 0x5E4, 0x5D0, 0x5E8, 0x5DC, 0x5D9, 0x5E8 };
+static const symbol s_45[] = { 0x5E9, 0x5D8, 0x5F2 };
+static const symbol s_46[] = { 0x5E9, 0x5F0, 0x5E2, 0x5E8 };
+static const symbol s_47[] = { 0x5D8 };
+static const symbol s_48[] = { 0x5D1, 0x5E8, 0x5D0, 0x5DB };
+static const symbol s_49[] = { 0x5D2, 0x5E2 };
+static const symbol s_50[] = { 0x5D1, 0x5E8, 0x5E2, 0x5E0, 0x5D2 };
+static const symbol s_51[] = { 0x5D2, 0x5F2 };
+static const symbol s_52[] = { 0x5E0, 0x5E2, 0x5DE };
+static const symbol s_53[] = { 0x5E9, 0x5E8, 0x5F2, 0x5D1 };
+static const symbol s_54[] = { 0x5DE, 0x5F2, 0x5D3 };
+static const symbol s_55[] = { 0x5D1, 0x5F2, 0x5D8 };
+static const symbol s_56[] = { 0x5D1, 0x5F2, 0x5E1 };
+static const symbol s_57[] = { 0x5F0, 0x5F2, 0x5D6 };
+static const symbol s_58[] = { 0x5D8, 0x5E8, 0x5F2, 0x5D1 };
+static const symbol s_59[] = { 0x5DC, 0x5F2, 0x5D8 };
+static const symbol s_60[] = { 0x5E7, 0x5DC, 0x5F2, 0x5D1 };
+static const symbol s_61[] = { 0x5E8, 0x5F2, 0x5D1 };
+static const symbol s_62[] = { 0x5E8, 0x5F2, 0x5E1 };
+static const symbol s_63[] = { 0x5E9, 0x5F0, 0x5F2, 0x5D2 };
+static const symbol s_64[] = { 0x5E9, 0x5DE, 0x5F2, 0x5E1 };
+static const symbol s_65[] = { 0x5E9, 0x5E0, 0x5F2, 0x5D3 };
+static const symbol s_66[] = { 0x5D1, 0x5D9, 0x5E0, 0x5D3 };
+static const symbol s_67[] = { 0x5F0, 0x5D9, 0x5D8, 0x5E9 };
+static const symbol s_68[] = { 0x5D6, 0x5D9, 0x5E0, 0x5D2 };
+static const symbol s_69[] = { 0x5D8, 0x5E8, 0x5D9, 0x5E0, 0x5E7 };
+static const symbol s_70[] = { 0x5E6, 0x5F0, 0x5D9, 0x5E0, 0x5D2 };
+static const symbol s_71[] = { 0x5E9, 0x5DC, 0x5D9, 0x5E0, 0x5D2 };
+static const symbol s_72[] = { 0x5D1, 0x5F2, 0x5D2 };
+static const symbol s_73[] = { 0x5D4, 0x5F2, 0x5D1 };
+static const symbol s_74[] = { 0x5E4, 0x5D0, 0x5E8, 0x5DC, 0x5D9, 0x5E8 };
+static const symbol s_75[] = { 0x5E9, 0x5D8, 0x5F2 };
+static const symbol s_76[] = { 0x5E9, 0x5F0, 0x5E2, 0x5E8 };
+static const symbol s_77[] = { 0x5D1, 0x5E8, 0x5E2, 0x5E0, 0x5D2 };
+static const symbol s_78[] = { 0x5D4 };
+static const symbol s_79[] = { 0x5D9, 0x5E1 };
+static const symbol s_80[] = { 'G', 'E' };
+static const symbol s_81[] = { 'T', 'S', 'U' };
+
+static const symbol s_0_0[2] = { 0x5D5, 0x5D5 };
+static const symbol s_0_1[2] = { 0x5D5, 0x5D9 };
+static const symbol s_0_2[2] = { 0x5D9, 0x5D9 };
+static const symbol s_0_3[1] = { 0x5DA };
+static const symbol s_0_4[1] = { 0x5DD };
+static const symbol s_0_5[1] = { 0x5DF };
+static const symbol s_0_6[1] = { 0x5E3 };
+static const symbol s_0_7[1] = { 0x5E5 };
+static const struct among a_0[8] = {
+{ 2, s_0_0, 0, 1, 0},
+{ 2, s_0_1, 0, 2, 0},
+{ 2, s_0_2, 0, 3, 0},
+{ 1, s_0_3, 0, 4, 0},
+{ 1, s_0_4, 0, 5, 0},
+{ 1, s_0_5, 0, 6, 0},
+{ 1, s_0_6, 0, 7, 0},
+{ 1, s_0_7, 0, 8, 0}
+};
+
+static const symbol s_1_0[5] = { 0x5D0, 0x5D3, 0x5D5, 0x5E8, 0x5DB };
+static const symbol s_1_1[4] = { 0x5D0, 0x5D4, 0x5D9, 0x5E0 };
+static const symbol s_1_2[4] = { 0x5D0, 0x5D4, 0x5E2, 0x5E8 };
+static const symbol s_1_3[4] = { 0x5D0, 0x5D4, 0x5F2, 0x5DE };
+static const symbol s_1_4[3] = { 0x5D0, 0x5D5, 0x5DE };
+static const symbol s_1_5[6] = { 0x5D0, 0x5D5, 0x5E0, 0x5D8, 0x5E2, 0x5E8 };
+static const symbol s_1_6[5] = { 0x5D0, 0x5D9, 0x5D1, 0x5E2, 0x5E8 };
+static const symbol s_1_7[2] = { 0x5D0, 0x5E0 };
+static const symbol s_1_8[3] = { 0x5D0, 0x5E0, 0x5D8 };
+static const symbol s_1_9[7] = { 0x5D0, 0x5E0, 0x5D8, 0x5E7, 0x5E2, 0x5D2, 0x5E0 };
+static const symbol s_1_10[6] = { 0x5D0, 0x5E0, 0x5D9, 0x5D3, 0x5E2, 0x5E8 };
+static const symbol s_1_11[2] = { 0x5D0, 0x5E4 };
+static const symbol s_1_12[4] = { 0x5D0, 0x5E4, 0x5D9, 0x5E8 };
+static const symbol s_1_13[5] = { 0x5D0, 0x5E7, 0x5E2, 0x5D2, 0x5E0 };
+static const symbol s_1_14[4] = { 0x5D0, 0x5E8, 0x5D0, 0x5E4 };
+static const symbol s_1_15[4] = { 0x5D0, 0x5E8, 0x5D5, 0x5DE };
+static const symbol s_1_16[7] = { 0x5D0, 0x5E8, 0x5D5, 0x5E0, 0x5D8, 0x5E2, 0x5E8 };
+static const symbol s_1_17[6] = { 0x5D0, 0x5E8, 0x5D9, 0x5D1, 0x5E2, 0x5E8 };
+static const symbol s_1_18[4] = { 0x5D0, 0x5E8, 0x5F1, 0x5E1 };
+static const symbol s_1_19[4] = { 0x5D0, 0x5E8, 0x5F1, 0x5E4 };
+static const symbol s_1_20[4] = { 0x5D0, 0x5E8, 0x5F2, 0x5E0 };
+static const symbol s_1_21[4] = { 0x5D0, 0x5F0, 0x5E2, 0x5E7 };
+static const symbol s_1_22[3] = { 0x5D0, 0x5F1, 0x5E1 };
+static const symbol s_1_23[3] = { 0x5D0, 0x5F1, 0x5E4 };
+static const symbol s_1_24[3] = { 0x5D0, 0x5F2, 0x5E0 };
+static const symbol s_1_25[2] = { 0x5D1, 0x5D0 };
+static const symbol s_1_26[2] = { 0x5D1, 0x5F2 };
+static const symbol s_1_27[4] = { 0x5D3, 0x5D5, 0x5E8, 0x5DB };
+static const symbol s_1_28[3] = { 0x5D3, 0x5E2, 0x5E8 };
+static const symbol s_1_29[3] = { 0x5DE, 0x5D9, 0x5D8 };
+static const symbol s_1_30[3] = { 0x5E0, 0x5D0, 0x5DB };
+static const symbol s_1_31[3] = { 0x5E4, 0x5D0, 0x5E8 };
+static const symbol s_1_32[5] = { 0x5E4, 0x5D0, 0x5E8, 0x5D1, 0x5F2 };
+static const symbol s_1_33[5] = { 0x5E4, 0x5D0, 0x5E8, 0x5F1, 0x5E1 };
+static const symbol s_1_34[8] = { 0x5E4, 0x5D5, 0x5E0, 0x5D0, 0x5E0, 0x5D3, 0x5E2, 0x5E8 };
+static const symbol s_1_35[2] = { 0x5E6, 0x5D5 };
+static const symbol s_1_36[7] = { 0x5E6, 0x5D5, 0x5D6, 0x5D0, 0x5DE, 0x5E2, 0x5E0 };
+static const symbol s_1_37[5] = { 0x5E6, 0x5D5, 0x5E0, 0x5F1, 0x5E4 };
+static const symbol s_1_38[5] = { 0x5E6, 0x5D5, 0x5E8, 0x5D9, 0x5E7 };
+static const symbol s_1_39[2] = { 0x5E6, 0x5E2 };
+static const struct among a_1[40] = {
+{ 5, s_1_0, 0, 1, 0},
+{ 4, s_1_1, 0, 1, 0},
+{ 4, s_1_2, 0, 1, 0},
+{ 4, s_1_3, 0, 1, 0},
+{ 3, s_1_4, 0, 1, 0},
+{ 6, s_1_5, 0, 1, 0},
+{ 5, s_1_6, 0, 1, 0},
+{ 2, s_1_7, 0, 1, 0},
+{ 3, s_1_8, -1, 1, 0},
+{ 7, s_1_9, -1, 1, 0},
+{ 6, s_1_10, -3, 1, 0},
+{ 2, s_1_11, 0, 1, 0},
+{ 4, s_1_12, -1, 1, 0},
+{ 5, s_1_13, 0, 1, 0},
+{ 4, s_1_14, 0, 1, 0},
+{ 4, s_1_15, 0, 1, 0},
+{ 7, s_1_16, 0, 1, 0},
+{ 6, s_1_17, 0, 1, 0},
+{ 4, s_1_18, 0, 1, 0},
+{ 4, s_1_19, 0, 1, 0},
+{ 4, s_1_20, 0, 1, 0},
+{ 4, s_1_21, 0, 1, 0},
+{ 3, s_1_22, 0, 1, 0},
+{ 3, s_1_23, 0, 1, 0},
+{ 3, s_1_24, 0, 1, 0},
+{ 2, s_1_25, 0, 1, 0},
+{ 2, s_1_26, 0, 1, 0},
+{ 4, s_1_27, 0, 1, 0},
+{ 3, s_1_28, 0, 1, 0},
+{ 3, s_1_29, 0, 1, 0},
+{ 3, s_1_30, 0, 1, 0},
+{ 3, s_1_31, 0, 1, 0},
+{ 5, s_1_32, -1, 1, 0},
+{ 5, s_1_33, -2, 1, 0},
+{ 8, s_1_34, 0, 1, 0},
+{ 2, s_1_35, 0, 1, 0},
+{ 7, s_1_36, -1, 1, 0},
+{ 5, s_1_37, -2, 1, 0},
+{ 5, s_1_38, -3, 1, 0},
+{ 2, s_1_39, 0, 1, 0}
+};
+
+static const symbol s_2_0[3] = { 0x5D3, 0x5D6, 0x5E9 };
+static const symbol s_2_1[3] = { 0x5E9, 0x5D8, 0x5E8 };
+static const symbol s_2_2[3] = { 0x5E9, 0x5D8, 0x5E9 };
+static const symbol s_2_3[3] = { 0x5E9, 0x5E4, 0x5E8 };
+static const struct among a_2[4] = {
+{ 3, s_2_0, 0, -1, 0},
+{ 3, s_2_1, 0, -1, 0},
+{ 3, s_2_2, 0, -1, 0},
+{ 3, s_2_3, 0, -1, 0}
+};
+
+static const symbol s_3_0[4] = { 0x5E7, 0x5DC, 0x5D9, 0x5D1 };
+static const symbol s_3_1[3] = { 0x5E8, 0x5D9, 0x5D1 };
+static const symbol s_3_2[4] = { 0x5D8, 0x5E8, 0x5D9, 0x5D1 };
+static const symbol s_3_3[4] = { 0x5E9, 0x5E8, 0x5D9, 0x5D1 };
+static const symbol s_3_4[3] = { 0x5D4, 0x5F1, 0x5D1 };
+static const symbol s_3_5[4] = { 0x5E9, 0x5F0, 0x5D9, 0x5D2 };
+static const symbol s_3_6[4] = { 0x5D2, 0x5D0, 0x5E0, 0x5D2 };
+static const symbol s_3_7[4] = { 0x5D6, 0x5D5, 0x5E0, 0x5D2 };
+static const symbol s_3_8[5] = { 0x5E9, 0x5DC, 0x5D5, 0x5E0, 0x5D2 };
+static const symbol s_3_9[5] = { 0x5E6, 0x5F0, 0x5D5, 0x5E0, 0x5D2 };
+static const symbol s_3_10[3] = { 0x5D1, 0x5F1, 0x5D2 };
+static const symbol s_3_11[4] = { 0x5D1, 0x5D5, 0x5E0, 0x5D3 };
+static const symbol s_3_12[3] = { 0x5F0, 0x5D9, 0x5D6 };
+static const symbol s_3_13[3] = { 0x5D1, 0x5D9, 0x5D8 };
+static const symbol s_3_14[3] = { 0x5DC, 0x5D9, 0x5D8 };
+static const symbol s_3_15[3] = { 0x5DE, 0x5D9, 0x5D8 };
+static const symbol s_3_16[4] = { 0x5E9, 0x5E0, 0x5D9, 0x5D8 };
+static const symbol s_3_17[3] = { 0x5E0, 0x5D5, 0x5DE };
+static const symbol s_3_18[4] = { 0x5E9, 0x5D8, 0x5D0, 0x5E0 };
+static const symbol s_3_19[3] = { 0x5D1, 0x5D9, 0x5E1 };
+static const symbol s_3_20[4] = { 0x5E9, 0x5DE, 0x5D9, 0x5E1 };
+static const symbol s_3_21[3] = { 0x5E8, 0x5D9, 0x5E1 };
+static const symbol s_3_22[5] = { 0x5D8, 0x5E8, 0x5D5, 0x5E0, 0x5E7 };
+static const symbol s_3_23[6] = { 0x5E4, 0x5D0, 0x5E8, 0x5DC, 0x5F1, 0x5E8 };
+static const symbol s_3_24[4] = { 0x5E9, 0x5F0, 0x5F1, 0x5E8 };
+static const symbol s_3_25[4] = { 0x5F0, 0x5D5, 0x5D8, 0x5E9 };
+static const struct among a_3[26] = {
+{ 4, s_3_0, 0, 9, 0},
+{ 3, s_3_1, 0, 10, 0},
+{ 4, s_3_2, -1, 7, 0},
+{ 4, s_3_3, -2, 15, 0},
+{ 3, s_3_4, 0, 23, 0},
+{ 4, s_3_5, 0, 12, 0},
+{ 4, s_3_6, 0, 1, 0},
+{ 4, s_3_7, 0, 18, 0},
+{ 5, s_3_8, 0, 21, 0},
+{ 5, s_3_9, 0, 20, 0},
+{ 3, s_3_10, 0, 22, 0},
+{ 4, s_3_11, 0, 16, 0},
+{ 3, s_3_12, 0, 6, 0},
+{ 3, s_3_13, 0, 4, 0},
+{ 3, s_3_14, 0, 8, 0},
+{ 3, s_3_15, 0, 3, 0},
+{ 4, s_3_16, 0, 14, 0},
+{ 3, s_3_17, 0, 2, 0},
+{ 4, s_3_18, 0, 25, 0},
+{ 3, s_3_19, 0, 5, 0},
+{ 4, s_3_20, 0, 13, 0},
+{ 3, s_3_21, 0, 11, 0},
+{ 5, s_3_22, 0, 19, 0},
+{ 6, s_3_23, 0, 24, 0},
+{ 4, s_3_24, 0, 26, 0},
+{ 4, s_3_25, 0, 17, 0}
+};
+
+static const symbol s_4_0[3] = { 0x5D5, 0x5E0, 0x5D2 };
+static const symbol s_4_1[3] = { 0x5E1, 0x5D8, 0x5D5 };
+static const symbol s_4_2[1] = { 0x5D8 };
+static const symbol s_4_3[5] = { 0x5D1, 0x5E8, 0x5D0, 0x5DB, 0x5D8 };
+static const symbol s_4_4[2] = { 0x5E1, 0x5D8 };
+static const symbol s_4_5[3] = { 0x5D9, 0x5E1, 0x5D8 };
+static const symbol s_4_6[2] = { 0x5E2, 0x5D8 };
+static const symbol s_4_7[4] = { 0x5E9, 0x5D0, 0x5E4, 0x5D8 };
+static const symbol s_4_8[3] = { 0x5D4, 0x5F2, 0x5D8 };
+static const symbol s_4_9[3] = { 0x5E7, 0x5F2, 0x5D8 };
+static const symbol s_4_10[4] = { 0x5D9, 0x5E7, 0x5F2, 0x5D8 };
+static const symbol s_4_11[3] = { 0x5DC, 0x5E2, 0x5DB };
+static const symbol s_4_12[4] = { 0x5E2, 0x5DC, 0x5E2, 0x5DB };
+static const symbol s_4_13[3] = { 0x5D9, 0x5D6, 0x5DE };
+static const symbol s_4_14[2] = { 0x5D9, 0x5DE };
+static const symbol s_4_15[2] = { 0x5E2, 0x5DE };
+static const symbol s_4_16[4] = { 0x5E2, 0x5E0, 0x5E2, 0x5DE };
+static const symbol s_4_17[5] = { 0x5D8, 0x5E2, 0x5E0, 0x5E2, 0x5DE };
+static const symbol s_4_18[1] = { 0x5E0 };
+static const symbol s_4_19[5] = { 0x5E7, 0x5DC, 0x5D9, 0x5D1, 0x5E0 };
+static const symbol s_4_20[4] = { 0x5E8, 0x5D9, 0x5D1, 0x5E0 };
+static const symbol s_4_21[5] = { 0x5D8, 0x5E8, 0x5D9, 0x5D1, 0x5E0 };
+static const symbol s_4_22[5] = { 0x5E9, 0x5E8, 0x5D9, 0x5D1, 0x5E0 };
+static const symbol s_4_23[4] = { 0x5D4, 0x5F1, 0x5D1, 0x5E0 };
+static const symbol s_4_24[5] = { 0x5E9, 0x5F0, 0x5D9, 0x5D2, 0x5E0 };
+static const symbol s_4_25[5] = { 0x5D6, 0x5D5, 0x5E0, 0x5D2, 0x5E0 };
+static const symbol s_4_26[6] = { 0x5E9, 0x5DC, 0x5D5, 0x5E0, 0x5D2, 0x5E0 };
+static const symbol s_4_27[6] = { 0x5E6, 0x5F0, 0x5D5, 0x5E0, 0x5D2, 0x5E0 };
+static const symbol s_4_28[4] = { 0x5D1, 0x5F1, 0x5D2, 0x5E0 };
+static const symbol s_4_29[5] = { 0x5D1, 0x5D5, 0x5E0, 0x5D3, 0x5E0 };
+static const symbol s_4_30[4] = { 0x5F0, 0x5D9, 0x5D6, 0x5E0 };
+static const symbol s_4_31[2] = { 0x5D8, 0x5E0 };
+static const symbol s_4_32[6] = { 'G', 'E', 0x5D1, 0x5D9, 0x5D8, 0x5E0 };
+static const symbol s_4_33[6] = { 'G', 'E', 0x5DC, 0x5D9, 0x5D8, 0x5E0 };
+static const symbol s_4_34[6] = { 'G', 'E', 0x5DE, 0x5D9, 0x5D8, 0x5E0 };
+static const symbol s_4_35[5] = { 0x5E9, 0x5E0, 0x5D9, 0x5D8, 0x5E0 };
+static const symbol s_4_36[3] = { 0x5E1, 0x5D8, 0x5E0 };
+static const symbol s_4_37[4] = { 0x5D9, 0x5E1, 0x5D8, 0x5E0 };
+static const symbol s_4_38[3] = { 0x5E2, 0x5D8, 0x5E0 };
+static const symbol s_4_39[6] = { 'G', 'E', 0x5D1, 0x5D9, 0x5E1, 0x5E0 };
+static const symbol s_4_40[5] = { 0x5E9, 0x5DE, 0x5D9, 0x5E1, 0x5E0 };
+static const symbol s_4_41[6] = { 'G', 'E', 0x5E8, 0x5D9, 0x5E1, 0x5E0 };
+static const symbol s_4_42[2] = { 0x5E2, 0x5E0 };
+static const symbol s_4_43[6] = { 0x5D2, 0x5D0, 0x5E0, 0x5D2, 0x5E2, 0x5E0 };
+static const symbol s_4_44[4] = { 0x5E2, 0x5DC, 0x5E2, 0x5E0 };
+static const symbol s_4_45[5] = { 0x5E0, 0x5D5, 0x5DE, 0x5E2, 0x5E0 };
+static const symbol s_4_46[5] = { 0x5D9, 0x5D6, 0x5DE, 0x5E2, 0x5E0 };
+static const symbol s_4_47[6] = { 0x5E9, 0x5D8, 0x5D0, 0x5E0, 0x5E2, 0x5E0 };
+static const symbol s_4_48[6] = { 0x5D8, 0x5E8, 0x5D5, 0x5E0, 0x5E7, 0x5E0 };
+static const symbol s_4_49[7] = { 0x5E4, 0x5D0, 0x5E8, 0x5DC, 0x5F1, 0x5E8, 0x5E0 };
+static const symbol s_4_50[5] = { 0x5E9, 0x5F0, 0x5F1, 0x5E8, 0x5E0 };
+static const symbol s_4_51[5] = { 0x5F0, 0x5D5, 0x5D8, 0x5E9, 0x5E0 };
+static const symbol s_4_52[3] = { 0x5D2, 0x5F2, 0x5E0 };
+static const symbol s_4_53[1] = { 0x5E1 };
+static const symbol s_4_54[2] = { 0x5D8, 0x5E1 };
+static const symbol s_4_55[3] = { 0x5E2, 0x5D8, 0x5E1 };
+static const symbol s_4_56[2] = { 0x5E0, 0x5E1 };
+static const symbol s_4_57[3] = { 0x5D8, 0x5E0, 0x5E1 };
+static const symbol s_4_58[3] = { 0x5E2, 0x5E0, 0x5E1 };
+static const symbol s_4_59[2] = { 0x5E2, 0x5E1 };
+static const symbol s_4_60[3] = { 0x5D9, 0x5E2, 0x5E1 };
+static const symbol s_4_61[4] = { 0x5E2, 0x5DC, 0x5E2, 0x5E1 };
+static const symbol s_4_62[3] = { 0x5E2, 0x5E8, 0x5E1 };
+static const symbol s_4_63[5] = { 0x5E2, 0x5E0, 0x5E2, 0x5E8, 0x5E1 };
+static const symbol s_4_64[1] = { 0x5E2 };
+static const symbol s_4_65[2] = { 0x5D8, 0x5E2 };
+static const symbol s_4_66[3] = { 0x5E1, 0x5D8, 0x5E2 };
+static const symbol s_4_67[3] = { 0x5E2, 0x5D8, 0x5E2 };
+static const symbol s_4_68[2] = { 0x5D9, 0x5E2 };
+static const symbol s_4_69[3] = { 0x5E2, 0x5DC, 0x5E2 };
+static const symbol s_4_70[3] = { 0x5E2, 0x5E0, 0x5E2 };
+static const symbol s_4_71[4] = { 0x5D8, 0x5E2, 0x5E0, 0x5E2 };
+static const symbol s_4_72[2] = { 0x5E2, 0x5E8 };
+static const symbol s_4_73[3] = { 0x5D8, 0x5E2, 0x5E8 };
+static const symbol s_4_74[4] = { 0x5E1, 0x5D8, 0x5E2, 0x5E8 };
+static const symbol s_4_75[4] = { 0x5E2, 0x5D8, 0x5E2, 0x5E8 };
+static const symbol s_4_76[4] = { 0x5E2, 0x5E0, 0x5E2, 0x5E8 };
+static const symbol s_4_77[5] = { 0x5D8, 0x5E2, 0x5E0, 0x5E2, 0x5E8 };
+static const symbol s_4_78[2] = { 0x5D5, 0x5EA };
+static const struct among a_4[79] = {
+{ 3, s_4_0, 0, 1, 0},
+{ 3, s_4_1, 0, 1, 0},
+{ 1, s_4_2, 0, 1, 0},
+{ 5, s_4_3, -1, 31, 0},
+{ 2, s_4_4, -2, 1, 0},
+{ 3, s_4_5, -1, 33, 0},
+{ 2, s_4_6, -4, 1, 0},
+{ 4, s_4_7, -5, 1, 0},
+{ 3, s_4_8, -6, 1, 0},
+{ 3, s_4_9, -7, 1, 0},
+{ 4, s_4_10, -1, 1, 0},
+{ 3, s_4_11, 0, 1, 0},
+{ 4, s_4_12, -1, 1, 0},
+{ 3, s_4_13, 0, 1, 0},
+{ 2, s_4_14, 0, 1, 0},
+{ 2, s_4_15, 0, 1, 0},
+{ 4, s_4_16, -1, 3, 0},
+{ 5, s_4_17, -1, 4, 0},
+{ 1, s_4_18, 0, 1, 0},
+{ 5, s_4_19, -1, 14, 0},
+{ 4, s_4_20, -2, 15, 0},
+{ 5, s_4_21, -1, 12, 0},
+{ 5, s_4_22, -2, 7, 0},
+{ 4, s_4_23, -5, 27, 0},
+{ 5, s_4_24, -6, 17, 0},
+{ 5, s_4_25, -7, 22, 0},
+{ 6, s_4_26, -8, 25, 0},
+{ 6, s_4_27, -9, 24, 0},
+{ 4, s_4_28, -10, 26, 0},
+{ 5, s_4_29, -11, 20, 0},
+{ 4, s_4_30, -12, 11, 0},
+{ 2, s_4_31, -13, 4, 0},
+{ 6, s_4_32, -1, 9, 0},
+{ 6, s_4_33, -2, 13, 0},
+{ 6, s_4_34, -3, 8, 0},
+{ 5, s_4_35, -4, 19, 0},
+{ 3, s_4_36, -5, 1, 0},
+{ 4, s_4_37, -1, 1, 0},
+{ 3, s_4_38, -7, 1, 0},
+{ 6, s_4_39, -21, 10, 0},
+{ 5, s_4_40, -22, 18, 0},
+{ 6, s_4_41, -23, 16, 0},
+{ 2, s_4_42, -24, 1, 0},
+{ 6, s_4_43, -1, 5, 0},
+{ 4, s_4_44, -2, 1, 0},
+{ 5, s_4_45, -3, 6, 0},
+{ 5, s_4_46, -4, 1, 0},
+{ 6, s_4_47, -5, 29, 0},
+{ 6, s_4_48, -30, 23, 0},
+{ 7, s_4_49, -31, 28, 0},
+{ 5, s_4_50, -32, 30, 0},
+{ 5, s_4_51, -33, 21, 0},
+{ 3, s_4_52, -34, 5, 0},
+{ 1, s_4_53, 0, 1, 0},
+{ 2, s_4_54, -1, 4, 0},
+{ 3, s_4_55, -1, 1, 0},
+{ 2, s_4_56, -3, 1, 0},
+{ 3, s_4_57, -1, 4, 0},
+{ 3, s_4_58, -2, 3, 0},
+{ 2, s_4_59, -6, 1, 0},
+{ 3, s_4_60, -1, 2, 0},
+{ 4, s_4_61, -2, 1, 0},
+{ 3, s_4_62, -9, 1, 0},
+{ 5, s_4_63, -1, 1, 0},
+{ 1, s_4_64, 0, 1, 0},
+{ 2, s_4_65, -1, 4, 0},
+{ 3, s_4_66, -1, 1, 0},
+{ 3, s_4_67, -2, 1, 0},
+{ 2, s_4_68, -4, -1, 0},
+{ 3, s_4_69, -5, 1, 0},
+{ 3, s_4_70, -6, 3, 0},
+{ 4, s_4_71, -1, 4, 0},
+{ 2, s_4_72, 0, 1, 0},
+{ 3, s_4_73, -1, 4, 0},
+{ 4, s_4_74, -1, 1, 0},
+{ 4, s_4_75, -2, 1, 0},
+{ 4, s_4_76, -4, 3, 0},
+{ 5, s_4_77, -1, 4, 0},
+{ 2, s_4_78, 0, 32, 0}
+};
+
+static const symbol s_5_0[3] = { 0x5D5, 0x5E0, 0x5D2 };
+static const symbol s_5_1[4] = { 0x5E9, 0x5D0, 0x5E4, 0x5D8 };
+static const symbol s_5_2[3] = { 0x5D4, 0x5F2, 0x5D8 };
+static const symbol s_5_3[3] = { 0x5E7, 0x5F2, 0x5D8 };
+static const symbol s_5_4[4] = { 0x5D9, 0x5E7, 0x5F2, 0x5D8 };
+static const symbol s_5_5[1] = { 0x5DC };
+static const struct among a_5[6] = {
+{ 3, s_5_0, 0, 1, 0},
+{ 4, s_5_1, 0, 1, 0},
+{ 3, s_5_2, 0, 1, 0},
+{ 3, s_5_3, 0, 1, 0},
+{ 4, s_5_4, -1, 1, 0},
+{ 1, s_5_5, 0, 2, 0}
+};
+
+static const symbol s_6_0[2] = { 0x5D9, 0x5D2 };
+static const symbol s_6_1[2] = { 0x5D9, 0x5E7 };
+static const symbol s_6_2[3] = { 0x5D3, 0x5D9, 0x5E7 };
+static const symbol s_6_3[4] = { 0x5E0, 0x5D3, 0x5D9, 0x5E7 };
+static const symbol s_6_4[5] = { 0x5E2, 0x5E0, 0x5D3, 0x5D9, 0x5E7 };
+static const symbol s_6_5[4] = { 0x5D1, 0x5DC, 0x5D9, 0x5E7 };
+static const symbol s_6_6[4] = { 0x5D2, 0x5DC, 0x5D9, 0x5E7 };
+static const symbol s_6_7[3] = { 0x5E0, 0x5D9, 0x5E7 };
+static const symbol s_6_8[2] = { 0x5D9, 0x5E9 };
+static const struct among a_6[9] = {
+{ 2, s_6_0, 0, 1, 0},
+{ 2, s_6_1, 0, 1, 0},
+{ 3, s_6_2, -1, 1, 0},
+{ 4, s_6_3, -1, 1, 0},
+{ 5, s_6_4, -1, 1, 0},
+{ 4, s_6_5, -4, -1, 0},
+{ 4, s_6_6, -5, -1, 0},
+{ 3, s_6_7, -6, 1, 0},
+{ 2, s_6_8, 0, 1, 0}
+};
+
+static const unsigned char g_niked[] = { 255, 155, 6 };
+
+static const unsigned char g_vowel[] = { 33, 2, 4, 0, 6 };
+
+static const unsigned char g_consonant[] = { 239, 254, 253, 131 };
+
+static int r_prelude(struct SN_env * z) {
+    int among_var;
+    {
+        int v_1 = z->c;
+        while (1) {
+            int v_2 = z->c;
+            while (1) {
+                int v_3 = z->c;
+                z->bra = z->c;
+                among_var = find_among(z, a_0, 8, 0);
+                if (!among_var) goto lab2;
+                z->ket = z->c;
+                switch (among_var) {
+                    case 1:
+                        {
+                            int v_4 = z->c;
+                            if (z->c == z->l || z->p[z->c] != 0x5BC) goto lab3;
+                            z->c++;
+                            goto lab2;
+                        lab3:
+                            z->c = v_4;
+                        }
+                        {
+                            int ret = slice_from_s(z, 1, s_0);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 2:
+                        {
+                            int v_5 = z->c;
+                            if (z->c == z->l || z->p[z->c] != 0x5B4) goto lab4;
+                            z->c++;
+                            goto lab2;
+                        lab4:
+                            z->c = v_5;
+                        }
+                        {
+                            int ret = slice_from_s(z, 1, s_1);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 3:
+                        {
+                            int v_6 = z->c;
+                            if (z->c == z->l || z->p[z->c] != 0x5B4) goto lab5;
+                            z->c++;
+                            goto lab2;
+                        lab5:
+                            z->c = v_6;
+                        }
+                        {
+                            int ret = slice_from_s(z, 1, s_2);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 4:
+                        {
+                            int ret = slice_from_s(z, 1, s_3);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 5:
+                        {
+                            int ret = slice_from_s(z, 1, s_4);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 6:
+                        {
+                            int ret = slice_from_s(z, 1, s_5);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 7:
+                        {
+                            int ret = slice_from_s(z, 1, s_6);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 8:
+                        {
+                            int ret = slice_from_s(z, 1, s_7);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                }
+                z->c = v_3;
+                break;
+            lab2:
+                z->c = v_3;
+                if (z->c >= z->l) goto lab1;
+                z->c++;
+            }
+            continue;
+        lab1:
+            z->c = v_2;
+            break;
+        }
+        z->c = v_1;
+    }
+    {
+        int v_7 = z->c;
+        while (1) {
+            int v_8 = z->c;
+            while (1) {
+                int v_9 = z->c;
+                z->bra = z->c;
+                if (in_grouping(z, g_niked, 1456, 1474, 0)) goto lab8;
+                z->ket = z->c;
+                {
+                    int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                z->c = v_9;
+                break;
+            lab8:
+                z->c = v_9;
+                if (z->c >= z->l) goto lab7;
+                z->c++;
+            }
+            continue;
+        lab7:
+            z->c = v_8;
+            break;
+        }
+        z->c = v_7;
+    }
+    return 1;
+}
+
+static int r_mark_regions(struct SN_env * z) {
+    int i_x;
+    ((SN_local *)z)->i_p1 = z->l;
+    {
+        int v_1 = z->c;
+        z->bra = z->c;
+        if (!(eq_s(z, 2, s_8))) { z->c = v_1; goto lab0; }
+        z->ket = z->c;
+        {
+            int v_2 = z->c;
+            do {
+                int v_3 = z->c;
+                if (!(eq_s(z, 2, s_9))) goto lab2;
+                break;
+            lab2:
+                z->c = v_3;
+                if (!(eq_s(z, 2, s_10))) goto lab3;
+                break;
+            lab3:
+                z->c = v_3;
+                if (z->c < z->l) goto lab1;
+            } while (0);
+            { z->c = v_1; goto lab0; }
+        lab1:
+            z->c = v_2;
+        }
+        {
+            int ret = slice_from_s(z, 2, s_11);
+            if (ret < 0) return ret;
+        }
+    lab0:
+        ;
+    }
+    {
+        int v_4 = z->c;
+        if (!find_among(z, a_1, 40, 0)) { z->c = v_4; goto lab4; }
+        do {
+            int v_5 = z->c;
+            {
+                int v_6 = z->c;
+                do {
+                    int v_7 = z->c;
+                    if (!(eq_s(z, 4, s_12))) goto lab6;
+                    break;
+                lab6:
+                    z->c = v_7;
+                    if (!(eq_s(z, 4, s_13))) goto lab7;
+                    break;
+                lab7:
+                    z->c = v_7;
+                    if (!(eq_s(z, 4, s_14))) goto lab5;
+                } while (0);
+                if (z->c < z->l) goto lab5;
+                z->c = v_6;
+            }
+            break;
+        lab5:
+            z->c = v_5;
+            {
+                int v_8 = z->c;
+                if (!(eq_s(z, 4, s_15))) goto lab8;
+                z->c = v_8;
+            }
+            break;
+        lab8:
+            z->c = v_5;
+            z->bra = z->c;
+            if (!(eq_s(z, 2, s_16))) goto lab9;
+            z->ket = z->c;
+            {
+                int ret = slice_from_s(z, 2, s_17);
+                if (ret < 0) return ret;
+            }
+            break;
+        lab9:
+            z->c = v_5;
+            z->bra = z->c;
+            if (!(eq_s(z, 2, s_18))) { z->c = v_4; goto lab4; }
+            z->ket = z->c;
+            {
+                int ret = slice_from_s(z, 3, s_19);
+                if (ret < 0) return ret;
+            }
+        } while (0);
+    lab4:
+        ;
+    }
+    {
+        int v_9 = z->c;
+        if (z->c + 3 > z->l) return 0;
+        z->c += 3;
+        i_x = z->c;
+        z->c = v_9;
+    }
+    {
+        int v_10 = z->c;
+        if (z->c + 2 >= z->l || (z->p[z->c + 2] != 1513 && z->p[z->c + 2] != 1512)) { z->c = v_10; goto lab10; }
+        if (!find_among(z, a_2, 4, 0)) { z->c = v_10; goto lab10; }
+    lab10:
+        ;
+    }
+    {
+        int v_11 = z->c;
+        if (in_grouping(z, g_consonant, 1489, 1520, 0)) goto lab11;
+        if (in_grouping(z, g_consonant, 1489, 1520, 0)) goto lab11;
+        if (in_grouping(z, g_consonant, 1489, 1520, 0)) goto lab11;
+        ((SN_local *)z)->i_p1 = z->c;
+        return 0;
+    lab11:
+        z->c = v_11;
+    }
+    {
+        int ret = out_grouping(z, g_vowel, 1488, 1522, 1);
+        if (ret < 0) return 0;
+        z->c += ret;
+    }
+    if (in_grouping(z, g_vowel, 1488, 1522, 1) < 0) return 0;
+    ((SN_local *)z)->i_p1 = z->c;
+    if (((SN_local *)z)->i_p1 >= i_x) goto lab12;
+    ((SN_local *)z)->i_p1 = i_x;
+lab12:
+    return 1;
+}
+
+static int r_R1(struct SN_env * z) {
+    return ((SN_local *)z)->i_p1 <= z->c;
+}
+
+static int r_R1plus3(struct SN_env * z) {
+    return ((SN_local *)z)->i_p1 <= (z->c + 3);
+}
+
+static int r_standard_suffix(struct SN_env * z) {
+    int among_var;
+    {
+        int v_1 = z->l - z->c;
+        z->ket = z->c;
+        among_var = find_among_b(z, a_4, 79, 0);
+        if (!among_var) goto lab0;
+        z->bra = z->c;
+        switch (among_var) {
+            case 1:
+                {
+                    int ret = r_R1(z);
+                    if (ret == 0) goto lab0;
+                    if (ret < 0) return ret;
+                }
+                {
+                    int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {
+                    int ret = r_R1(z);
+                    if (ret == 0) goto lab0;
+                    if (ret < 0) return ret;
+                }
+                {
+                    int ret = slice_from_s(z, 2, s_20);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                {
+                    int ret = r_R1(z);
+                    if (ret == 0) goto lab0;
+                    if (ret < 0) return ret;
+                }
+                {
+                    int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                z->ket = z->c;
+                among_var = find_among_b(z, a_3, 26, 0);
+                if (!among_var) goto lab0;
+                z->bra = z->c;
+                switch (among_var) {
+                    case 1:
+                        {
+                            int ret = slice_from_s(z, 2, s_21);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 2:
+                        {
+                            int ret = slice_from_s(z, 3, s_22);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 3:
+                        {
+                            int ret = slice_from_s(z, 3, s_23);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 4:
+                        {
+                            int ret = slice_from_s(z, 3, s_24);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 5:
+                        {
+                            int ret = slice_from_s(z, 3, s_25);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 6:
+                        {
+                            int ret = slice_from_s(z, 3, s_26);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 7:
+                        {
+                            int ret = slice_from_s(z, 4, s_27);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 8:
+                        {
+                            int ret = slice_from_s(z, 3, s_28);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 9:
+                        {
+                            int ret = slice_from_s(z, 4, s_29);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 10:
+                        {
+                            int ret = slice_from_s(z, 3, s_30);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 11:
+                        {
+                            int ret = slice_from_s(z, 3, s_31);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 12:
+                        {
+                            int ret = slice_from_s(z, 4, s_32);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 13:
+                        {
+                            int ret = slice_from_s(z, 4, s_33);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 14:
+                        {
+                            int ret = slice_from_s(z, 4, s_34);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 15:
+                        {
+                            int ret = slice_from_s(z, 4, s_35);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 16:
+                        {
+                            int ret = slice_from_s(z, 4, s_36);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 17:
+                        {
+                            int ret = slice_from_s(z, 4, s_37);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 18:
+                        {
+                            int ret = slice_from_s(z, 4, s_38);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 19:
+                        {
+                            int ret = slice_from_s(z, 5, s_39);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 20:
+                        {
+                            int ret = slice_from_s(z, 5, s_40);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 21:
+                        {
+                            int ret = slice_from_s(z, 5, s_41);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 22:
+                        {
+                            int ret = slice_from_s(z, 3, s_42);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 23:
+                        {
+                            int ret = slice_from_s(z, 3, s_43);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 24:
+                        {
+                            int ret = slice_from_s(z, 6, s_44);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 25:
+                        {
+                            int ret = slice_from_s(z, 3, s_45);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 26:
+                        {
+                            int ret = slice_from_s(z, 4, s_46);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                }
+                break;
+            case 4:
+                do {
+                    int v_2 = z->l - z->c;
+                    {
+                        int ret = r_R1(z);
+                        if (ret == 0) goto lab1;
+                        if (ret < 0) return ret;
+                    }
+                    {
+                        int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                lab1:
+                    z->c = z->l - v_2;
+                    {
+                        int ret = slice_from_s(z, 1, s_47);
+                        if (ret < 0) return ret;
+                    }
+                } while (0);
+                z->ket = z->c;
+                if (!(eq_s_b(z, 4, s_48))) goto lab0;
+                {
+                    int v_3 = z->l - z->c;
+                    if (!(eq_s_b(z, 2, s_49))) { z->c = z->l - v_3; goto lab2; }
+                lab2:
+                    ;
+                }
+                z->bra = z->c;
+                {
+                    int ret = slice_from_s(z, 5, s_50);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 5:
+                {
+                    int ret = slice_from_s(z, 2, s_51);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 6:
+                {
+                    int ret = slice_from_s(z, 3, s_52);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 7:
+                {
+                    int ret = slice_from_s(z, 4, s_53);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 8:
+                {
+                    int ret = slice_from_s(z, 3, s_54);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 9:
+                {
+                    int ret = slice_from_s(z, 3, s_55);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 10:
+                {
+                    int ret = slice_from_s(z, 3, s_56);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 11:
+                {
+                    int ret = slice_from_s(z, 3, s_57);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 12:
+                {
+                    int ret = slice_from_s(z, 4, s_58);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 13:
+                {
+                    int ret = slice_from_s(z, 3, s_59);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 14:
+                {
+                    int ret = slice_from_s(z, 4, s_60);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 15:
+                {
+                    int ret = slice_from_s(z, 3, s_61);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 16:
+                {
+                    int ret = slice_from_s(z, 3, s_62);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 17:
+                {
+                    int ret = slice_from_s(z, 4, s_63);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 18:
+                {
+                    int ret = slice_from_s(z, 4, s_64);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 19:
+                {
+                    int ret = slice_from_s(z, 4, s_65);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 20:
+                {
+                    int ret = slice_from_s(z, 4, s_66);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 21:
+                {
+                    int ret = slice_from_s(z, 4, s_67);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 22:
+                {
+                    int ret = slice_from_s(z, 4, s_68);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 23:
+                {
+                    int ret = slice_from_s(z, 5, s_69);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 24:
+                {
+                    int ret = slice_from_s(z, 5, s_70);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 25:
+                {
+                    int ret = slice_from_s(z, 5, s_71);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 26:
+                {
+                    int ret = slice_from_s(z, 3, s_72);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 27:
+                {
+                    int ret = slice_from_s(z, 3, s_73);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 28:
+                {
+                    int ret = slice_from_s(z, 6, s_74);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 29:
+                {
+                    int ret = slice_from_s(z, 3, s_75);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 30:
+                {
+                    int ret = slice_from_s(z, 4, s_76);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 31:
+                {
+                    int ret = slice_from_s(z, 5, s_77);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 32:
+                {
+                    int ret = r_R1(z);
+                    if (ret == 0) goto lab0;
+                    if (ret < 0) return ret;
+                }
+                {
+                    int ret = slice_from_s(z, 1, s_78);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 33:
+                do {
+                    int v_4 = z->l - z->c;
+                    do {
+                        int v_5 = z->l - z->c;
+                        if (z->c <= z->lb || z->p[z->c - 1] != 0x5D2) goto lab4;
+                        z->c--;
+                        break;
+                    lab4:
+                        z->c = z->l - v_5;
+                        if (z->c <= z->lb || z->p[z->c - 1] != 0x5E9) goto lab3;
+                        z->c--;
+                    } while (0);
+                    {
+                        int v_6 = z->l - z->c;
+                        {
+                            int ret = r_R1plus3(z);
+                            if (ret == 0) { z->c = z->l - v_6; goto lab5; }
+                            if (ret < 0) return ret;
+                        }
+                        {
+                            int ret = slice_from_s(z, 2, s_79);
+                            if (ret < 0) return ret;
+                        }
+                    lab5:
+                        ;
+                    }
+                    break;
+                lab3:
+                    z->c = z->l - v_4;
+                    {
+                        int ret = r_R1(z);
+                        if (ret == 0) goto lab0;
+                        if (ret < 0) return ret;
+                    }
+                    {
+                        int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                } while (0);
+                break;
+        }
+    lab0:
+        z->c = z->l - v_1;
+    }
+    {
+        int v_7 = z->l - z->c;
+        z->ket = z->c;
+        if (z->c <= z->lb || z->p[z->c - 1] >> 5 != 46 || !((285474816 >> (z->p[z->c - 1] & 0x1f)) & 1)) goto lab6;
+        among_var = find_among_b(z, a_5, 6, 0);
+        if (!among_var) goto lab6;
+        z->bra = z->c;
+        switch (among_var) {
+            case 1:
+                {
+                    int ret = r_R1(z);
+                    if (ret == 0) goto lab6;
+                    if (ret < 0) return ret;
+                }
+                {
+                    int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {
+                    int ret = r_R1(z);
+                    if (ret == 0) goto lab6;
+                    if (ret < 0) return ret;
+                }
+                if (in_grouping_b(z, g_consonant, 1489, 1520, 0)) goto lab6;
+                {
+                    int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab6:
+        z->c = z->l - v_7;
+    }
+    {
+        int v_8 = z->l - z->c;
+        z->ket = z->c;
+        among_var = find_among_b(z, a_6, 9, 0);
+        if (!among_var) goto lab7;
+        z->bra = z->c;
+        switch (among_var) {
+            case 1:
+                {
+                    int ret = r_R1(z);
+                    if (ret == 0) goto lab7;
+                    if (ret < 0) return ret;
+                }
+                {
+                    int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab7:
+        z->c = z->l - v_8;
+    }
+    {
+        int v_9 = z->l - z->c;
+        while (1) {
+            int v_10 = z->l - z->c;
+            while (1) {
+                int v_11 = z->l - z->c;
+                z->ket = z->c;
+                do {
+                    int v_12 = z->l - z->c;
+                    if (!(eq_s_b(z, 2, s_80))) goto lab11;
+                    break;
+                lab11:
+                    z->c = z->l - v_12;
+                    if (!(eq_s_b(z, 3, s_81))) goto lab10;
+                } while (0);
+                z->bra = z->c;
+                {
+                    int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                z->c = z->l - v_11;
+                break;
+            lab10:
+                z->c = z->l - v_11;
+                if (z->c <= z->lb) goto lab9;
+                z->c--;
+            }
+            continue;
+        lab9:
+            z->c = z->l - v_10;
+            break;
+        }
+        z->c = z->l - v_9;
+    }
+    return 1;
+}
+
+extern int yiddish_UTF_16_stem(struct SN_env * z) {
+    {
+        int ret = r_prelude(z);
+        if (ret < 0) return ret;
+    }
+    {
+        int v_1 = z->c;
+        {
+            int ret = r_mark_regions(z);
+            if (ret < 0) return ret;
+        }
+        z->c = v_1;
+    }
+    z->lb = z->c; z->c = z->l;
+    {
+        int ret = r_standard_suffix(z);
+        if (ret < 0) return ret;
+    }
+    z->c = z->lb;
+    return 1;
+}
+
+extern struct SN_env * yiddish_UTF_16_create_env(void) {
+    return yiddish_UTF_16_create_env_with_allocator(NULL);
+}
+
+extern struct SN_env * yiddish_UTF_16_create_env_with_allocator(const struct SN_allocator * allocator) {
+    struct SN_env * z = SN_new_env_with_allocator(sizeof(SN_local), allocator);
+    if (z) {
+        ((SN_local *)z)->i_p1 = 0;
+    }
+    return z;
+}
+
+extern void yiddish_UTF_16_close_env(struct SN_env * z) {
+    SN_delete_env(z);
+}
+
@@ -0,0 +1,718 @@
+/* Generated from armenian.sbl by Snowball 3.0.0 - https://snowballstem.org/ */
+
+#include "stem_UTF_8_armenian.h"
+
+#include <stddef.h>
+
+#include "../runtime/snowball_runtime.h"
+
+struct SN_local {
+    struct SN_env z;
+    int i_p2;
+    int i_pV;
+};
+
+typedef struct SN_local SN_local;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int armenian_UTF_8_stem(struct SN_env * z);
+extern int armenian_UTF_8_stem_ascii(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+
+static int r_ending(struct SN_env * z);
+static int r_ending_ascii(struct SN_env * z);
+static int r_noun(struct SN_env * z);
+static int r_noun_ascii(struct SN_env * z);
+static int r_verb(struct SN_env * z);
+static int r_verb_ascii(struct SN_env * z);
+static int r_adjective(struct SN_env * z);
+static int r_adjective_ascii(struct SN_env * z);
+static int r_R2(struct SN_env * z);
+static int r_R2_ascii(struct SN_env * z);
+static int r_mark_regions(struct SN_env * z);
+static int r_mark_regions_ascii(struct SN_env * z);
+
+
+static const symbol s_0_0[6] = { 0xD5, 0xA2, 0xD5, 0xA1, 0xD6, 0x80 };
+static const symbol s_0_1[8] = { 0xD6, 0x80, 0xD5, 0xB8, 0xD6, 0x80, 0xD5, 0xA4 };
+static const symbol s_0_2[10] = { 0xD5, 0xA5, 0xD6, 0x80, 0xD5, 0xB8, 0xD6, 0x80, 0xD5, 0xA4 };
+static const symbol s_0_3[6] = { 0xD5, 0xA1, 0xD5, 0xAC, 0xD5, 0xAB };
+static const symbol s_0_4[6] = { 0xD5, 0xA1, 0xD5, 0xAF, 0xD5, 0xAB };
+static const symbol s_0_5[8] = { 0xD5, 0xB8, 0xD6, 0x80, 0xD5, 0xA1, 0xD5, 0xAF };
+static const symbol s_0_6[4] = { 0xD5, 0xA5, 0xD5, 0xB2 };
+static const symbol s_0_7[8] = { 0xD5, 0xBE, 0xD5, 0xB8, 0xD6, 0x82, 0xD5, 0xB6 };
+static const symbol s_0_8[8] = { 0xD5, 0xA1, 0xD6, 0x80, 0xD5, 0xA1, 0xD5, 0xB6 };
+static const symbol s_0_9[8] = { 0xD5, 0xA1, 0xD5, 0xAF, 0xD5, 0xA1, 0xD5, 0xB6 };
+static const symbol s_0_10[4] = { 0xD5, 0xA5, 0xD5, 0xB6 };
+static const symbol s_0_11[8] = { 0xD5, 0xA5, 0xD6, 0x80, 0xD5, 0xA5, 0xD5, 0xB6 };
+static const symbol s_0_12[8] = { 0xD5, 0xA5, 0xD5, 0xAF, 0xD5, 0xA5, 0xD5, 0xB6 };
+static const symbol s_0_13[8] = { 0xD5, 0xB8, 0xD6, 0x80, 0xD5, 0xA7, 0xD5, 0xB6 };
+static const symbol s_0_14[4] = { 0xD5, 0xAB, 0xD5, 0xB6 };
+static const symbol s_0_15[6] = { 0xD5, 0xA3, 0xD5, 0xAB, 0xD5, 0xB6 };
+static const symbol s_0_16[8] = { 0xD5, 0xB8, 0xD5, 0xBE, 0xD5, 0xAB, 0xD5, 0xB6 };
+static const symbol s_0_17[8] = { 0xD5, 0xAC, 0xD5, 0xA1, 0xD5, 0xB5, 0xD5, 0xB6 };
+static const symbol s_0_18[6] = { 0xD5, 0xBA, 0xD5, 0xA5, 0xD5, 0xBD };
+static const symbol s_0_19[4] = { 0xD5, 0xAB, 0xD5, 0xBE };
+static const symbol s_0_20[4] = { 0xD5, 0xA1, 0xD5, 0xBF };
+static const symbol s_0_21[8] = { 0xD5, 0xA1, 0xD5, 0xBE, 0xD5, 0xA5, 0xD5, 0xBF };
+static const symbol s_0_22[6] = { 0xD5, 0xAF, 0xD5, 0xB8, 0xD5, 0xBF };
+static const struct among a_0[23] = {
+{ 6, s_0_0, 0, 1, 0},
+{ 8, s_0_1, 0, 1, 0},
+{ 10, s_0_2, -1, 1, 0},
+{ 6, s_0_3, 0, 1, 0},
+{ 6, s_0_4, 0, 1, 0},
+{ 8, s_0_5, 0, 1, 0},
+{ 4, s_0_6, 0, 1, 0},
+{ 8, s_0_7, 0, 1, 0},
+{ 8, s_0_8, 0, 1, 0},
+{ 8, s_0_9, 0, 1, 0},
+{ 4, s_0_10, 0, 1, 0},
+{ 8, s_0_11, -1, 1, 0},
+{ 8, s_0_12, -2, 1, 0},
+{ 8, s_0_13, 0, 1, 0},
+{ 4, s_0_14, 0, 1, 0},
+{ 6, s_0_15, -1, 1, 0},
+{ 8, s_0_16, -2, 1, 0},
+{ 8, s_0_17, 0, 1, 0},
+{ 6, s_0_18, 0, 1, 0},
+{ 4, s_0_19, 0, 1, 0},
+{ 4, s_0_20, 0, 1, 0},
+{ 8, s_0_21, 0, 1, 0},
+{ 6, s_0_22, 0, 1, 0}
+};
+
+static const symbol s_1_0[4] = { 0xD5, 0xA1, 0xD6, 0x80 };
+static const symbol s_1_1[8] = { 0xD5, 0xA1, 0xD6, 0x81, 0xD5, 0xA1, 0xD6, 0x80 };
+static const symbol s_1_2[8] = { 0xD5, 0xA5, 0xD6, 0x81, 0xD5, 0xA1, 0xD6, 0x80 };
+static const symbol s_1_3[10] = { 0xD5, 0xA1, 0xD6, 0x81, 0xD6, 0x80, 0xD5, 0xAB, 0xD6, 0x80 };
+static const symbol s_1_4[8] = { 0xD5, 0xA1, 0xD6, 0x81, 0xD5, 0xAB, 0xD6, 0x80 };
+static const symbol s_1_5[8] = { 0xD5, 0xA5, 0xD6, 0x81, 0xD5, 0xAB, 0xD6, 0x80 };
+static const symbol s_1_6[10] = { 0xD5, 0xBE, 0xD5, 0xA5, 0xD6, 0x81, 0xD5, 0xAB, 0xD6, 0x80 };
+static const symbol s_1_7[10] = { 0xD5, 0xA1, 0xD5, 0xAC, 0xD5, 0xB8, 0xD6, 0x82, 0xD6, 0x81 };
+static const symbol s_1_8[10] = { 0xD5, 0xA5, 0xD5, 0xAC, 0xD5, 0xB8, 0xD6, 0x82, 0xD6, 0x81 };
+static const symbol s_1_9[4] = { 0xD5, 0xA1, 0xD6, 0x81 };
+static const symbol s_1_10[4] = { 0xD5, 0xA5, 0xD6, 0x81 };
+static const symbol s_1_11[10] = { 0xD5, 0xA1, 0xD6, 0x81, 0xD6, 0x80, 0xD5, 0xA5, 0xD6, 0x81 };
+static const symbol s_1_12[8] = { 0xD5, 0xA1, 0xD5, 0xAC, 0xD5, 0xB8, 0xD6, 0x82 };
+static const symbol s_1_13[8] = { 0xD5, 0xA5, 0xD5, 0xAC, 0xD5, 0xB8, 0xD6, 0x82 };
+static const symbol s_1_14[4] = { 0xD5, 0xA1, 0xD6, 0x84 };
+static const symbol s_1_15[6] = { 0xD6, 0x81, 0xD5, 0xA1, 0xD6, 0x84 };
+static const symbol s_1_16[8] = { 0xD5, 0xA1, 0xD6, 0x81, 0xD5, 0xA1, 0xD6, 0x84 };
+static const symbol s_1_17[10] = { 0xD5, 0xA1, 0xD6, 0x81, 0xD6, 0x80, 0xD5, 0xAB, 0xD6, 0x84 };
+static const symbol s_1_18[8] = { 0xD5, 0xA1, 0xD6, 0x81, 0xD5, 0xAB, 0xD6, 0x84 };
+static const symbol s_1_19[8] = { 0xD5, 0xA5, 0xD6, 0x81, 0xD5, 0xAB, 0xD6, 0x84 };
+static const symbol s_1_20[10] = { 0xD5, 0xBE, 0xD5, 0xA5, 0xD6, 0x81, 0xD5, 0xAB, 0xD6, 0x84 };
+static const symbol s_1_21[6] = { 0xD5, 0xA1, 0xD5, 0xB6, 0xD6, 0x84 };
+static const symbol s_1_22[8] = { 0xD6, 0x81, 0xD5, 0xA1, 0xD5, 0xB6, 0xD6, 0x84 };
+static const symbol s_1_23[10] = { 0xD5, 0xA1, 0xD6, 0x81, 0xD5, 0xA1, 0xD5, 0xB6, 0xD6, 0x84 };
+static const symbol s_1_24[12] = { 0xD5, 0xA1, 0xD6, 0x81, 0xD6, 0x80, 0xD5, 0xAB, 0xD5, 0xB6, 0xD6, 0x84 };
+static const symbol s_1_25[10] = { 0xD5, 0xA1, 0xD6, 0x81, 0xD5, 0xAB, 0xD5, 0xB6, 0xD6, 0x84 };
+static const symbol s_1_26[10] = { 0xD5, 0xA5, 0xD6, 0x81, 0xD5, 0xAB, 0xD5, 0xB6, 0xD6, 0x84 };
+static const symbol s_1_27[12] = { 0xD5, 0xBE, 0xD5, 0xA5, 0xD6, 0x81, 0xD5, 0xAB, 0xD5, 0xB6, 0xD6, 0x84 };
+static const symbol s_1_28[2] = { 0xD5, 0xA1 };
+static const symbol s_1_29[6] = { 0xD5, 0xA1, 0xD6, 0x81, 0xD5, 0xA1 };
+static const symbol s_1_30[6] = { 0xD5, 0xA5, 0xD6, 0x81, 0xD5, 0xA1 };
+static const symbol s_1_31[4] = { 0xD5, 0xBE, 0xD5, 0xA5 };
+static const symbol s_1_32[8] = { 0xD5, 0xA1, 0xD6, 0x81, 0xD6, 0x80, 0xD5, 0xAB };
+static const symbol s_1_33[6] = { 0xD5, 0xA1, 0xD6, 0x81, 0xD5, 0xAB };
+static const symbol s_1_34[6] = { 0xD5, 0xA5, 0xD6, 0x81, 0xD5, 0xAB };
+static const symbol s_1_35[8] = { 0xD5, 0xBE, 0xD5, 0xA5, 0xD6, 0x81, 0xD5, 0xAB };
+static const symbol s_1_36[4] = { 0xD5, 0xA1, 0xD5, 0xAC };
+static const symbol s_1_37[6] = { 0xD5, 0xA8, 0xD5, 0xA1, 0xD5, 0xAC };
+static const symbol s_1_38[10] = { 0xD5, 0xA1, 0xD6, 0x81, 0xD5, 0xB6, 0xD5, 0xA1, 0xD5, 0xAC };
+static const symbol s_1_39[8] = { 0xD5, 0xA1, 0xD5, 0xB6, 0xD5, 0xA1, 0xD5, 0xAC };
+static const symbol s_1_40[8] = { 0xD5, 0xA5, 0xD5, 0xB6, 0xD5, 0xA1, 0xD5, 0xAC };
+static const symbol s_1_41[4] = { 0xD5, 0xA5, 0xD5, 0xAC };
+static const symbol s_1_42[6] = { 0xD5, 0xA8, 0xD5, 0xA5, 0xD5, 0xAC };
+static const symbol s_1_43[6] = { 0xD5, 0xB6, 0xD5, 0xA5, 0xD5, 0xAC };
+static const symbol s_1_44[8] = { 0xD6, 0x81, 0xD5, 0xB6, 0xD5, 0xA5, 0xD5, 0xAC };
+static const symbol s_1_45[10] = { 0xD5, 0xA5, 0xD6, 0x81, 0xD5, 0xB6, 0xD5, 0xA5, 0xD5, 0xAC };
+static const symbol s_1_46[6] = { 0xD5, 0xB9, 0xD5, 0xA5, 0xD5, 0xAC };
+static const symbol s_1_47[6] = { 0xD5, 0xBE, 0xD5, 0xA5, 0xD5, 0xAC };
+static const symbol s_1_48[10] = { 0xD5, 0xA1, 0xD6, 0x81, 0xD5, 0xBE, 0xD5, 0xA5, 0xD5, 0xAC };
+static const symbol s_1_49[10] = { 0xD5, 0xA5, 0xD6, 0x81, 0xD5, 0xBE, 0xD5, 0xA5, 0xD5, 0xAC };
+static const symbol s_1_50[6] = { 0xD5, 0xBF, 0xD5, 0xA5, 0xD5, 0xAC };
+static const symbol s_1_51[8] = { 0xD5, 0xA1, 0xD5, 0xBF, 0xD5, 0xA5, 0xD5, 0xAC };
+static const symbol s_1_52[8] = { 0xD5, 0xB8, 0xD5, 0xBF, 0xD5, 0xA5, 0xD5, 0xAC };
+static const symbol s_1_53[10] = { 0xD5, 0xAF, 0xD5, 0xB8, 0xD5, 0xBF, 0xD5, 0xA5, 0xD5, 0xAC };
+static const symbol s_1_54[6] = { 0xD5, 0xBE, 0xD5, 0xA1, 0xD5, 0xAE };
+static const symbol s_1_55[6] = { 0xD5, 0xB8, 0xD6, 0x82, 0xD5, 0xB4 };
+static const symbol s_1_56[8] = { 0xD5, 0xBE, 0xD5, 0xB8, 0xD6, 0x82, 0xD5, 0xB4 };
+static const symbol s_1_57[4] = { 0xD5, 0xA1, 0xD5, 0xB6 };
+static const symbol s_1_58[6] = { 0xD6, 0x81, 0xD5, 0xA1, 0xD5, 0xB6 };
+static const symbol s_1_59[8] = { 0xD5, 0xA1, 0xD6, 0x81, 0xD5, 0xA1, 0xD5, 0xB6 };
+static const symbol s_1_60[10] = { 0xD5, 0xA1, 0xD6, 0x81, 0xD6, 0x80, 0xD5, 0xAB, 0xD5, 0xB6 };
+static const symbol s_1_61[8] = { 0xD5, 0xA1, 0xD6, 0x81, 0xD5, 0xAB, 0xD5, 0xB6 };
+static const symbol s_1_62[8] = { 0xD5, 0xA5, 0xD6, 0x81, 0xD5, 0xAB, 0xD5, 0xB6 };
+static const symbol s_1_63[10] = { 0xD5, 0xBE, 0xD5, 0xA5, 0xD6, 0x81, 0xD5, 0xAB, 0xD5, 0xB6 };
+static const symbol s_1_64[8] = { 0xD5, 0xA1, 0xD5, 0xAC, 0xD5, 0xAB, 0xD5, 0xBD };
+static const symbol s_1_65[8] = { 0xD5, 0xA5, 0xD5, 0xAC, 0xD5, 0xAB, 0xD5, 0xBD };
+static const symbol s_1_66[4] = { 0xD5, 0xA1, 0xD5, 0xBE };
+static const symbol s_1_67[8] = { 0xD5, 0xA1, 0xD6, 0x81, 0xD5, 0xA1, 0xD5, 0xBE };
+static const symbol s_1_68[8] = { 0xD5, 0xA5, 0xD6, 0x81, 0xD5, 0xA1, 0xD5, 0xBE };
+static const symbol s_1_69[8] = { 0xD5, 0xA1, 0xD5, 0xAC, 0xD5, 0xB8, 0xD5, 0xBE };
+static const symbol s_1_70[8] = { 0xD5, 0xA5, 0xD5, 0xAC, 0xD5, 0xB8, 0xD5, 0xBE };
+static const struct among a_1[71] = {
+{ 4, s_1_0, 0, 1, 0},
+{ 8, s_1_1, -1, 1, 0},
+{ 8, s_1_2, -2, 1, 0},
+{ 10, s_1_3, 0, 1, 0},
+{ 8, s_1_4, 0, 1, 0},
+{ 8, s_1_5, 0, 1, 0},
+{ 10, s_1_6, -1, 1, 0},
+{ 10, s_1_7, 0, 1, 0},
+{ 10, s_1_8, 0, 1, 0},
+{ 4, s_1_9, 0, 1, 0},
+{ 4, s_1_10, 0, 1, 0},
+{ 10, s_1_11, -1, 1, 0},
+{ 8, s_1_12, 0, 1, 0},
+{ 8, s_1_13, 0, 1, 0},
+{ 4, s_1_14, 0, 1, 0},
+{ 6, s_1_15, -1, 1, 0},
+{ 8, s_1_16, -1, 1, 0},
+{ 10, s_1_17, 0, 1, 0},
+{ 8, s_1_18, 0, 1, 0},
+{ 8, s_1_19, 0, 1, 0},
+{ 10, s_1_20, -1, 1, 0},
+{ 6, s_1_21, 0, 1, 0},
+{ 8, s_1_22, -1, 1, 0},
+{ 10, s_1_23, -1, 1, 0},
+{ 12, s_1_24, 0, 1, 0},
+{ 10, s_1_25, 0, 1, 0},
+{ 10, s_1_26, 0, 1, 0},
+{ 12, s_1_27, -1, 1, 0},
+{ 2, s_1_28, 0, 1, 0},
+{ 6, s_1_29, -1, 1, 0},
+{ 6, s_1_30, -2, 1, 0},
+{ 4, s_1_31, 0, 1, 0},
+{ 8, s_1_32, 0, 1, 0},
+{ 6, s_1_33, 0, 1, 0},
+{ 6, s_1_34, 0, 1, 0},
+{ 8, s_1_35, -1, 1, 0},
+{ 4, s_1_36, 0, 1, 0},
+{ 6, s_1_37, -1, 1, 0},
+{ 10, s_1_38, -2, 1, 0},
+{ 8, s_1_39, -3, 1, 0},
+{ 8, s_1_40, -4, 1, 0},
+{ 4, s_1_41, 0, 1, 0},
+{ 6, s_1_42, -1, 1, 0},
+{ 6, s_1_43, -2, 1, 0},
+{ 8, s_1_44, -1, 1, 0},
+{ 10, s_1_45, -1, 1, 0},
+{ 6, s_1_46, -5, 1, 0},
+{ 6, s_1_47, -6, 1, 0},
+{ 10, s_1_48, -1, 1, 0},
+{ 10, s_1_49, -2, 1, 0},
+{ 6, s_1_50, -9, 1, 0},
+{ 8, s_1_51, -1, 1, 0},
+{ 8, s_1_52, -2, 1, 0},
+{ 10, s_1_53, -1, 1, 0},
+{ 6, s_1_54, 0, 1, 0},
+{ 6, s_1_55, 0, 1, 0},
+{ 8, s_1_56, -1, 1, 0},
+{ 4, s_1_57, 0, 1, 0},
+{ 6, s_1_58, -1, 1, 0},
+{ 8, s_1_59, -1, 1, 0},
+{ 10, s_1_60, 0, 1, 0},
+{ 8, s_1_61, 0, 1, 0},
+{ 8, s_1_62, 0, 1, 0},
+{ 10, s_1_63, -1, 1, 0},
+{ 8, s_1_64, 0, 1, 0},
+{ 8, s_1_65, 0, 1, 0},
+{ 4, s_1_66, 0, 1, 0},
+{ 8, s_1_67, -1, 1, 0},
+{ 8, s_1_68, -2, 1, 0},
+{ 8, s_1_69, 0, 1, 0},
+{ 8, s_1_70, 0, 1, 0}
+};
+
+static const symbol s_2_0[6] = { 0xD5, 0xA3, 0xD5, 0xA1, 0xD6, 0x80 };
+static const symbol s_2_1[6] = { 0xD5, 0xBE, 0xD5, 0xB8, 0xD6, 0x80 };
+static const symbol s_2_2[8] = { 0xD5, 0xA1, 0xD5, 0xBE, 0xD5, 0xB8, 0xD6, 0x80 };
+static const symbol s_2_3[8] = { 0xD5, 0xA1, 0xD5, 0xB6, 0xD6, 0x85, 0xD6, 0x81 };
+static const symbol s_2_4[4] = { 0xD5, 0xB8, 0xD6, 0x81 };
+static const symbol s_2_5[4] = { 0xD5, 0xB8, 0xD6, 0x82 };
+static const symbol s_2_6[2] = { 0xD6, 0x84 };
+static const symbol s_2_7[6] = { 0xD5, 0xA1, 0xD6, 0x80, 0xD6, 0x84 };
+static const symbol s_2_8[6] = { 0xD5, 0xB9, 0xD5, 0xA5, 0xD6, 0x84 };
+static const symbol s_2_9[4] = { 0xD5, 0xAB, 0xD6, 0x84 };
+static const symbol s_2_10[8] = { 0xD5, 0xA1, 0xD5, 0xAC, 0xD5, 0xAB, 0xD6, 0x84 };
+static const symbol s_2_11[8] = { 0xD5, 0xA1, 0xD5, 0xB6, 0xD5, 0xAB, 0xD6, 0x84 };
+static const symbol s_2_12[8] = { 0xD5, 0xBE, 0xD5, 0xA1, 0xD5, 0xAE, 0xD6, 0x84 };
+static const symbol s_2_13[8] = { 0xD5, 0xB8, 0xD6, 0x82, 0xD5, 0xB5, 0xD6, 0x84 };
+static const symbol s_2_14[8] = { 0xD5, 0xB8, 0xD6, 0x82, 0xD5, 0xB6, 0xD6, 0x84 };
+static const symbol s_2_15[10] = { 0xD5, 0xB4, 0xD5, 0xB8, 0xD6, 0x82, 0xD5, 0xB6, 0xD6, 0x84 };
+static const symbol s_2_16[6] = { 0xD5, 0xA5, 0xD5, 0xB6, 0xD6, 0x84 };
+static const symbol s_2_17[6] = { 0xD5, 0xB8, 0xD5, 0xB6, 0xD6, 0x84 };
+static const symbol s_2_18[6] = { 0xD5, 0xAB, 0xD5, 0xB9, 0xD6, 0x84 };
+static const symbol s_2_19[6] = { 0xD5, 0xB8, 0xD6, 0x80, 0xD5, 0xA4 };
+static const symbol s_2_20[8] = { 0xD5, 0xB8, 0xD6, 0x82, 0xD5, 0xB5, 0xD5, 0xA9 };
+static const symbol s_2_21[4] = { 0xD6, 0x81, 0xD5, 0xAB };
+static const symbol s_2_22[8] = { 0xD5, 0xB8, 0xD6, 0x82, 0xD5, 0xB0, 0xD5, 0xAB };
+static const symbol s_2_23[4] = { 0xD5, 0xAB, 0xD5, 0xAC };
+static const symbol s_2_24[6] = { 0xD5, 0xB8, 0xD6, 0x82, 0xD5, 0xAF };
+static const symbol s_2_25[4] = { 0xD5, 0xA1, 0xD5, 0xAF };
+static const symbol s_2_26[6] = { 0xD5, 0xB5, 0xD5, 0xA1, 0xD5, 0xAF };
+static const symbol s_2_27[8] = { 0xD5, 0xA1, 0xD5, 0xB6, 0xD5, 0xA1, 0xD5, 0xAF };
+static const symbol s_2_28[4] = { 0xD5, 0xAB, 0xD5, 0xAF };
+static const symbol s_2_29[8] = { 0xD5, 0xB5, 0xD5, 0xB8, 0xD6, 0x82, 0xD5, 0xB6 };
+static const symbol s_2_30[14] = { 0xD5, 0xB8, 0xD6, 0x82, 0xD5, 0xA9, 0xD5, 0xB5, 0xD5, 0xB8, 0xD6, 0x82, 0xD5, 0xB6 };
+static const symbol s_2_31[4] = { 0xD5, 0xA1, 0xD5, 0xB6 };
+static const symbol s_2_32[8] = { 0xD5, 0xA1, 0xD6, 0x80, 0xD5, 0xA1, 0xD5, 0xB6 };
+static const symbol s_2_33[6] = { 0xD5, 0xBA, 0xD5, 0xA1, 0xD5, 0xB6 };
+static const symbol s_2_34[8] = { 0xD5, 0xBD, 0xD5, 0xBF, 0xD5, 0xA1, 0xD5, 0xB6 };
+static const symbol s_2_35[8] = { 0xD5, 0xA5, 0xD5, 0xB2, 0xD5, 0xA7, 0xD5, 0xB6 };
+static const symbol s_2_36[6] = { 0xD5, 0xA1, 0xD5, 0xAE, 0xD5, 0xB8 };
+static const symbol s_2_37[4] = { 0xD5, 0xAB, 0xD5, 0xB9 };
+static const symbol s_2_38[6] = { 0xD5, 0xB8, 0xD6, 0x82, 0xD5, 0xBD };
+static const symbol s_2_39[8] = { 0xD5, 0xB8, 0xD6, 0x82, 0xD5, 0xBD, 0xD5, 0xBF };
+static const struct among a_2[40] = {
+{ 6, s_2_0, 0, 1, 0},
+{ 6, s_2_1, 0, 1, 0},
+{ 8, s_2_2, -1, 1, 0},
+{ 8, s_2_3, 0, 1, 0},
+{ 4, s_2_4, 0, 1, 0},
+{ 4, s_2_5, 0, 1, 0},
+{ 2, s_2_6, 0, 1, 0},
+{ 6, s_2_7, -1, 1, 0},
+{ 6, s_2_8, -2, 1, 0},
+{ 4, s_2_9, -3, 1, 0},
+{ 8, s_2_10, -1, 1, 0},
+{ 8, s_2_11, -2, 1, 0},
+{ 8, s_2_12, -6, 1, 0},
+{ 8, s_2_13, -7, 1, 0},
+{ 8, s_2_14, -8, 1, 0},
+{ 10, s_2_15, -1, 1, 0},
+{ 6, s_2_16, -10, 1, 0},
+{ 6, s_2_17, -11, 1, 0},
+{ 6, s_2_18, -12, 1, 0},
+{ 6, s_2_19, 0, 1, 0},
+{ 8, s_2_20, 0, 1, 0},
+{ 4, s_2_21, 0, 1, 0},
+{ 8, s_2_22, 0, 1, 0},
+{ 4, s_2_23, 0, 1, 0},
+{ 6, s_2_24, 0, 1, 0},
+{ 4, s_2_25, 0, 1, 0},
+{ 6, s_2_26, -1, 1, 0},
+{ 8, s_2_27, -2, 1, 0},
+{ 4, s_2_28, 0, 1, 0},
+{ 8, s_2_29, 0, 1, 0},
+{ 14, s_2_30, -1, 1, 0},
+{ 4, s_2_31, 0, 1, 0},
+{ 8, s_2_32, -1, 1, 0},
+{ 6, s_2_33, -2, 1, 0},
+{ 8, s_2_34, -3, 1, 0},
+{ 8, s_2_35, 0, 1, 0},
+{ 6, s_2_36, 0, 1, 0},
+{ 4, s_2_37, 0, 1, 0},
+{ 6, s_2_38, 0, 1, 0},
+{ 8, s_2_39, 0, 1, 0}
+};
+
+static const symbol s_3_0[4] = { 0xD5, 0xA5, 0xD6, 0x80 };
+static const symbol s_3_1[6] = { 0xD5, 0xB6, 0xD5, 0xA5, 0xD6, 0x80 };
+static const symbol s_3_2[2] = { 0xD6, 0x81 };
+static const symbol s_3_3[6] = { 0xD5, 0xB8, 0xD6, 0x82, 0xD6, 0x81 };
+static const symbol s_3_4[4] = { 0xD5, 0xAB, 0xD6, 0x81 };
+static const symbol s_3_5[8] = { 0xD5, 0xA5, 0xD6, 0x80, 0xD5, 0xAB, 0xD6, 0x81 };
+static const symbol s_3_6[10] = { 0xD5, 0xB6, 0xD5, 0xA5, 0xD6, 0x80, 0xD5, 0xAB, 0xD6, 0x81 };
+static const symbol s_3_7[6] = { 0xD6, 0x81, 0xD5, 0xAB, 0xD6, 0x81 };
+static const symbol s_3_8[10] = { 0xD5, 0xBE, 0xD5, 0xA1, 0xD5, 0xB6, 0xD5, 0xAB, 0xD6, 0x81 };
+static const symbol s_3_9[8] = { 0xD5, 0xB8, 0xD5, 0xBB, 0xD5, 0xAB, 0xD6, 0x81 };
+static const symbol s_3_10[6] = { 0xD5, 0xBE, 0xD5, 0xAB, 0xD6, 0x81 };
+static const symbol s_3_11[4] = { 0xD5, 0xB8, 0xD6, 0x81 };
+static const symbol s_3_12[4] = { 0xD5, 0xBD, 0xD5, 0xA1 };
+static const symbol s_3_13[4] = { 0xD5, 0xBE, 0xD5, 0xA1 };
+static const symbol s_3_14[6] = { 0xD5, 0xA1, 0xD5, 0xB4, 0xD5, 0xA2 };
+static const symbol s_3_15[2] = { 0xD5, 0xA4 };
+static const symbol s_3_16[6] = { 0xD5, 0xA5, 0xD6, 0x80, 0xD5, 0xA4 };
+static const symbol s_3_17[8] = { 0xD5, 0xB6, 0xD5, 0xA5, 0xD6, 0x80, 0xD5, 0xA4 };
+static const symbol s_3_18[6] = { 0xD5, 0xB8, 0xD6, 0x82, 0xD5, 0xA4 };
+static const symbol s_3_19[6] = { 0xD5, 0xA1, 0xD5, 0xB6, 0xD5, 0xA4 };
+static const symbol s_3_20[14] = { 0xD5, 0xB8, 0xD6, 0x82, 0xD5, 0xA9, 0xD5, 0xB5, 0xD5, 0xA1, 0xD5, 0xB6, 0xD5, 0xA4 };
+static const symbol s_3_21[8] = { 0xD5, 0xBE, 0xD5, 0xA1, 0xD5, 0xB6, 0xD5, 0xA4 };
+static const symbol s_3_22[6] = { 0xD5, 0xB8, 0xD5, 0xBB, 0xD5, 0xA4 };
+static const symbol s_3_23[2] = { 0xD5, 0xA8 };
+static const symbol s_3_24[6] = { 0xD5, 0xA5, 0xD6, 0x80, 0xD5, 0xA8 };
+static const symbol s_3_25[8] = { 0xD5, 0xB6, 0xD5, 0xA5, 0xD6, 0x80, 0xD5, 0xA8 };
+static const symbol s_3_26[6] = { 0xD5, 0xA1, 0xD5, 0xB6, 0xD5, 0xA8 };
+static const symbol s_3_27[14] = { 0xD5, 0xB8, 0xD6, 0x82, 0xD5, 0xA9, 0xD5, 0xB5, 0xD5, 0xA1, 0xD5, 0xB6, 0xD5, 0xA8 };
+static const symbol s_3_28[8] = { 0xD5, 0xBE, 0xD5, 0xA1, 0xD5, 0xB6, 0xD5, 0xA8 };
+static const symbol s_3_29[6] = { 0xD5, 0xB8, 0xD5, 0xBB, 0xD5, 0xA8 };
+static const symbol s_3_30[2] = { 0xD5, 0xAB };
+static const symbol s_3_31[6] = { 0xD5, 0xA5, 0xD6, 0x80, 0xD5, 0xAB };
+static const symbol s_3_32[8] = { 0xD5, 0xB6, 0xD5, 0xA5, 0xD6, 0x80, 0xD5, 0xAB };
+static const symbol s_3_33[4] = { 0xD5, 0xBE, 0xD5, 0xAB };
+static const symbol s_3_34[10] = { 0xD5, 0xA5, 0xD6, 0x80, 0xD5, 0xB8, 0xD6, 0x82, 0xD5, 0xB4 };
+static const symbol s_3_35[12] = { 0xD5, 0xB6, 0xD5, 0xA5, 0xD6, 0x80, 0xD5, 0xB8, 0xD6, 0x82, 0xD5, 0xB4 };
+static const symbol s_3_36[10] = { 0xD5, 0xA1, 0xD5, 0xB6, 0xD5, 0xB8, 0xD6, 0x82, 0xD5, 0xB4 };
+static const symbol s_3_37[2] = { 0xD5, 0xB6 };
+static const symbol s_3_38[6] = { 0xD5, 0xA5, 0xD6, 0x80, 0xD5, 0xB6 };
+static const symbol s_3_39[8] = { 0xD5, 0xB6, 0xD5, 0xA5, 0xD6, 0x80, 0xD5, 0xB6 };
+static const symbol s_3_40[6] = { 0xD5, 0xB8, 0xD6, 0x82, 0xD5, 0xB6 };
+static const symbol s_3_41[4] = { 0xD5, 0xA1, 0xD5, 0xB6 };
+static const symbol s_3_42[12] = { 0xD5, 0xB8, 0xD6, 0x82, 0xD5, 0xA9, 0xD5, 0xB5, 0xD5, 0xA1, 0xD5, 0xB6 };
+static const symbol s_3_43[6] = { 0xD5, 0xBE, 0xD5, 0xA1, 0xD5, 0xB6 };
+static const symbol s_3_44[4] = { 0xD5, 0xAB, 0xD5, 0xB6 };
+static const symbol s_3_45[8] = { 0xD5, 0xA5, 0xD6, 0x80, 0xD5, 0xAB, 0xD5, 0xB6 };
+static const symbol s_3_46[10] = { 0xD5, 0xB6, 0xD5, 0xA5, 0xD6, 0x80, 0xD5, 0xAB, 0xD5, 0xB6 };
+static const symbol s_3_47[14] = { 0xD5, 0xB8, 0xD6, 0x82, 0xD5, 0xA9, 0xD5, 0xB5, 0xD5, 0xA1, 0xD5, 0xB6, 0xD5, 0xB6 };
+static const symbol s_3_48[4] = { 0xD5, 0xB8, 0xD5, 0xBB };
+static const symbol s_3_49[14] = { 0xD5, 0xB8, 0xD6, 0x82, 0xD5, 0xA9, 0xD5, 0xB5, 0xD5, 0xA1, 0xD5, 0xB6, 0xD5, 0xBD };
+static const symbol s_3_50[8] = { 0xD5, 0xBE, 0xD5, 0xA1, 0xD5, 0xB6, 0xD5, 0xBD };
+static const symbol s_3_51[6] = { 0xD5, 0xB8, 0xD5, 0xBB, 0xD5, 0xBD };
+static const symbol s_3_52[4] = { 0xD5, 0xB8, 0xD5, 0xBE };
+static const symbol s_3_53[8] = { 0xD5, 0xA5, 0xD6, 0x80, 0xD5, 0xB8, 0xD5, 0xBE };
+static const symbol s_3_54[10] = { 0xD5, 0xB6, 0xD5, 0xA5, 0xD6, 0x80, 0xD5, 0xB8, 0xD5, 0xBE };
+static const symbol s_3_55[8] = { 0xD5, 0xA1, 0xD5, 0xB6, 0xD5, 0xB8, 0xD5, 0xBE };
+static const symbol s_3_56[6] = { 0xD5, 0xBE, 0xD5, 0xB8, 0xD5, 0xBE };
+static const struct among a_3[57] = {
+{ 4, s_3_0, 0, 1, 0},
+{ 6, s_3_1, -1, 1, 0},
+{ 2, s_3_2, 0, 1, 0},
+{ 6, s_3_3, -1, 1, 0},
+{ 4, s_3_4, -2, 1, 0},
+{ 8, s_3_5, -1, 1, 0},
+{ 10, s_3_6, -1, 1, 0},
+{ 6, s_3_7, -3, 1, 0},
+{ 10, s_3_8, -4, 1, 0},
+{ 8, s_3_9, -5, 1, 0},
+{ 6, s_3_10, -6, 1, 0},
+{ 4, s_3_11, -9, 1, 0},
+{ 4, s_3_12, 0, 1, 0},
+{ 4, s_3_13, 0, 1, 0},
+{ 6, s_3_14, 0, 1, 0},
+{ 2, s_3_15, 0, 1, 0},
+{ 6, s_3_16, -1, 1, 0},
+{ 8, s_3_17, -1, 1, 0},
+{ 6, s_3_18, -3, 1, 0},
+{ 6, s_3_19, -4, 1, 0},
+{ 14, s_3_20, -1, 1, 0},
+{ 8, s_3_21, -2, 1, 0},
+{ 6, s_3_22, -7, 1, 0},
+{ 2, s_3_23, 0, 1, 0},
+{ 6, s_3_24, -1, 1, 0},
+{ 8, s_3_25, -1, 1, 0},
+{ 6, s_3_26, -3, 1, 0},
+{ 14, s_3_27, -1, 1, 0},
+{ 8, s_3_28, -2, 1, 0},
+{ 6, s_3_29, -6, 1, 0},
+{ 2, s_3_30, 0, 1, 0},
+{ 6, s_3_31, -1, 1, 0},
+{ 8, s_3_32, -1, 1, 0},
+{ 4, s_3_33, -3, 1, 0},
+{ 10, s_3_34, 0, 1, 0},
+{ 12, s_3_35, -1, 1, 0},
+{ 10, s_3_36, 0, 1, 0},
+{ 2, s_3_37, 0, 1, 0},
+{ 6, s_3_38, -1, 1, 0},
+{ 8, s_3_39, -1, 1, 0},
+{ 6, s_3_40, -3, 1, 0},
+{ 4, s_3_41, -4, 1, 0},
+{ 12, s_3_42, -1, 1, 0},
+{ 6, s_3_43, -2, 1, 0},
+{ 4, s_3_44, -7, 1, 0},
+{ 8, s_3_45, -1, 1, 0},
+{ 10, s_3_46, -1, 1, 0},
+{ 14, s_3_47, -10, 1, 0},
+{ 4, s_3_48, 0, 1, 0},
+{ 14, s_3_49, 0, 1, 0},
+{ 8, s_3_50, 0, 1, 0},
+{ 6, s_3_51, 0, 1, 0},
+{ 4, s_3_52, 0, 1, 0},
+{ 8, s_3_53, -1, 1, 0},
+{ 10, s_3_54, -1, 1, 0},
+{ 8, s_3_55, -3, 1, 0},
+{ 6, s_3_56, -4, 1, 0}
+};
+
+static const unsigned char g_v[] = { 209, 4, 128, 0, 18 };
+
+static int r_mark_regions(struct SN_env * z) {
+    ((SN_local *)z)->i_pV = z->l;
+    ((SN_local *)z)->i_p2 = z->l;
+    {
+        int v_1 = z->c;
+        {
+            int ret = out_grouping_U(z, g_v, 1377, 1413, 1);
+            if (ret < 0) goto lab0;
+            z->c += ret;
+        }
+        ((SN_local *)z)->i_pV = z->c;
+        {
+            int ret = in_grouping_U(z, g_v, 1377, 1413, 1);
+            if (ret < 0) goto lab0;
+            z->c += ret;
+        }
+        {
+            int ret = out_grouping_U(z, g_v, 1377, 1413, 1);
+            if (ret < 0) goto lab0;
+            z->c += ret;
+        }
+        {
+            int ret = in_grouping_U(z, g_v, 1377, 1413, 1);
+            if (ret < 0) goto lab0;
+            z->c += ret;
+        }
+        ((SN_local *)z)->i_p2 = z->c;
+    lab0:
+        z->c = v_1;
+    }
+    return 1;
+}
+
+static int r_R2(struct SN_env * z) {
+    return ((SN_local *)z)->i_p2 <= z->c;
+}
+
+static int r_adjective(struct SN_env * z) {
+    z->ket = z->c;
+    if (!find_among_b(z, a_0, 23, 0)) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+static int r_verb(struct SN_env * z) {
+    z->ket = z->c;
+    if (!find_among_b(z, a_1, 71, 0)) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+static int r_noun(struct SN_env * z) {
+    z->ket = z->c;
+    if (!find_among_b(z, a_2, 40, 0)) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+static int r_ending(struct SN_env * z) {
+    z->ket = z->c;
+    if (!find_among_b(z, a_3, 57, 0)) return 0;
+    z->bra = z->c;
+    {
+        int ret = r_R2(z);
+        if (ret <= 0) return ret;
+    }
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+extern int armenian_UTF_8_stem(struct SN_env * z) {
+    {
+        int ret = r_mark_regions(z);
+        if (ret < 0) return ret;
+    }
+    z->lb = z->c; z->c = z->l;
+    {
+        int v_1;
+        if (z->c < ((SN_local *)z)->i_pV) return 0;
+        v_1 = z->lb; z->lb = ((SN_local *)z)->i_pV;
+        {
+            int v_2 = z->l - z->c;
+            {
+                int ret = r_ending(z);
+                if (ret < 0) return ret;
+            }
+            z->c = z->l - v_2;
+        }
+        {
+            int v_3 = z->l - z->c;
+            {
+                int ret = r_verb(z);
+                if (ret < 0) return ret;
+            }
+            z->c = z->l - v_3;
+        }
+        {
+            int v_4 = z->l - z->c;
+            {
+                int ret = r_adjective(z);
+                if (ret < 0) return ret;
+            }
+            z->c = z->l - v_4;
+        }
+        {
+            int v_5 = z->l - z->c;
+            {
+                int ret = r_noun(z);
+                if (ret < 0) return ret;
+            }
+            z->c = z->l - v_5;
+        }
+        z->lb = v_1;
+    }
+    z->c = z->lb;
+    return 1;
+}
+
+static int r_mark_regions_ascii(struct SN_env * z) {
+    ((SN_local *)z)->i_pV = z->l;
+    ((SN_local *)z)->i_p2 = z->l;
+    {
+        int v_1 = z->c;
+        {
+            int ret = out_grouping(z, g_v, 1377, 1413, 1);
+            if (ret < 0) goto lab0;
+            z->c += ret;
+        }
+        ((SN_local *)z)->i_pV = z->c;
+        {
+            int ret = in_grouping(z, g_v, 1377, 1413, 1);
+            if (ret < 0) goto lab0;
+            z->c += ret;
+        }
+        {
+            int ret = out_grouping(z, g_v, 1377, 1413, 1);
+            if (ret < 0) goto lab0;
+            z->c += ret;
+        }
+        {
+            int ret = in_grouping(z, g_v, 1377, 1413, 1);
+            if (ret < 0) goto lab0;
+            z->c += ret;
+        }
+        ((SN_local *)z)->i_p2 = z->c;
+    lab0:
+        z->c = v_1;
+    }
+    return 1;
+}
+
+static int r_R2_ascii(struct SN_env * z) {
+    return ((SN_local *)z)->i_p2 <= z->c;
+}
+
+static int r_adjective_ascii(struct SN_env * z) {
+    z->ket = z->c;
+    if (!find_among_b(z, a_0, 23, 0)) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+static int r_verb_ascii(struct SN_env * z) {
+    z->ket = z->c;
+    if (!find_among_b(z, a_1, 71, 0)) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+static int r_noun_ascii(struct SN_env * z) {
+    z->ket = z->c;
+    if (!find_among_b(z, a_2, 40, 0)) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+static int r_ending_ascii(struct SN_env * z) {
+    z->ket = z->c;
+    if (!find_among_b(z, a_3, 57, 0)) return 0;
+    z->bra = z->c;
+    {
+        int ret = r_R2_ascii(z);
+        if (ret <= 0) return ret;
+    }
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+extern int armenian_UTF_8_stem_ascii(struct SN_env * z) {
+    {
+        int ret = r_mark_regions_ascii(z);
+        if (ret < 0) return ret;
+    }
+    z->lb = z->c; z->c = z->l;
+    {
+        int v_1;
+        if (z->c < ((SN_local *)z)->i_pV) return 0;
+        v_1 = z->lb; z->lb = ((SN_local *)z)->i_pV;
+        {
+            int v_2 = z->l - z->c;
+            {
+                int ret = r_ending_ascii(z);
+                if (ret < 0) return ret;
+            }
+            z->c = z->l - v_2;
+        }
+        {
+            int v_3 = z->l - z->c;
+            {
+                int ret = r_verb_ascii(z);
+                if (ret < 0) return ret;
+            }
+            z->c = z->l - v_3;
+        }
+        {
+            int v_4 = z->l - z->c;
+            {
+                int ret = r_adjective_ascii(z);
+                if (ret < 0) return ret;
+            }
+            z->c = z->l - v_4;
+        }
+        {
+            int v_5 = z->l - z->c;
+            {
+                int ret = r_noun_ascii(z);
+                if (ret < 0) return ret;
+            }
+            z->c = z->l - v_5;
+        }
+        z->lb = v_1;
+    }
+    z->c = z->lb;
+    return 1;
+}
+
+extern struct SN_env * armenian_UTF_8_create_env(void) {
+    return armenian_UTF_8_create_env_with_allocator(NULL);
+}
+
+extern struct SN_env * armenian_UTF_8_create_env_with_allocator(const struct SN_allocator * allocator) {
+    struct SN_env * z = SN_new_env_with_allocator(sizeof(SN_local), allocator);
+    if (z) {
+        ((SN_local *)z)->i_p2 = 0;
+        ((SN_local *)z)->i_pV = 0;
+    }
+    return z;
+}
+
+extern void armenian_UTF_8_close_env(struct SN_env * z) {
+    SN_delete_env(z);
+}
+
@@ -0,0 +1,20 @@
+/* Generated from english.sbl by Snowball 3.0.0 - https://snowballstem.org/ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct SN_allocator;
+
+extern struct SN_env * english_UTF_8_create_env(void);
+extern struct SN_env * english_UTF_8_create_env_with_allocator(const struct SN_allocator * allocator);
+extern void english_UTF_8_close_env(struct SN_env * z);
+
+extern int english_UTF_8_stem(struct SN_env * z);
+
+extern int english_UTF_8_stem_ascii(struct SN_env * z);
+#define english_UTF_8_stem_ascii english_UTF_8_stem_ascii
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,3745 @@
+/* Generated from greek.sbl by Snowball 3.0.0 - https://snowballstem.org/ */
+
+#include "stem_UTF_8_greek.h"
+
+#include <stddef.h>
+
+#include "../runtime/snowball_runtime.h"
+
+struct SN_local {
+    struct SN_env z;
+    unsigned char b_test1;
+};
+
+typedef struct SN_local SN_local;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int greek_UTF_8_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+
+static int r_step_7(struct SN_env * z);
+static int r_step_6(struct SN_env * z);
+static int r_step_5m(struct SN_env * z);
+static int r_step_5l(struct SN_env * z);
+static int r_step_5k(struct SN_env * z);
+static int r_step_5j(struct SN_env * z);
+static int r_step_5i(struct SN_env * z);
+static int r_step_5h(struct SN_env * z);
+static int r_step_5g(struct SN_env * z);
+static int r_step_5f(struct SN_env * z);
+static int r_step_5e(struct SN_env * z);
+static int r_step_5d(struct SN_env * z);
+static int r_step_5c(struct SN_env * z);
+static int r_step_5b(struct SN_env * z);
+static int r_step_5a(struct SN_env * z);
+static int r_step_4(struct SN_env * z);
+static int r_step_3(struct SN_env * z);
+static int r_step_2d(struct SN_env * z);
+static int r_step_2c(struct SN_env * z);
+static int r_step_2b(struct SN_env * z);
+static int r_step_2a(struct SN_env * z);
+static int r_step_1(struct SN_env * z);
+static int r_step_s10(struct SN_env * z);
+static int r_step_s9(struct SN_env * z);
+static int r_step_s8(struct SN_env * z);
+static int r_step_s7(struct SN_env * z);
+static int r_step_s6(struct SN_env * z);
+static int r_step_s5(struct SN_env * z);
+static int r_step_s4(struct SN_env * z);
+static int r_step_s3(struct SN_env * z);
+static int r_step_s2(struct SN_env * z);
+static int r_step_s1(struct SN_env * z);
+static int r_has_min_length(struct SN_env * z);
+static int r_tolower(struct SN_env * z);
+
+static const symbol s_0[] = { 0xCE, 0xB1 };
+static const symbol s_1[] = { 0xCE, 0xB2 };
+static const symbol s_2[] = { 0xCE, 0xB3 };
+static const symbol s_3[] = { 0xCE, 0xB4 };
+static const symbol s_4[] = { 0xCE, 0xB5 };
+static const symbol s_5[] = { 0xCE, 0xB6 };
+static const symbol s_6[] = { 0xCE, 0xB7 };
+static const symbol s_7[] = { 0xCE, 0xB8 };
+static const symbol s_8[] = { 0xCE, 0xB9 };
+static const symbol s_9[] = { 0xCE, 0xBA };
+static const symbol s_10[] = { 0xCE, 0xBB };
+static const symbol s_11[] = { 0xCE, 0xBC };
+static const symbol s_12[] = { 0xCE, 0xBD };
+static const symbol s_13[] = { 0xCE, 0xBE };
+static const symbol s_14[] = { 0xCE, 0xBF };
+static const symbol s_15[] = { 0xCF, 0x80 };
+static const symbol s_16[] = { 0xCF, 0x81 };
+static const symbol s_17[] = { 0xCF, 0x83 };
+static const symbol s_18[] = { 0xCF, 0x84 };
+static const symbol s_19[] = { 0xCF, 0x85 };
+static const symbol s_20[] = { 0xCF, 0x86 };
+static const symbol s_21[] = { 0xCF, 0x87 };
+static const symbol s_22[] = { 0xCF, 0x88 };
+static const symbol s_23[] = { 0xCF, 0x89 };
+static const symbol s_24[] = { 0xCF, 0x86, 0xCE, 0xB1 };
+static const symbol s_25[] = { 0xCF, 0x83, 0xCE, 0xBA, 0xCE, 0xB1 };
+static const symbol s_26[] = { 0xCE, 0xBF, 0xCE, 0xBB, 0xCE, 0xBF };
+static const symbol s_27[] = { 0xCF, 0x83, 0xCE, 0xBF };
+static const symbol s_28[] = { 0xCF, 0x84, 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xBF };
+static const symbol s_29[] = { 0xCE, 0xBA, 0xCF, 0x81, 0xCE, 0xB5 };
+static const symbol s_30[] = { 0xCF, 0x80, 0xCE, 0xB5, 0xCF, 0x81 };
+static const symbol s_31[] = { 0xCF, 0x84, 0xCE, 0xB5, 0xCF, 0x81 };
+static const symbol s_32[] = { 0xCF, 0x86, 0xCF, 0x89 };
+static const symbol s_33[] = { 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xB8, 0xCE, 0xB5, 0xCF, 0x83, 0xCF, 0x84 };
+static const symbol s_34[] = { 0xCE, 0xB3, 0xCE, 0xB5, 0xCE, 0xB3, 0xCE, 0xBF, 0xCE, 0xBD };
+static const symbol s_35[] = { 0xCE, 0xB9 };
+static const symbol s_36[] = { 0xCE, 0xB9, 0xCE, 0xB6 };
+static const symbol s_37[] = { 0xCF, 0x89, 0xCE, 0xBD };
+static const symbol s_38[] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCE, 0xB1 };
+static const symbol s_39[] = { 0xCE, 0xB9, 0xCF, 0x83 };
+static const symbol s_40[] = { 0xCE, 0xB9 };
+static const symbol s_41[] = { 0xCE, 0xB9, 0xCF, 0x83 };
+static const symbol s_42[] = { 0xCE, 0xB9 };
+static const symbol s_43[] = { 0xCE, 0xB9 };
+static const symbol s_44[] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCF, 0x84 };
+static const symbol s_45[] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCE, 0xBC };
+static const symbol s_46[] = { 0xCE, 0xB9 };
+static const symbol s_47[] = { 0xCE, 0xB1, 0xCE, 0xB3, 0xCE, 0xBD, 0xCF, 0x89, 0xCF, 0x83, 0xCF, 0x84 };
+static const symbol s_48[] = { 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xBF, 0xCE, 0xBC };
+static const symbol s_49[] = { 0xCE, 0xB3, 0xCE, 0xBD, 0xCF, 0x89, 0xCF, 0x83, 0xCF, 0x84 };
+static const symbol s_50[] = { 0xCE, 0xB5, 0xCE, 0xB8, 0xCE, 0xBD };
+static const symbol s_51[] = { 0xCE, 0xB5, 0xCE, 0xBA, 0xCE, 0xBB, 0xCE, 0xB5, 0xCE, 0xBA, 0xCF, 0x84 };
+static const symbol s_52[] = { 0xCF, 0x83, 0xCE, 0xBA, 0xCE, 0xB5, 0xCF, 0x80, 0xCF, 0x84 };
+static const symbol s_53[] = { 0xCF, 0x84, 0xCE, 0xBF, 0xCF, 0x80 };
+static const symbol s_54[] = { 0xCE, 0xB1, 0xCE, 0xBB, 0xCE, 0xB5, 0xCE, 0xBE, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB4, 0xCF, 0x81 };
+static const symbol s_55[] = { 0xCE, 0xB2, 0xCF, 0x85, 0xCE, 0xB6, 0xCE, 0xB1, 0xCE, 0xBD, 0xCF, 0x84 };
+static const symbol s_56[] = { 0xCE, 0xB8, 0xCE, 0xB5, 0xCE, 0xB1, 0xCF, 0x84, 0xCF, 0x81 };
+static const symbol s_57[] = { 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xB1, 0xCE, 0xBA };
+static const symbol s_58[] = { 0xCE, 0xB1, 0xCE, 0xBA };
+static const symbol s_59[] = { 0xCE, 0xB9, 0xCF, 0x84, 0xCF, 0x83 };
+static const symbol s_60[] = { 0xCE, 0xBA, 0xCE, 0xBF, 0xCF, 0x81 };
+static const symbol s_61[] = { 0xCE, 0xB9, 0xCF, 0x84, 0xCF, 0x83 };
+static const symbol s_62[] = { 0xCE, 0xB9, 0xCE, 0xB4 };
+static const symbol s_63[] = { 0xCE, 0xB9, 0xCE, 0xB4 };
+static const symbol s_64[] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCE, 0xBA };
+static const symbol s_65[] = { 0xCE, 0xB1, 0xCE, 0xB4 };
+static const symbol s_66[] = { 0xCE, 0xB5, 0xCE, 0xB4 };
+static const symbol s_67[] = { 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xB4 };
+static const symbol s_68[] = { 0xCE, 0xB5 };
+static const symbol s_69[] = { 0xCE, 0xB9 };
+static const symbol s_70[] = { 0xCE, 0xB9, 0xCE, 0xBA };
+static const symbol s_71[] = { 0xCE, 0xB9, 0xCE, 0xBA };
+static const symbol s_72[] = { 0xCE, 0xB1, 0xCE, 0xB3, 0xCE, 0xB1, 0xCE, 0xBC, 0xCE, 0xB5 };
+static const symbol s_73[] = { 0xCE, 0xB1, 0xCE, 0xB3, 0xCE, 0xB1, 0xCE, 0xBC };
+static const symbol s_74[] = { 0xCE, 0xB1, 0xCE, 0xBC, 0xCE, 0xB5 };
+static const symbol s_75[] = { 0xCE, 0xB1, 0xCE, 0xBC };
+static const symbol s_76[] = { 0xCE, 0xB1, 0xCE, 0xB3, 0xCE, 0xB1, 0xCE, 0xBD };
+static const symbol s_77[] = { 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB5 };
+static const symbol s_78[] = { 0xCE, 0xB1, 0xCE, 0xBD };
+static const symbol s_79[] = { 0xCE, 0xB1, 0xCE, 0xBD };
+static const symbol s_80[] = { 0xCE, 0xB7, 0xCF, 0x83, 0xCE, 0xB5, 0xCF, 0x84, 0xCE, 0xB5 };
+static const symbol s_81[] = { 0xCE, 0xB5, 0xCF, 0x84, 0xCE, 0xB5 };
+static const symbol s_82[] = { 0xCE, 0xB5, 0xCF, 0x84 };
+static const symbol s_83[] = { 0xCE, 0xB5, 0xCF, 0x84 };
+static const symbol s_84[] = { 0xCE, 0xB5, 0xCF, 0x84 };
+static const symbol s_85[] = { 0xCE, 0xB1, 0xCF, 0x81, 0xCF, 0x87 };
+static const symbol s_86[] = { 0xCE, 0xBF, 0xCE, 0xBD, 0xCF, 0x84 };
+static const symbol s_87[] = { 0xCE, 0xBA, 0xCF, 0x81, 0xCE, 0xB5 };
+static const symbol s_88[] = { 0xCF, 0x89, 0xCE, 0xBD, 0xCF, 0x84 };
+static const symbol s_89[] = { 0xCE, 0xBF, 0xCE, 0xBD };
+static const symbol s_90[] = { 0xCE, 0xBF, 0xCE, 0xBC, 0xCE, 0xB1, 0xCF, 0x83, 0xCF, 0x84 };
+static const symbol s_91[] = { 0xCE, 0xB9, 0xCE, 0xB5, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB5 };
+static const symbol s_92[] = { 0xCE, 0xB9, 0xCE, 0xB5, 0xCF, 0x83, 0xCF, 0x84 };
+static const symbol s_93[] = { 0xCE, 0xB5, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB5 };
+static const symbol s_94[] = { 0xCE, 0xB9, 0xCE, 0xB5, 0xCF, 0x83, 0xCF, 0x84 };
+static const symbol s_95[] = { 0xCE, 0xB7, 0xCE, 0xBA };
+static const symbol s_96[] = { 0xCE, 0xB7, 0xCE, 0xBA };
+static const symbol s_97[] = { 0xCE, 0xBF, 0xCF, 0x85, 0xCF, 0x83 };
+static const symbol s_98[] = { 0xCE, 0xBF, 0xCF, 0x85, 0xCF, 0x83 };
+static const symbol s_99[] = { 0xCE, 0xBA, 0xCE, 0xBF, 0xCE, 0xBB, 0xCE, 0xBB };
+static const symbol s_100[] = { 0xCE, 0xB1, 0xCE, 0xB3 };
+static const symbol s_101[] = { 0xCE, 0xB1, 0xCE, 0xB3 };
+static const symbol s_102[] = { 0xCE, 0xB1, 0xCE, 0xB3 };
+static const symbol s_103[] = { 0xCE, 0xB7, 0xCF, 0x83 };
+static const symbol s_104[] = { 0xCE, 0xB7, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB5 };
+static const symbol s_105[] = { 0xCE, 0xB7, 0xCF, 0x83, 0xCF, 0x84 };
+static const symbol s_106[] = { 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBD };
+static const symbol s_107[] = { 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBC };
+static const symbol s_108[] = { 0xCE, 0xBC, 0xCE, 0xB1 };
+
+static const symbol s_0_1[2] = { 0xCF, 0x82 };
+static const symbol s_0_2[2] = { 0xCE, 0x86 };
+static const symbol s_0_3[2] = { 0xCE, 0x88 };
+static const symbol s_0_4[2] = { 0xCE, 0x89 };
+static const symbol s_0_5[2] = { 0xCE, 0x8A };
+static const symbol s_0_6[2] = { 0xCF, 0x8A };
+static const symbol s_0_7[2] = { 0xCF, 0x8B };
+static const symbol s_0_8[2] = { 0xCE, 0x8C };
+static const symbol s_0_9[2] = { 0xCF, 0x8C };
+static const symbol s_0_10[2] = { 0xCF, 0x8D };
+static const symbol s_0_11[2] = { 0xCE, 0x8E };
+static const symbol s_0_12[2] = { 0xCF, 0x8E };
+static const symbol s_0_13[2] = { 0xCE, 0x8F };
+static const symbol s_0_14[2] = { 0xCE, 0x90 };
+static const symbol s_0_15[2] = { 0xCE, 0x91 };
+static const symbol s_0_16[2] = { 0xCE, 0x92 };
+static const symbol s_0_17[2] = { 0xCE, 0x93 };
+static const symbol s_0_18[2] = { 0xCE, 0x94 };
+static const symbol s_0_19[2] = { 0xCE, 0x95 };
+static const symbol s_0_20[2] = { 0xCE, 0x96 };
+static const symbol s_0_21[2] = { 0xCE, 0x97 };
+static const symbol s_0_22[2] = { 0xCE, 0x98 };
+static const symbol s_0_23[2] = { 0xCE, 0x99 };
+static const symbol s_0_24[2] = { 0xCE, 0x9A };
+static const symbol s_0_25[2] = { 0xCE, 0x9B };
+static const symbol s_0_26[2] = { 0xCE, 0x9C };
+static const symbol s_0_27[2] = { 0xCE, 0x9D };
+static const symbol s_0_28[2] = { 0xCE, 0x9E };
+static const symbol s_0_29[2] = { 0xCE, 0x9F };
+static const symbol s_0_30[2] = { 0xCE, 0xA0 };
+static const symbol s_0_31[2] = { 0xCE, 0xA1 };
+static const symbol s_0_32[2] = { 0xCE, 0xA3 };
+static const symbol s_0_33[2] = { 0xCE, 0xA4 };
+static const symbol s_0_34[2] = { 0xCE, 0xA5 };
+static const symbol s_0_35[2] = { 0xCE, 0xA6 };
+static const symbol s_0_36[2] = { 0xCE, 0xA7 };
+static const symbol s_0_37[2] = { 0xCE, 0xA8 };
+static const symbol s_0_38[2] = { 0xCE, 0xA9 };
+static const symbol s_0_39[2] = { 0xCE, 0xAA };
+static const symbol s_0_40[2] = { 0xCE, 0xAB };
+static const symbol s_0_41[2] = { 0xCE, 0xAC };
+static const symbol s_0_42[2] = { 0xCE, 0xAD };
+static const symbol s_0_43[2] = { 0xCE, 0xAE };
+static const symbol s_0_44[2] = { 0xCE, 0xAF };
+static const symbol s_0_45[2] = { 0xCE, 0xB0 };
+static const struct among a_0[46] = {
+{ 0, 0, 0, 25, 0},
+{ 2, s_0_1, -1, 18, 0},
+{ 2, s_0_2, -2, 1, 0},
+{ 2, s_0_3, -3, 5, 0},
+{ 2, s_0_4, -4, 7, 0},
+{ 2, s_0_5, -5, 9, 0},
+{ 2, s_0_6, -6, 7, 0},
+{ 2, s_0_7, -7, 20, 0},
+{ 2, s_0_8, -8, 15, 0},
+{ 2, s_0_9, -9, 15, 0},
+{ 2, s_0_10, -10, 20, 0},
+{ 2, s_0_11, -11, 20, 0},
+{ 2, s_0_12, -12, 24, 0},
+{ 2, s_0_13, -13, 24, 0},
+{ 2, s_0_14, -14, 7, 0},
+{ 2, s_0_15, -15, 1, 0},
+{ 2, s_0_16, -16, 2, 0},
+{ 2, s_0_17, -17, 3, 0},
+{ 2, s_0_18, -18, 4, 0},
+{ 2, s_0_19, -19, 5, 0},
+{ 2, s_0_20, -20, 6, 0},
+{ 2, s_0_21, -21, 7, 0},
+{ 2, s_0_22, -22, 8, 0},
+{ 2, s_0_23, -23, 9, 0},
+{ 2, s_0_24, -24, 10, 0},
+{ 2, s_0_25, -25, 11, 0},
+{ 2, s_0_26, -26, 12, 0},
+{ 2, s_0_27, -27, 13, 0},
+{ 2, s_0_28, -28, 14, 0},
+{ 2, s_0_29, -29, 15, 0},
+{ 2, s_0_30, -30, 16, 0},
+{ 2, s_0_31, -31, 17, 0},
+{ 2, s_0_32, -32, 18, 0},
+{ 2, s_0_33, -33, 19, 0},
+{ 2, s_0_34, -34, 20, 0},
+{ 2, s_0_35, -35, 21, 0},
+{ 2, s_0_36, -36, 22, 0},
+{ 2, s_0_37, -37, 23, 0},
+{ 2, s_0_38, -38, 24, 0},
+{ 2, s_0_39, -39, 9, 0},
+{ 2, s_0_40, -40, 20, 0},
+{ 2, s_0_41, -41, 1, 0},
+{ 2, s_0_42, -42, 5, 0},
+{ 2, s_0_43, -43, 7, 0},
+{ 2, s_0_44, -44, 9, 0},
+{ 2, s_0_45, -45, 20, 0}
+};
+
+static const symbol s_1_0[16] = { 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xB8, 0xCE, 0xB5, 0xCF, 0x83, 0xCF, 0x84, 0xCF, 0x89, 0xCF, 0x83 };
+static const symbol s_1_1[6] = { 0xCF, 0x86, 0xCF, 0x89, 0xCF, 0x83 };
+static const symbol s_1_2[10] = { 0xCF, 0x80, 0xCE, 0xB5, 0xCF, 0x81, 0xCE, 0xB1, 0xCF, 0x83 };
+static const symbol s_1_3[10] = { 0xCF, 0x84, 0xCE, 0xB5, 0xCF, 0x81, 0xCE, 0xB1, 0xCF, 0x83 };
+static const symbol s_1_4[10] = { 0xCE, 0xBA, 0xCF, 0x81, 0xCE, 0xB5, 0xCE, 0xB1, 0xCF, 0x83 };
+static const symbol s_1_5[20] = { 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xB8, 0xCE, 0xB5, 0xCF, 0x83, 0xCF, 0x84, 0xCF, 0x89, 0xCF, 0x84, 0xCE, 0xBF, 0xCF, 0x83 };
+static const symbol s_1_6[10] = { 0xCF, 0x86, 0xCF, 0x89, 0xCF, 0x84, 0xCE, 0xBF, 0xCF, 0x83 };
+static const symbol s_1_7[14] = { 0xCF, 0x80, 0xCE, 0xB5, 0xCF, 0x81, 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xBF, 0xCF, 0x83 };
+static const symbol s_1_8[14] = { 0xCF, 0x84, 0xCE, 0xB5, 0xCF, 0x81, 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xBF, 0xCF, 0x83 };
+static const symbol s_1_9[14] = { 0xCE, 0xBA, 0xCF, 0x81, 0xCE, 0xB5, 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xBF, 0xCF, 0x83 };
+static const symbol s_1_10[18] = { 0xCE, 0xB3, 0xCE, 0xB5, 0xCE, 0xB3, 0xCE, 0xBF, 0xCE, 0xBD, 0xCE, 0xBF, 0xCF, 0x84, 0xCE, 0xBF, 0xCF, 0x83 };
+static const symbol s_1_11[14] = { 0xCE, 0xB3, 0xCE, 0xB5, 0xCE, 0xB3, 0xCE, 0xBF, 0xCE, 0xBD, 0xCE, 0xBF, 0xCF, 0x83 };
+static const symbol s_1_12[12] = { 0xCF, 0x86, 0xCE, 0xB1, 0xCE, 0xB3, 0xCE, 0xB9, 0xCE, 0xBF, 0xCF, 0x85 };
+static const symbol s_1_13[14] = { 0xCF, 0x83, 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xB3, 0xCE, 0xB9, 0xCE, 0xBF, 0xCF, 0x85 };
+static const symbol s_1_14[12] = { 0xCF, 0x83, 0xCE, 0xBF, 0xCE, 0xB3, 0xCE, 0xB9, 0xCE, 0xBF, 0xCF, 0x85 };
+static const symbol s_1_15[16] = { 0xCF, 0x84, 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xBF, 0xCE, 0xB3, 0xCE, 0xB9, 0xCE, 0xBF, 0xCF, 0x85 };
+static const symbol s_1_16[14] = { 0xCE, 0xBF, 0xCE, 0xBB, 0xCE, 0xBF, 0xCE, 0xB3, 0xCE, 0xB9, 0xCE, 0xBF, 0xCF, 0x85 };
+static const symbol s_1_17[18] = { 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xB8, 0xCE, 0xB5, 0xCF, 0x83, 0xCF, 0x84, 0xCF, 0x89, 0xCF, 0x84, 0xCE, 0xB1 };
+static const symbol s_1_18[8] = { 0xCF, 0x86, 0xCF, 0x89, 0xCF, 0x84, 0xCE, 0xB1 };
+static const symbol s_1_19[12] = { 0xCF, 0x80, 0xCE, 0xB5, 0xCF, 0x81, 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xB1 };
+static const symbol s_1_20[12] = { 0xCF, 0x84, 0xCE, 0xB5, 0xCF, 0x81, 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xB1 };
+static const symbol s_1_21[12] = { 0xCE, 0xBA, 0xCF, 0x81, 0xCE, 0xB5, 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xB1 };
+static const symbol s_1_22[16] = { 0xCE, 0xB3, 0xCE, 0xB5, 0xCE, 0xB3, 0xCE, 0xBF, 0xCE, 0xBD, 0xCE, 0xBF, 0xCF, 0x84, 0xCE, 0xB1 };
+static const symbol s_1_23[10] = { 0xCF, 0x86, 0xCE, 0xB1, 0xCE, 0xB3, 0xCE, 0xB9, 0xCE, 0xB1 };
+static const symbol s_1_24[12] = { 0xCF, 0x83, 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xB3, 0xCE, 0xB9, 0xCE, 0xB1 };
+static const symbol s_1_25[10] = { 0xCF, 0x83, 0xCE, 0xBF, 0xCE, 0xB3, 0xCE, 0xB9, 0xCE, 0xB1 };
+static const symbol s_1_26[14] = { 0xCF, 0x84, 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xBF, 0xCE, 0xB3, 0xCE, 0xB9, 0xCE, 0xB1 };
+static const symbol s_1_27[12] = { 0xCE, 0xBF, 0xCE, 0xBB, 0xCE, 0xBF, 0xCE, 0xB3, 0xCE, 0xB9, 0xCE, 0xB1 };
+static const symbol s_1_28[12] = { 0xCF, 0x80, 0xCE, 0xB5, 0xCF, 0x81, 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xB7 };
+static const symbol s_1_29[20] = { 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xB8, 0xCE, 0xB5, 0xCF, 0x83, 0xCF, 0x84, 0xCF, 0x89, 0xCF, 0x84, 0xCF, 0x89, 0xCE, 0xBD };
+static const symbol s_1_30[10] = { 0xCF, 0x86, 0xCF, 0x89, 0xCF, 0x84, 0xCF, 0x89, 0xCE, 0xBD };
+static const symbol s_1_31[14] = { 0xCF, 0x80, 0xCE, 0xB5, 0xCF, 0x81, 0xCE, 0xB1, 0xCF, 0x84, 0xCF, 0x89, 0xCE, 0xBD };
+static const symbol s_1_32[14] = { 0xCF, 0x84, 0xCE, 0xB5, 0xCF, 0x81, 0xCE, 0xB1, 0xCF, 0x84, 0xCF, 0x89, 0xCE, 0xBD };
+static const symbol s_1_33[14] = { 0xCE, 0xBA, 0xCF, 0x81, 0xCE, 0xB5, 0xCE, 0xB1, 0xCF, 0x84, 0xCF, 0x89, 0xCE, 0xBD };
+static const symbol s_1_34[18] = { 0xCE, 0xB3, 0xCE, 0xB5, 0xCE, 0xB3, 0xCE, 0xBF, 0xCE, 0xBD, 0xCE, 0xBF, 0xCF, 0x84, 0xCF, 0x89, 0xCE, 0xBD };
+static const symbol s_1_35[12] = { 0xCF, 0x86, 0xCE, 0xB1, 0xCE, 0xB3, 0xCE, 0xB9, 0xCF, 0x89, 0xCE, 0xBD };
+static const symbol s_1_36[14] = { 0xCF, 0x83, 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xB3, 0xCE, 0xB9, 0xCF, 0x89, 0xCE, 0xBD };
+static const symbol s_1_37[12] = { 0xCF, 0x83, 0xCE, 0xBF, 0xCE, 0xB3, 0xCE, 0xB9, 0xCF, 0x89, 0xCE, 0xBD };
+static const symbol s_1_38[16] = { 0xCF, 0x84, 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xBF, 0xCE, 0xB3, 0xCE, 0xB9, 0xCF, 0x89, 0xCE, 0xBD };
+static const symbol s_1_39[14] = { 0xCE, 0xBF, 0xCE, 0xBB, 0xCE, 0xBF, 0xCE, 0xB3, 0xCE, 0xB9, 0xCF, 0x89, 0xCE, 0xBD };
+static const struct among a_1[40] = {
+{ 16, s_1_0, 0, 10, 0},
+{ 6, s_1_1, 0, 9, 0},
+{ 10, s_1_2, 0, 7, 0},
+{ 10, s_1_3, 0, 8, 0},
+{ 10, s_1_4, 0, 6, 0},
+{ 20, s_1_5, 0, 10, 0},
+{ 10, s_1_6, 0, 9, 0},
+{ 14, s_1_7, 0, 7, 0},
+{ 14, s_1_8, 0, 8, 0},
+{ 14, s_1_9, 0, 6, 0},
+{ 18, s_1_10, 0, 11, 0},
+{ 14, s_1_11, 0, 11, 0},
+{ 12, s_1_12, 0, 1, 0},
+{ 14, s_1_13, 0, 2, 0},
+{ 12, s_1_14, 0, 4, 0},
+{ 16, s_1_15, 0, 5, 0},
+{ 14, s_1_16, 0, 3, 0},
+{ 18, s_1_17, 0, 10, 0},
+{ 8, s_1_18, 0, 9, 0},
+{ 12, s_1_19, 0, 7, 0},
+{ 12, s_1_20, 0, 8, 0},
+{ 12, s_1_21, 0, 6, 0},
+{ 16, s_1_22, 0, 11, 0},
+{ 10, s_1_23, 0, 1, 0},
+{ 12, s_1_24, 0, 2, 0},
+{ 10, s_1_25, 0, 4, 0},
+{ 14, s_1_26, 0, 5, 0},
+{ 12, s_1_27, 0, 3, 0},
+{ 12, s_1_28, 0, 7, 0},
+{ 20, s_1_29, 0, 10, 0},
+{ 10, s_1_30, 0, 9, 0},
+{ 14, s_1_31, 0, 7, 0},
+{ 14, s_1_32, 0, 8, 0},
+{ 14, s_1_33, 0, 6, 0},
+{ 18, s_1_34, 0, 11, 0},
+{ 12, s_1_35, 0, 1, 0},
+{ 14, s_1_36, 0, 2, 0},
+{ 12, s_1_37, 0, 4, 0},
+{ 16, s_1_38, 0, 5, 0},
+{ 14, s_1_39, 0, 3, 0}
+};
+
+static const symbol s_2_0[2] = { 0xCF, 0x80 };
+static const symbol s_2_1[6] = { 0xCE, 0xB9, 0xCE, 0xBC, 0xCF, 0x80 };
+static const symbol s_2_2[2] = { 0xCF, 0x81 };
+static const symbol s_2_3[4] = { 0xCF, 0x80, 0xCF, 0x81 };
+static const symbol s_2_4[6] = { 0xCE, 0xBC, 0xCF, 0x80, 0xCF, 0x81 };
+static const symbol s_2_5[6] = { 0xCE, 0xB1, 0xCF, 0x81, 0xCF, 0x81 };
+static const symbol s_2_6[12] = { 0xCE, 0xB3, 0xCE, 0xBB, 0xCF, 0x85, 0xCE, 0xBA, 0xCF, 0x85, 0xCF, 0x81 };
+static const symbol s_2_7[10] = { 0xCF, 0x80, 0xCE, 0xBF, 0xCE, 0xBB, 0xCF, 0x85, 0xCF, 0x81 };
+static const symbol s_2_8[10] = { 0xCE, 0xB1, 0xCE, 0xBC, 0xCF, 0x80, 0xCE, 0xB1, 0xCF, 0x81 };
+static const symbol s_2_9[6] = { 0xCE, 0xBC, 0xCE, 0xB1, 0xCF, 0x81 };
+static const symbol s_2_10[6] = { 0xCE, 0xB3, 0xCE, 0xBA, 0xCF, 0x81 };
+static const symbol s_2_11[14] = { 0xCF, 0x80, 0xCE, 0xB9, 0xCF, 0x80, 0xCE, 0xB5, 0xCF, 0x81, 0xCE, 0xBF, 0xCF, 0x81 };
+static const symbol s_2_12[12] = { 0xCE, 0xB2, 0xCE, 0xBF, 0xCE, 0xBB, 0xCE, 0xB2, 0xCE, 0xBF, 0xCF, 0x81 };
+static const symbol s_2_13[12] = { 0xCE, 0xB3, 0xCE, 0xBB, 0xCF, 0x85, 0xCE, 0xBA, 0xCE, 0xBF, 0xCF, 0x81 };
+static const symbol s_2_14[6] = { 0xCE, 0xBB, 0xCE, 0xBF, 0xCF, 0x85 };
+static const symbol s_2_15[4] = { 0xCF, 0x80, 0xCE, 0xB1 };
+static const symbol s_2_16[12] = { 0xCE, 0xBE, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xB1 };
+static const symbol s_2_17[6] = { 0xCE, 0xB5, 0xCF, 0x80, 0xCE, 0xB1 };
+static const symbol s_2_18[12] = { 0xCF, 0x80, 0xCE, 0xB5, 0xCF, 0x81, 0xCE, 0xB9, 0xCF, 0x80, 0xCE, 0xB1 };
+static const symbol s_2_19[12] = { 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB1, 0xCE, 0xBC, 0xCF, 0x80, 0xCE, 0xB1 };
+static const symbol s_2_20[8] = { 0xCE, 0xB5, 0xCE, 0xBC, 0xCF, 0x80, 0xCE, 0xB1 };
+static const symbol s_2_21[2] = { 0xCE, 0xB2 };
+static const symbol s_2_22[8] = { 0xCE, 0xB4, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB5 };
+static const symbol s_2_23[12] = { 0xCE, 0xB2, 0xCE, 0xB1, 0xCE, 0xB8, 0xCF, 0x85, 0xCF, 0x81, 0xCE, 0xB9 };
+static const symbol s_2_24[8] = { 0xCE, 0xB2, 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xBA };
+static const symbol s_2_25[8] = { 0xCE, 0xBC, 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xBA };
+static const symbol s_2_26[2] = { 0xCE, 0xBB };
+static const symbol s_2_27[2] = { 0xCE, 0xBC };
+static const symbol s_2_28[8] = { 0xCE, 0xBA, 0xCE, 0xBF, 0xCF, 0x81, 0xCE, 0xBD };
+static const symbol s_2_29[8] = { 0xCE, 0xB1, 0xCE, 0xB8, 0xCF, 0x81, 0xCE, 0xBF };
+static const symbol s_2_30[14] = { 0xCF, 0x83, 0xCF, 0x85, 0xCE, 0xBD, 0xCE, 0xB1, 0xCE, 0xB8, 0xCF, 0x81, 0xCE, 0xBF };
+static const struct among a_2[31] = {
+{ 2, s_2_0, 0, 2, 0},
+{ 6, s_2_1, -1, 2, 0},
+{ 2, s_2_2, 0, 2, 0},
+{ 4, s_2_3, -1, 2, 0},
+{ 6, s_2_4, -1, 2, 0},
+{ 6, s_2_5, -3, 2, 0},
+{ 12, s_2_6, -4, 2, 0},
+{ 10, s_2_7, -5, 2, 0},
+{ 10, s_2_8, -6, 2, 0},
+{ 6, s_2_9, -7, 2, 0},
+{ 6, s_2_10, -8, 2, 0},
+{ 14, s_2_11, -9, 2, 0},
+{ 12, s_2_12, -10, 2, 0},
+{ 12, s_2_13, -11, 2, 0},
+{ 6, s_2_14, 0, 2, 0},
+{ 4, s_2_15, 0, 1, 0},
+{ 12, s_2_16, -1, 1, 0},
+{ 6, s_2_17, -2, 1, 0},
+{ 12, s_2_18, -3, 1, 0},
+{ 12, s_2_19, -4, 1, 0},
+{ 8, s_2_20, -5, 1, 0},
+{ 2, s_2_21, 0, 2, 0},
+{ 8, s_2_22, 0, 1, 0},
+{ 12, s_2_23, 0, 2, 0},
+{ 8, s_2_24, 0, 2, 0},
+{ 8, s_2_25, 0, 2, 0},
+{ 2, s_2_26, 0, 2, 0},
+{ 2, s_2_27, 0, 2, 0},
+{ 8, s_2_28, 0, 2, 0},
+{ 8, s_2_29, 0, 1, 0},
+{ 14, s_2_30, -1, 1, 0}
+};
+
+static const symbol s_3_0[8] = { 0xCE, 0xB9, 0xCE, 0xB6, 0xCE, 0xB5, 0xCF, 0x83 };
+static const symbol s_3_1[10] = { 0xCE, 0xB9, 0xCE, 0xB6, 0xCE, 0xB5, 0xCE, 0xB9, 0xCF, 0x83 };
+static const symbol s_3_2[6] = { 0xCE, 0xB9, 0xCE, 0xB6, 0xCF, 0x89 };
+static const symbol s_3_3[6] = { 0xCE, 0xB9, 0xCE, 0xB6, 0xCE, 0xB1 };
+static const symbol s_3_4[10] = { 0xCE, 0xB9, 0xCE, 0xB6, 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xB5 };
+static const symbol s_3_5[10] = { 0xCE, 0xB9, 0xCE, 0xB6, 0xCE, 0xB5, 0xCF, 0x84, 0xCE, 0xB5 };
+static const symbol s_3_6[6] = { 0xCE, 0xB9, 0xCE, 0xB6, 0xCE, 0xB5 };
+static const symbol s_3_7[12] = { 0xCE, 0xB9, 0xCE, 0xB6, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBC, 0xCE, 0xB5 };
+static const symbol s_3_8[10] = { 0xCE, 0xB9, 0xCE, 0xB6, 0xCE, 0xB1, 0xCE, 0xBC, 0xCE, 0xB5 };
+static const symbol s_3_9[12] = { 0xCE, 0xB9, 0xCE, 0xB6, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBD, 0xCE, 0xB5 };
+static const symbol s_3_10[10] = { 0xCE, 0xB9, 0xCE, 0xB6, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB5 };
+static const symbol s_3_11[8] = { 0xCE, 0xB9, 0xCE, 0xB6, 0xCE, 0xB5, 0xCE, 0xB9 };
+static const symbol s_3_12[10] = { 0xCE, 0xB9, 0xCE, 0xB6, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBD };
+static const symbol s_3_13[8] = { 0xCE, 0xB9, 0xCE, 0xB6, 0xCE, 0xB1, 0xCE, 0xBD };
+static const struct among a_3[14] = {
+{ 8, s_3_0, 0, 1, 0},
+{ 10, s_3_1, 0, 1, 0},
+{ 6, s_3_2, 0, 1, 0},
+{ 6, s_3_3, 0, 1, 0},
+{ 10, s_3_4, 0, 1, 0},
+{ 10, s_3_5, 0, 1, 0},
+{ 6, s_3_6, 0, 1, 0},
+{ 12, s_3_7, 0, 1, 0},
+{ 10, s_3_8, 0, 1, 0},
+{ 12, s_3_9, 0, 1, 0},
+{ 10, s_3_10, 0, 1, 0},
+{ 8, s_3_11, 0, 1, 0},
+{ 10, s_3_12, 0, 1, 0},
+{ 8, s_3_13, 0, 1, 0}
+};
+
+static const symbol s_4_0[2] = { 0xCF, 0x83 };
+static const symbol s_4_1[2] = { 0xCF, 0x87 };
+static const symbol s_4_2[4] = { 0xCF, 0x85, 0xCF, 0x88 };
+static const symbol s_4_3[4] = { 0xCE, 0xB6, 0xCF, 0x89 };
+static const symbol s_4_4[4] = { 0xCE, 0xB2, 0xCE, 0xB9 };
+static const symbol s_4_5[4] = { 0xCE, 0xBB, 0xCE, 0xB9 };
+static const symbol s_4_6[4] = { 0xCE, 0xB1, 0xCE, 0xBB };
+static const symbol s_4_7[4] = { 0xCE, 0xB5, 0xCE, 0xBD };
+static const struct among a_4[8] = {
+{ 2, s_4_0, 0, 1, 0},
+{ 2, s_4_1, 0, 1, 0},
+{ 4, s_4_2, 0, 1, 0},
+{ 4, s_4_3, 0, 1, 0},
+{ 4, s_4_4, 0, 1, 0},
+{ 4, s_4_5, 0, 1, 0},
+{ 4, s_4_6, 0, 1, 0},
+{ 4, s_4_7, 0, 1, 0}
+};
+
+static const symbol s_5_0[12] = { 0xCF, 0x89, 0xCE, 0xB8, 0xCE, 0xB7, 0xCE, 0xBA, 0xCE, 0xB5, 0xCF, 0x83 };
+static const symbol s_5_1[10] = { 0xCF, 0x89, 0xCE, 0xB8, 0xCE, 0xB7, 0xCE, 0xBA, 0xCE, 0xB1 };
+static const symbol s_5_2[14] = { 0xCF, 0x89, 0xCE, 0xB8, 0xCE, 0xB7, 0xCE, 0xBA, 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xB5 };
+static const symbol s_5_3[10] = { 0xCF, 0x89, 0xCE, 0xB8, 0xCE, 0xB7, 0xCE, 0xBA, 0xCE, 0xB5 };
+static const symbol s_5_4[14] = { 0xCF, 0x89, 0xCE, 0xB8, 0xCE, 0xB7, 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xBC, 0xCE, 0xB5 };
+static const symbol s_5_5[14] = { 0xCF, 0x89, 0xCE, 0xB8, 0xCE, 0xB7, 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB5 };
+static const symbol s_5_6[12] = { 0xCF, 0x89, 0xCE, 0xB8, 0xCE, 0xB7, 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xBD };
+static const struct among a_5[7] = {
+{ 12, s_5_0, 0, 1, 0},
+{ 10, s_5_1, 0, 1, 0},
+{ 14, s_5_2, 0, 1, 0},
+{ 10, s_5_3, 0, 1, 0},
+{ 14, s_5_4, 0, 1, 0},
+{ 14, s_5_5, 0, 1, 0},
+{ 12, s_5_6, 0, 1, 0}
+};
+
+static const symbol s_6_0[2] = { 0xCF, 0x80 };
+static const symbol s_6_1[6] = { 0xCE, 0xBB, 0xCE, 0xB1, 0xCF, 0x81 };
+static const symbol s_6_2[16] = { 0xCE, 0xB4, 0xCE, 0xB7, 0xCE, 0xBC, 0xCE, 0xBF, 0xCE, 0xBA, 0xCF, 0x81, 0xCE, 0xB1, 0xCF, 0x84 };
+static const symbol s_6_3[4] = { 0xCE, 0xB1, 0xCF, 0x86 };
+static const symbol s_6_4[18] = { 0xCE, 0xB3, 0xCE, 0xB9, 0xCE, 0xB3, 0xCE, 0xB1, 0xCE, 0xBD, 0xCF, 0x84, 0xCE, 0xBF, 0xCE, 0xB1, 0xCF, 0x86 };
+static const symbol s_6_5[12] = { 0xCE, 0xBE, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xB1 };
+static const symbol s_6_6[6] = { 0xCE, 0xB5, 0xCF, 0x80, 0xCE, 0xB1 };
+static const symbol s_6_7[12] = { 0xCF, 0x80, 0xCE, 0xB5, 0xCF, 0x81, 0xCE, 0xB9, 0xCF, 0x80, 0xCE, 0xB1 };
+static const symbol s_6_8[12] = { 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB1, 0xCE, 0xBC, 0xCF, 0x80, 0xCE, 0xB1 };
+static const symbol s_6_9[8] = { 0xCE, 0xB5, 0xCE, 0xBC, 0xCF, 0x80, 0xCE, 0xB1 };
+static const symbol s_6_10[14] = { 0xCF, 0x87, 0xCE, 0xB1, 0xCF, 0x81, 0xCF, 0x84, 0xCE, 0xBF, 0xCF, 0x80, 0xCE, 0xB1 };
+static const symbol s_6_11[12] = { 0xCE, 0xB5, 0xCE, 0xBE, 0xCE, 0xB1, 0xCF, 0x81, 0xCF, 0x87, 0xCE, 0xB1 };
+static const symbol s_6_12[4] = { 0xCF, 0x80, 0xCE, 0xB5 };
+static const symbol s_6_13[6] = { 0xCE, 0xB5, 0xCF, 0x80, 0xCE, 0xB5 };
+static const symbol s_6_14[12] = { 0xCE, 0xBC, 0xCE, 0xB5, 0xCF, 0x84, 0xCE, 0xB5, 0xCF, 0x80, 0xCE, 0xB5 };
+static const symbol s_6_15[6] = { 0xCE, 0xB5, 0xCF, 0x83, 0xCE, 0xB5 };
+static const symbol s_6_16[4] = { 0xCE, 0xB3, 0xCE, 0xB5 };
+static const symbol s_6_17[6] = { 0xCE, 0xB3, 0xCE, 0xBA, 0xCE, 0xB5 };
+static const symbol s_6_18[6] = { 0xCE, 0xBA, 0xCE, 0xBB, 0xCE, 0xB5 };
+static const symbol s_6_19[12] = { 0xCE, 0xB5, 0xCF, 0x83, 0xCF, 0x89, 0xCE, 0xBA, 0xCE, 0xBB, 0xCE, 0xB5 };
+static const symbol s_6_20[8] = { 0xCE, 0xB5, 0xCE, 0xBA, 0xCE, 0xBB, 0xCE, 0xB5 };
+static const symbol s_6_21[12] = { 0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xB5, 0xCE, 0xBA, 0xCE, 0xBB, 0xCE, 0xB5 };
+static const symbol s_6_22[12] = { 0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xBF, 0xCE, 0xBA, 0xCE, 0xBB, 0xCE, 0xB5 };
+static const symbol s_6_23[8] = { 0xCE, 0xB4, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB5 };
+static const symbol s_6_24[4] = { 0xCE, 0xB3, 0xCE, 0xBA };
+static const symbol s_6_25[2] = { 0xCE, 0xBC };
+static const symbol s_6_26[12] = { 0xCF, 0x80, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xBC };
+static const symbol s_6_27[6] = { 0xCE, 0xBA, 0xCE, 0xBF, 0xCE, 0xBC };
+static const symbol s_6_28[4] = { 0xCE, 0xB1, 0xCE, 0xBD };
+static const symbol s_6_29[8] = { 0xCE, 0xB1, 0xCE, 0xB8, 0xCF, 0x81, 0xCE, 0xBF };
+static const symbol s_6_30[14] = { 0xCF, 0x83, 0xCF, 0x85, 0xCE, 0xBD, 0xCE, 0xB1, 0xCE, 0xB8, 0xCF, 0x81, 0xCE, 0xBF };
+static const symbol s_6_31[6] = { 0xCE, 0xBF, 0xCE, 0xBB, 0xCE, 0xBF };
+static const struct among a_6[32] = {
+{ 2, s_6_0, 0, 2, 0},
+{ 6, s_6_1, 0, 2, 0},
+{ 16, s_6_2, 0, 2, 0},
+{ 4, s_6_3, 0, 2, 0},
+{ 18, s_6_4, -1, 2, 0},
+{ 12, s_6_5, 0, 1, 0},
+{ 6, s_6_6, 0, 1, 0},
+{ 12, s_6_7, 0, 1, 0},
+{ 12, s_6_8, 0, 1, 0},
+{ 8, s_6_9, 0, 1, 0},
+{ 14, s_6_10, 0, 1, 0},
+{ 12, s_6_11, 0, 1, 0},
+{ 4, s_6_12, 0, 1, 0},
+{ 6, s_6_13, -1, 1, 0},
+{ 12, s_6_14, -1, 1, 0},
+{ 6, s_6_15, 0, 1, 0},
+{ 4, s_6_16, 0, 2, 0},
+{ 6, s_6_17, 0, 2, 0},
+{ 6, s_6_18, 0, 1, 0},
+{ 12, s_6_19, -1, 1, 0},
+{ 8, s_6_20, -2, 1, 0},
+{ 12, s_6_21, -1, 1, 0},
+{ 12, s_6_22, -4, 1, 0},
+{ 8, s_6_23, 0, 1, 0},
+{ 4, s_6_24, 0, 2, 0},
+{ 2, s_6_25, 0, 2, 0},
+{ 12, s_6_26, -1, 2, 0},
+{ 6, s_6_27, -2, 2, 0},
+{ 4, s_6_28, 0, 2, 0},
+{ 8, s_6_29, 0, 1, 0},
+{ 14, s_6_30, -1, 1, 0},
+{ 6, s_6_31, 0, 2, 0}
+};
+
+static const symbol s_7_0[8] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCE, 0xB5, 0xCF, 0x83 };
+static const symbol s_7_1[6] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCE, 0xB1 };
+static const symbol s_7_2[6] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCE, 0xB5 };
+static const symbol s_7_3[10] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xB5 };
+static const symbol s_7_4[10] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCE, 0xB1, 0xCE, 0xBC, 0xCE, 0xB5 };
+static const symbol s_7_5[10] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB5 };
+static const symbol s_7_6[8] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCE, 0xB1, 0xCE, 0xBD };
+static const struct among a_7[7] = {
+{ 8, s_7_0, 0, 1, 0},
+{ 6, s_7_1, 0, 1, 0},
+{ 6, s_7_2, 0, 1, 0},
+{ 10, s_7_3, 0, 1, 0},
+{ 10, s_7_4, 0, 1, 0},
+{ 10, s_7_5, 0, 1, 0},
+{ 8, s_7_6, 0, 1, 0}
+};
+
+static const symbol s_8_0[12] = { 0xCE, 0xBE, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xB1 };
+static const symbol s_8_1[6] = { 0xCE, 0xB5, 0xCF, 0x80, 0xCE, 0xB1 };
+static const symbol s_8_2[12] = { 0xCF, 0x80, 0xCE, 0xB5, 0xCF, 0x81, 0xCE, 0xB9, 0xCF, 0x80, 0xCE, 0xB1 };
+static const symbol s_8_3[12] = { 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB1, 0xCE, 0xBC, 0xCF, 0x80, 0xCE, 0xB1 };
+static const symbol s_8_4[8] = { 0xCE, 0xB5, 0xCE, 0xBC, 0xCF, 0x80, 0xCE, 0xB1 };
+static const symbol s_8_5[14] = { 0xCF, 0x87, 0xCE, 0xB1, 0xCF, 0x81, 0xCF, 0x84, 0xCE, 0xBF, 0xCF, 0x80, 0xCE, 0xB1 };
+static const symbol s_8_6[12] = { 0xCE, 0xB5, 0xCE, 0xBE, 0xCE, 0xB1, 0xCF, 0x81, 0xCF, 0x87, 0xCE, 0xB1 };
+static const symbol s_8_7[4] = { 0xCF, 0x80, 0xCE, 0xB5 };
+static const symbol s_8_8[6] = { 0xCE, 0xB5, 0xCF, 0x80, 0xCE, 0xB5 };
+static const symbol s_8_9[12] = { 0xCE, 0xBC, 0xCE, 0xB5, 0xCF, 0x84, 0xCE, 0xB5, 0xCF, 0x80, 0xCE, 0xB5 };
+static const symbol s_8_10[6] = { 0xCE, 0xB5, 0xCF, 0x83, 0xCE, 0xB5 };
+static const symbol s_8_11[6] = { 0xCE, 0xBA, 0xCE, 0xBB, 0xCE, 0xB5 };
+static const symbol s_8_12[12] = { 0xCE, 0xB5, 0xCF, 0x83, 0xCF, 0x89, 0xCE, 0xBA, 0xCE, 0xBB, 0xCE, 0xB5 };
+static const symbol s_8_13[8] = { 0xCE, 0xB5, 0xCE, 0xBA, 0xCE, 0xBB, 0xCE, 0xB5 };
+static const symbol s_8_14[12] = { 0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xB5, 0xCE, 0xBA, 0xCE, 0xBB, 0xCE, 0xB5 };
+static const symbol s_8_15[12] = { 0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xBF, 0xCE, 0xBA, 0xCE, 0xBB, 0xCE, 0xB5 };
+static const symbol s_8_16[8] = { 0xCE, 0xB4, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB5 };
+static const symbol s_8_17[8] = { 0xCE, 0xB1, 0xCE, 0xB8, 0xCF, 0x81, 0xCE, 0xBF };
+static const symbol s_8_18[14] = { 0xCF, 0x83, 0xCF, 0x85, 0xCE, 0xBD, 0xCE, 0xB1, 0xCE, 0xB8, 0xCF, 0x81, 0xCE, 0xBF };
+static const struct among a_8[19] = {
+{ 12, s_8_0, 0, 1, 0},
+{ 6, s_8_1, 0, 1, 0},
+{ 12, s_8_2, 0, 1, 0},
+{ 12, s_8_3, 0, 1, 0},
+{ 8, s_8_4, 0, 1, 0},
+{ 14, s_8_5, 0, 1, 0},
+{ 12, s_8_6, 0, 1, 0},
+{ 4, s_8_7, 0, 1, 0},
+{ 6, s_8_8, -1, 1, 0},
+{ 12, s_8_9, -1, 1, 0},
+{ 6, s_8_10, 0, 1, 0},
+{ 6, s_8_11, 0, 1, 0},
+{ 12, s_8_12, -1, 1, 0},
+{ 8, s_8_13, -2, 1, 0},
+{ 12, s_8_14, -1, 1, 0},
+{ 12, s_8_15, -4, 1, 0},
+{ 8, s_8_16, 0, 1, 0},
+{ 8, s_8_17, 0, 1, 0},
+{ 14, s_8_18, -1, 1, 0}
+};
+
+static const symbol s_9_0[10] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCE, 0xB5, 0xCE, 0xB9, 0xCF, 0x83 };
+static const symbol s_9_1[6] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCF, 0x89 };
+static const symbol s_9_2[10] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCE, 0xB5, 0xCF, 0x84, 0xCE, 0xB5 };
+static const symbol s_9_3[12] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBC, 0xCE, 0xB5 };
+static const symbol s_9_4[12] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBD, 0xCE, 0xB5 };
+static const symbol s_9_5[8] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCE, 0xB5, 0xCE, 0xB9 };
+static const symbol s_9_6[10] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBD };
+static const struct among a_9[7] = {
+{ 10, s_9_0, 0, 1, 0},
+{ 6, s_9_1, 0, 1, 0},
+{ 10, s_9_2, 0, 1, 0},
+{ 12, s_9_3, 0, 1, 0},
+{ 12, s_9_4, 0, 1, 0},
+{ 8, s_9_5, 0, 1, 0},
+{ 10, s_9_6, 0, 1, 0}
+};
+
+static const symbol s_10_0[2] = { 0xCF, 0x80 };
+static const symbol s_10_1[6] = { 0xCE, 0xB5, 0xCF, 0x85, 0xCF, 0x80 };
+static const symbol s_10_2[4] = { 0xCE, 0xB1, 0xCF, 0x80 };
+static const symbol s_10_3[6] = { 0xCE, 0xB5, 0xCE, 0xBC, 0xCF, 0x80 };
+static const symbol s_10_4[6] = { 0xCE, 0xB3, 0xCF, 0x85, 0xCF, 0x81 };
+static const symbol s_10_5[4] = { 0xCF, 0x87, 0xCF, 0x81 };
+static const symbol s_10_6[6] = { 0xCF, 0x87, 0xCF, 0x89, 0xCF, 0x81 };
+static const symbol s_10_7[4] = { 0xCE, 0xB1, 0xCF, 0x81 };
+static const symbol s_10_8[6] = { 0xCE, 0xB1, 0xCE, 0xBF, 0xCF, 0x81 };
+static const symbol s_10_9[4] = { 0xCF, 0x87, 0xCF, 0x84 };
+static const symbol s_10_10[6] = { 0xCE, 0xB1, 0xCF, 0x87, 0xCF, 0x84 };
+static const symbol s_10_11[4] = { 0xCE, 0xBA, 0xCF, 0x84 };
+static const symbol s_10_12[6] = { 0xCE, 0xB1, 0xCE, 0xBA, 0xCF, 0x84 };
+static const symbol s_10_13[4] = { 0xCF, 0x83, 0xCF, 0x87 };
+static const symbol s_10_14[6] = { 0xCE, 0xB1, 0xCF, 0x83, 0xCF, 0x87 };
+static const symbol s_10_15[6] = { 0xCF, 0x84, 0xCE, 0xB1, 0xCF, 0x87 };
+static const symbol s_10_16[4] = { 0xCF, 0x85, 0xCF, 0x88 };
+static const symbol s_10_17[6] = { 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xB1 };
+static const symbol s_10_18[4] = { 0xCF, 0x86, 0xCE, 0xB1 };
+static const symbol s_10_19[6] = { 0xCE, 0xB7, 0xCF, 0x86, 0xCE, 0xB1 };
+static const symbol s_10_20[6] = { 0xCE, 0xBB, 0xCF, 0x85, 0xCE, 0xB3 };
+static const symbol s_10_21[6] = { 0xCE, 0xBC, 0xCE, 0xB5, 0xCE, 0xB3 };
+static const symbol s_10_22[4] = { 0xCE, 0xB7, 0xCE, 0xB4 };
+static const symbol s_10_23[4] = { 0xCF, 0x83, 0xCE, 0xB5 };
+static const symbol s_10_24[6] = { 0xCE, 0xB1, 0xCF, 0x83, 0xCE, 0xB5 };
+static const symbol s_10_25[6] = { 0xCF, 0x80, 0xCE, 0xBB, 0xCE, 0xB5 };
+static const symbol s_10_26[6] = { 0xCE, 0xBA, 0xCE, 0xBB, 0xCE, 0xB5 };
+static const symbol s_10_27[12] = { 0xCE, 0xB5, 0xCF, 0x83, 0xCF, 0x89, 0xCE, 0xBA, 0xCE, 0xBB, 0xCE, 0xB5 };
+static const symbol s_10_28[8] = { 0xCE, 0xB4, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB5 };
+static const symbol s_10_29[6] = { 0xCE, 0xB5, 0xCF, 0x87, 0xCE, 0xB8 };
+static const symbol s_10_30[6] = { 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xB8 };
+static const symbol s_10_31[4] = { 0xCF, 0x83, 0xCE, 0xBA };
+static const symbol s_10_32[6] = { 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xBA };
+static const symbol s_10_33[6] = { 0xCE, 0xBC, 0xCE, 0xB1, 0xCE, 0xBA };
+static const symbol s_10_34[6] = { 0xCE, 0xBA, 0xCF, 0x85, 0xCE, 0xBB };
+static const symbol s_10_35[6] = { 0xCF, 0x86, 0xCE, 0xB9, 0xCE, 0xBB };
+static const symbol s_10_36[2] = { 0xCE, 0xBC };
+static const symbol s_10_37[6] = { 0xCE, 0xB3, 0xCE, 0xB5, 0xCE, 0xBC };
+static const symbol s_10_38[6] = { 0xCE, 0xB1, 0xCF, 0x87, 0xCE, 0xBD };
+static const symbol s_10_39[14] = { 0xCF, 0x83, 0xCF, 0x85, 0xCE, 0xBD, 0xCE, 0xB1, 0xCE, 0xB8, 0xCF, 0x81, 0xCE, 0xBF };
+static const struct among a_10[40] = {
+{ 2, s_10_0, 0, 2, 0},
+{ 6, s_10_1, -1, 2, 0},
+{ 4, s_10_2, -2, 2, 0},
+{ 6, s_10_3, -3, 2, 0},
+{ 6, s_10_4, 0, 2, 0},
+{ 4, s_10_5, 0, 2, 0},
+{ 6, s_10_6, 0, 2, 0},
+{ 4, s_10_7, 0, 2, 0},
+{ 6, s_10_8, 0, 2, 0},
+{ 4, s_10_9, 0, 2, 0},
+{ 6, s_10_10, -1, 2, 0},
+{ 4, s_10_11, 0, 2, 0},
+{ 6, s_10_12, -1, 2, 0},
+{ 4, s_10_13, 0, 2, 0},
+{ 6, s_10_14, -1, 2, 0},
+{ 6, s_10_15, 0, 2, 0},
+{ 4, s_10_16, 0, 2, 0},
+{ 6, s_10_17, 0, 2, 0},
+{ 4, s_10_18, 0, 2, 0},
+{ 6, s_10_19, -1, 2, 0},
+{ 6, s_10_20, 0, 2, 0},
+{ 6, s_10_21, 0, 2, 0},
+{ 4, s_10_22, 0, 2, 0},
+{ 4, s_10_23, 0, 1, 0},
+{ 6, s_10_24, -1, 1, 0},
+{ 6, s_10_25, 0, 1, 0},
+{ 6, s_10_26, 0, 1, 0},
+{ 12, s_10_27, -1, 1, 0},
+{ 8, s_10_28, 0, 1, 0},
+{ 6, s_10_29, 0, 2, 0},
+{ 6, s_10_30, 0, 2, 0},
+{ 4, s_10_31, 0, 2, 0},
+{ 6, s_10_32, 0, 2, 0},
+{ 6, s_10_33, 0, 2, 0},
+{ 6, s_10_34, 0, 2, 0},
+{ 6, s_10_35, 0, 2, 0},
+{ 2, s_10_36, 0, 2, 0},
+{ 6, s_10_37, -1, 2, 0},
+{ 6, s_10_38, 0, 2, 0},
+{ 14, s_10_39, 0, 1, 0}
+};
+
+static const symbol s_11_0[12] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xBF, 0xCF, 0x85, 0xCF, 0x83 };
+static const symbol s_11_1[10] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB5, 0xCF, 0x83 };
+static const symbol s_11_2[10] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB7, 0xCF, 0x83 };
+static const symbol s_11_3[10] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xBF, 0xCF, 0x83 };
+static const symbol s_11_4[10] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xBF, 0xCF, 0x85 };
+static const symbol s_11_5[8] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB1 };
+static const symbol s_11_6[8] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB5 };
+static const symbol s_11_7[8] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB7 };
+static const symbol s_11_8[10] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xBF, 0xCE, 0xB9 };
+static const symbol s_11_9[10] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCF, 0x84, 0xCF, 0x89, 0xCE, 0xBD };
+static const symbol s_11_10[8] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xBF };
+static const struct among a_11[11] = {
+{ 12, s_11_0, 0, 1, 0},
+{ 10, s_11_1, 0, 1, 0},
+{ 10, s_11_2, 0, 1, 0},
+{ 10, s_11_3, 0, 1, 0},
+{ 10, s_11_4, 0, 1, 0},
+{ 8, s_11_5, 0, 1, 0},
+{ 8, s_11_6, 0, 1, 0},
+{ 8, s_11_7, 0, 1, 0},
+{ 10, s_11_8, 0, 1, 0},
+{ 10, s_11_9, 0, 1, 0},
+{ 8, s_11_10, 0, 1, 0}
+};
+
+static const symbol s_12_0[4] = { 0xCF, 0x83, 0xCE, 0xB5 };
+static const symbol s_12_1[12] = { 0xCE, 0xBC, 0xCE, 0xB5, 0xCF, 0x84, 0xCE, 0xB1, 0xCF, 0x83, 0xCE, 0xB5 };
+static const symbol s_12_2[14] = { 0xCE, 0xBC, 0xCE, 0xB9, 0xCE, 0xBA, 0xCF, 0x81, 0xCE, 0xBF, 0xCF, 0x83, 0xCE, 0xB5 };
+static const symbol s_12_3[10] = { 0xCE, 0xB5, 0xCE, 0xB3, 0xCE, 0xBA, 0xCE, 0xBB, 0xCE, 0xB5 };
+static const symbol s_12_4[12] = { 0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xBF, 0xCE, 0xBA, 0xCE, 0xBB, 0xCE, 0xB5 };
+static const symbol s_12_5[8] = { 0xCE, 0xB4, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB5 };
+static const symbol s_12_6[16] = { 0xCE, 0xB1, 0xCE, 0xBD, 0xCF, 0x84, 0xCE, 0xB9, 0xCE, 0xB4, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB5 };
+static const struct among a_12[7] = {
+{ 4, s_12_0, 0, 1, 0},
+{ 12, s_12_1, -1, 1, 0},
+{ 14, s_12_2, -2, 1, 0},
+{ 10, s_12_3, 0, 1, 0},
+{ 12, s_12_4, 0, 1, 0},
+{ 8, s_12_5, 0, 2, 0},
+{ 16, s_12_6, -1, 2, 0}
+};
+
+static const symbol s_13_0[10] = { 0xCF, 0x84, 0xCE, 0xBF, 0xCF, 0x80, 0xCE, 0xB9, 0xCE, 0xBA };
+static const symbol s_13_1[14] = { 0xCF, 0x83, 0xCE, 0xBA, 0xCE, 0xB5, 0xCF, 0x80, 0xCF, 0x84, 0xCE, 0xB9, 0xCE, 0xBA };
+static const symbol s_13_2[14] = { 0xCE, 0xB3, 0xCE, 0xBD, 0xCF, 0x89, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB9, 0xCE, 0xBA };
+static const symbol s_13_3[16] = { 0xCE, 0xB1, 0xCE, 0xB3, 0xCE, 0xBD, 0xCF, 0x89, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB9, 0xCE, 0xBA };
+static const symbol s_13_4[16] = { 0xCE, 0xB5, 0xCE, 0xBA, 0xCE, 0xBB, 0xCE, 0xB5, 0xCE, 0xBA, 0xCF, 0x84, 0xCE, 0xB9, 0xCE, 0xBA };
+static const symbol s_13_5[12] = { 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xBF, 0xCE, 0xBC, 0xCE, 0xB9, 0xCE, 0xBA };
+static const symbol s_13_6[10] = { 0xCE, 0xB5, 0xCE, 0xB8, 0xCE, 0xBD, 0xCE, 0xB9, 0xCE, 0xBA };
+static const symbol s_13_7[14] = { 0xCE, 0xB8, 0xCE, 0xB5, 0xCE, 0xB1, 0xCF, 0x84, 0xCF, 0x81, 0xCE, 0xB9, 0xCE, 0xBD };
+static const symbol s_13_8[20] = { 0xCE, 0xB1, 0xCE, 0xBB, 0xCE, 0xB5, 0xCE, 0xBE, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB4, 0xCF, 0x81, 0xCE, 0xB9, 0xCE, 0xBD };
+static const symbol s_13_9[16] = { 0xCE, 0xB2, 0xCF, 0x85, 0xCE, 0xB6, 0xCE, 0xB1, 0xCE, 0xBD, 0xCF, 0x84, 0xCE, 0xB9, 0xCE, 0xBD };
+static const struct among a_13[10] = {
+{ 10, s_13_0, 0, 7, 0},
+{ 14, s_13_1, 0, 6, 0},
+{ 14, s_13_2, 0, 3, 0},
+{ 16, s_13_3, -1, 1, 0},
+{ 16, s_13_4, 0, 5, 0},
+{ 12, s_13_5, 0, 2, 0},
+{ 10, s_13_6, 0, 4, 0},
+{ 14, s_13_7, 0, 10, 0},
+{ 20, s_13_8, 0, 8, 0},
+{ 16, s_13_9, 0, 9, 0}
+};
+
+static const symbol s_14_0[12] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCE, 0xBC, 0xCE, 0xBF, 0xCF, 0x85, 0xCF, 0x83 };
+static const symbol s_14_1[10] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCE, 0xBC, 0xCE, 0xBF, 0xCF, 0x83 };
+static const symbol s_14_2[10] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCE, 0xBC, 0xCE, 0xBF, 0xCF, 0x85 };
+static const symbol s_14_3[10] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCE, 0xBC, 0xCE, 0xBF, 0xCE, 0xB9 };
+static const symbol s_14_4[10] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCE, 0xBC, 0xCF, 0x89, 0xCE, 0xBD };
+static const symbol s_14_5[8] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCE, 0xBC, 0xCE, 0xBF };
+static const struct among a_14[6] = {
+{ 12, s_14_0, 0, 1, 0},
+{ 10, s_14_1, 0, 1, 0},
+{ 10, s_14_2, 0, 1, 0},
+{ 10, s_14_3, 0, 1, 0},
+{ 10, s_14_4, 0, 1, 0},
+{ 8, s_14_5, 0, 1, 0}
+};
+
+static const symbol s_15_0[2] = { 0xCF, 0x83 };
+static const symbol s_15_1[2] = { 0xCF, 0x87 };
+static const struct among a_15[2] = {
+{ 2, s_15_0, 0, 1, 0},
+{ 2, s_15_1, 0, 1, 0}
+};
+
+static const symbol s_16_0[12] = { 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xB1, 0xCE, 0xBA, 0xCE, 0xB9, 0xCE, 0xB1 };
+static const symbol s_16_1[14] = { 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xB4, 0xCE, 0xB1, 0xCE, 0xBA, 0xCE, 0xB9, 0xCE, 0xB1 };
+static const symbol s_16_2[10] = { 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xB1, 0xCE, 0xBA, 0xCE, 0xB9 };
+static const symbol s_16_3[12] = { 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xB4, 0xCE, 0xB1, 0xCE, 0xBA, 0xCE, 0xB9 };
+static const struct among a_16[4] = {
+{ 12, s_16_0, 0, 1, 0},
+{ 14, s_16_1, 0, 1, 0},
+{ 10, s_16_2, 0, 1, 0},
+{ 12, s_16_3, 0, 1, 0}
+};
+
+static const symbol s_17_0[2] = { 0xCF, 0x80 };
+static const symbol s_17_1[12] = { 0xCE, 0xBA, 0xCE, 0xB1, 0xCF, 0x84, 0xCF, 0x81, 0xCE, 0xB1, 0xCF, 0x80 };
+static const symbol s_17_2[2] = { 0xCF, 0x81 };
+static const symbol s_17_3[4] = { 0xCE, 0xB2, 0xCF, 0x81 };
+static const symbol s_17_4[8] = { 0xCE, 0xBB, 0xCE, 0xB1, 0xCE, 0xB2, 0xCF, 0x81 };
+static const symbol s_17_5[8] = { 0xCE, 0xB1, 0xCE, 0xBC, 0xCE, 0xB2, 0xCF, 0x81 };
+static const symbol s_17_6[10] = { 0xCF, 0x80, 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xB5, 0xCF, 0x81 };
+static const symbol s_17_7[6] = { 0xCE, 0xBC, 0xCE, 0xB5, 0xCF, 0x81 };
+static const symbol s_17_8[8] = { 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB8, 0xCF, 0x81 };
+static const symbol s_17_9[6] = { 0xCE, 0xBA, 0xCE, 0xBF, 0xCF, 0x81 };
+static const symbol s_17_10[2] = { 0xCF, 0x83 };
+static const symbol s_17_11[12] = { 0xCE, 0xBD, 0xCE, 0xB1, 0xCE, 0xB3, 0xCE, 0xBA, 0xCE, 0xB1, 0xCF, 0x83 };
+static const symbol s_17_12[6] = { 0xCF, 0x84, 0xCE, 0xBF, 0xCF, 0x83 };
+static const symbol s_17_13[10] = { 0xCE, 0xBC, 0xCE, 0xBF, 0xCF, 0x85, 0xCF, 0x83, 0xCF, 0x84 };
+static const symbol s_17_14[4] = { 0xCF, 0x81, 0xCF, 0x85 };
+static const symbol s_17_15[2] = { 0xCF, 0x86 };
+static const symbol s_17_16[4] = { 0xCF, 0x83, 0xCF, 0x86 };
+static const symbol s_17_17[10] = { 0xCE, 0xB1, 0xCE, 0xBB, 0xCE, 0xB9, 0xCF, 0x83, 0xCF, 0x86 };
+static const symbol s_17_18[6] = { 0xCE, 0xBD, 0xCF, 0x85, 0xCF, 0x86 };
+static const symbol s_17_19[2] = { 0xCF, 0x87 };
+static const symbol s_17_20[2] = { 0xCE, 0xB2 };
+static const symbol s_17_21[8] = { 0xCE, 0xB2, 0xCE, 0xB1, 0xCE, 0xBC, 0xCE, 0xB2 };
+static const symbol s_17_22[8] = { 0xCF, 0x83, 0xCE, 0xBB, 0xCE, 0xBF, 0xCE, 0xB2 };
+static const symbol s_17_23[18] = { 0xCF, 0x84, 0xCF, 0x83, 0xCE, 0xB5, 0xCF, 0x87, 0xCE, 0xBF, 0xCF, 0x83, 0xCE, 0xBB, 0xCE, 0xBF, 0xCE, 0xB2 };
+static const symbol s_17_24[8] = { 0xCE, 0xBA, 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xB4 };
+static const symbol s_17_25[2] = { 0xCE, 0xB6 };
+static const symbol s_17_26[4] = { 0xCF, 0x84, 0xCE, 0xB6 };
+static const symbol s_17_27[2] = { 0xCE, 0xBA };
+static const symbol s_17_28[4] = { 0xCF, 0x83, 0xCE, 0xBA };
+static const symbol s_17_29[10] = { 0xCE, 0xBA, 0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xB1, 0xCE, 0xBA };
+static const symbol s_17_30[6] = { 0xCF, 0x83, 0xCE, 0xBF, 0xCE, 0xBA };
+static const symbol s_17_31[4] = { 0xCF, 0x80, 0xCE, 0xBB };
+static const symbol s_17_32[6] = { 0xCF, 0x86, 0xCF, 0x85, 0xCE, 0xBB };
+static const symbol s_17_33[8] = { 0xCE, 0xBB, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBB };
+static const symbol s_17_34[6] = { 0xCE, 0xB2, 0xCE, 0xB1, 0xCE, 0xBB };
+static const symbol s_17_35[6] = { 0xCE, 0xBC, 0xCE, 0xB1, 0xCE, 0xBB };
+static const symbol s_17_36[4] = { 0xCE, 0xB3, 0xCE, 0xBB };
+static const symbol s_17_37[12] = { 0xCF, 0x84, 0xCF, 0x81, 0xCE, 0xB9, 0xCF, 0x80, 0xCE, 0xBF, 0xCE, 0xBB };
+static const symbol s_17_38[8] = { 0xCF, 0x86, 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xBC };
+static const symbol s_17_39[8] = { 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xB9, 0xCE, 0xBC };
+static const symbol s_17_40[8] = { 0xCE, 0xBA, 0xCE, 0xBB, 0xCE, 0xB9, 0xCE, 0xBC };
+static const symbol s_17_41[12] = { 0xCE, 0xBC, 0xCE, 0xB1, 0xCE, 0xBA, 0xCF, 0x81, 0xCF, 0x85, 0xCE, 0xBD };
+static const symbol s_17_42[8] = { 0xCF, 0x83, 0xCF, 0x80, 0xCE, 0xB1, 0xCE, 0xBD };
+static const symbol s_17_43[8] = { 0xCE, 0xB3, 0xCE, 0xB9, 0xCE, 0xB1, 0xCE, 0xBD };
+static const symbol s_17_44[14] = { 0xCE, 0xB7, 0xCE, 0xB3, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBC, 0xCE, 0xB5, 0xCE, 0xBD };
+static const symbol s_17_45[6] = { 0xCE, 0xBA, 0xCE, 0xBF, 0xCE, 0xBD };
+static const struct among a_17[46] = {
+{ 2, s_17_0, 0, 2, 0},
+{ 12, s_17_1, -1, 1, 0},
+{ 2, s_17_2, 0, 1, 0},
+{ 4, s_17_3, -1, 1, 0},
+{ 8, s_17_4, -1, 1, 0},
+{ 8, s_17_5, -2, 1, 0},
+{ 10, s_17_6, -4, 2, 0},
+{ 6, s_17_7, -5, 1, 0},
+{ 8, s_17_8, -6, 1, 0},
+{ 6, s_17_9, -7, 1, 0},
+{ 2, s_17_10, 0, 1, 0},
+{ 12, s_17_11, -1, 1, 0},
+{ 6, s_17_12, -2, 2, 0},
+{ 10, s_17_13, 0, 1, 0},
+{ 4, s_17_14, 0, 1, 0},
+{ 2, s_17_15, 0, 1, 0},
+{ 4, s_17_16, -1, 1, 0},
+{ 10, s_17_17, -1, 1, 0},
+{ 6, s_17_18, -3, 2, 0},
+{ 2, s_17_19, 0, 1, 0},
+{ 2, s_17_20, 0, 2, 0},
+{ 8, s_17_21, -1, 1, 0},
+{ 8, s_17_22, -2, 1, 0},
+{ 18, s_17_23, -1, 1, 0},
+{ 8, s_17_24, 0, 2, 0},
+{ 2, s_17_25, 0, 2, 0},
+{ 4, s_17_26, -1, 1, 0},
+{ 2, s_17_27, 0, 1, 0},
+{ 4, s_17_28, -1, 1, 0},
+{ 10, s_17_29, -2, 1, 0},
+{ 6, s_17_30, -3, 1, 0},
+{ 4, s_17_31, 0, 1, 0},
+{ 6, s_17_32, 0, 1, 0},
+{ 8, s_17_33, 0, 1, 0},
+{ 6, s_17_34, 0, 2, 0},
+{ 6, s_17_35, 0, 1, 0},
+{ 4, s_17_36, 0, 2, 0},
+{ 12, s_17_37, 0, 2, 0},
+{ 8, s_17_38, 0, 1, 0},
+{ 8, s_17_39, 0, 1, 0},
+{ 8, s_17_40, 0, 1, 0},
+{ 12, s_17_41, 0, 2, 0},
+{ 8, s_17_42, 0, 1, 0},
+{ 8, s_17_43, 0, 2, 0},
+{ 14, s_17_44, 0, 2, 0},
+{ 6, s_17_45, 0, 1, 0}
+};
+
+static const symbol s_18_0[10] = { 0xCE, 0xB9, 0xCF, 0x84, 0xCF, 0x83, 0xCE, 0xB1, 0xCF, 0x83 };
+static const symbol s_18_1[10] = { 0xCE, 0xB9, 0xCF, 0x84, 0xCF, 0x83, 0xCE, 0xB5, 0xCF, 0x83 };
+static const symbol s_18_2[8] = { 0xCE, 0xB9, 0xCF, 0x84, 0xCF, 0x83, 0xCE, 0xB1 };
+static const symbol s_18_3[8] = { 0xCE, 0xB1, 0xCE, 0xBA, 0xCE, 0xB9, 0xCE, 0xB1 };
+static const symbol s_18_4[12] = { 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xB1, 0xCE, 0xBA, 0xCE, 0xB9, 0xCE, 0xB1 };
+static const symbol s_18_5[6] = { 0xCE, 0xB1, 0xCE, 0xBA, 0xCE, 0xB9 };
+static const symbol s_18_6[10] = { 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xB1, 0xCE, 0xBA, 0xCE, 0xB9 };
+static const symbol s_18_7[10] = { 0xCE, 0xB9, 0xCF, 0x84, 0xCF, 0x83, 0xCF, 0x89, 0xCE, 0xBD };
+static const struct among a_18[8] = {
+{ 10, s_18_0, 0, 1, 0},
+{ 10, s_18_1, 0, 1, 0},
+{ 8, s_18_2, 0, 1, 0},
+{ 8, s_18_3, 0, 1, 0},
+{ 12, s_18_4, -1, 1, 0},
+{ 6, s_18_5, 0, 1, 0},
+{ 10, s_18_6, -1, 1, 0},
+{ 10, s_18_7, 0, 1, 0}
+};
+
+static const symbol s_19_0[4] = { 0xCE, 0xB9, 0xCF, 0x81 };
+static const symbol s_19_1[6] = { 0xCF, 0x88, 0xCE, 0xB1, 0xCE, 0xBB };
+static const symbol s_19_2[8] = { 0xCE, 0xB1, 0xCE, 0xB9, 0xCF, 0x86, 0xCE, 0xBD };
+static const symbol s_19_3[6] = { 0xCE, 0xBF, 0xCE, 0xBB, 0xCE, 0xBF };
+static const struct among a_19[4] = {
+{ 4, s_19_0, 0, 1, 0},
+{ 6, s_19_1, 0, 1, 0},
+{ 8, s_19_2, 0, 1, 0},
+{ 6, s_19_3, 0, 1, 0}
+};
+
+static const symbol s_20_0[2] = { 0xCE, 0xB5 };
+static const symbol s_20_1[10] = { 0xCF, 0x80, 0xCE, 0xB1, 0xCE, 0xB9, 0xCF, 0x87, 0xCE, 0xBD };
+static const struct among a_20[2] = {
+{ 2, s_20_0, 0, 1, 0},
+{ 10, s_20_1, 0, 1, 0}
+};
+
+static const symbol s_21_0[8] = { 0xCE, 0xB9, 0xCE, 0xB4, 0xCE, 0xB9, 0xCE, 0xB1 };
+static const symbol s_21_1[10] = { 0xCE, 0xB9, 0xCE, 0xB4, 0xCE, 0xB9, 0xCF, 0x89, 0xCE, 0xBD };
+static const symbol s_21_2[8] = { 0xCE, 0xB9, 0xCE, 0xB4, 0xCE, 0xB9, 0xCE, 0xBF };
+static const struct among a_21[3] = {
+{ 8, s_21_0, 0, 1, 0},
+{ 10, s_21_1, 0, 1, 0},
+{ 8, s_21_2, 0, 1, 0}
+};
+
+static const symbol s_22_0[2] = { 0xCF, 0x81 };
+static const symbol s_22_1[4] = { 0xCE, 0xB9, 0xCE, 0xB2 };
+static const symbol s_22_2[2] = { 0xCE, 0xB4 };
+static const symbol s_22_3[6] = { 0xCE, 0xBB, 0xCF, 0x85, 0xCE, 0xBA };
+static const symbol s_22_4[10] = { 0xCF, 0x86, 0xCF, 0x81, 0xCE, 0xB1, 0xCE, 0xB3, 0xCE, 0xBA };
+static const symbol s_22_5[8] = { 0xCE, 0xBF, 0xCE, 0xB2, 0xCE, 0xB5, 0xCE, 0xBB };
+static const symbol s_22_6[6] = { 0xCE, 0xBC, 0xCE, 0xB7, 0xCE, 0xBD };
+static const struct among a_22[7] = {
+{ 2, s_22_0, 0, 1, 0},
+{ 4, s_22_1, 0, 1, 0},
+{ 2, s_22_2, 0, 1, 0},
+{ 6, s_22_3, 0, 1, 0},
+{ 10, s_22_4, 0, 1, 0},
+{ 8, s_22_5, 0, 1, 0},
+{ 6, s_22_6, 0, 1, 0}
+};
+
+static const symbol s_23_0[10] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCE, 0xBA, 0xCE, 0xBF, 0xCF, 0x83 };
+static const symbol s_23_1[10] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCE, 0xBA, 0xCE, 0xBF, 0xCF, 0x85 };
+static const symbol s_23_2[8] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCE, 0xBA, 0xCE, 0xB5 };
+static const symbol s_23_3[8] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCE, 0xBA, 0xCE, 0xBF };
+static const struct among a_23[4] = {
+{ 10, s_23_0, 0, 1, 0},
+{ 10, s_23_1, 0, 1, 0},
+{ 8, s_23_2, 0, 1, 0},
+{ 8, s_23_3, 0, 1, 0}
+};
+
+static const symbol s_24_0[8] = { 0xCE, 0xB1, 0xCE, 0xB4, 0xCE, 0xB5, 0xCF, 0x83 };
+static const symbol s_24_1[8] = { 0xCE, 0xB1, 0xCE, 0xB4, 0xCF, 0x89, 0xCE, 0xBD };
+static const struct among a_24[2] = {
+{ 8, s_24_0, 0, 1, 0},
+{ 8, s_24_1, 0, 1, 0}
+};
+
+static const symbol s_25_0[10] = { 0xCE, 0xBC, 0xCF, 0x80, 0xCE, 0xB1, 0xCE, 0xBC, 0xCF, 0x80 };
+static const symbol s_25_1[6] = { 0xCE, 0xBA, 0xCF, 0x85, 0xCF, 0x81 };
+static const symbol s_25_2[10] = { 0xCF, 0x80, 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xB5, 0xCF, 0x81 };
+static const symbol s_25_3[10] = { 0xCF, 0x80, 0xCE, 0xB5, 0xCE, 0xB8, 0xCE, 0xB5, 0xCF, 0x81 };
+static const symbol s_25_4[10] = { 0xCE, 0xBD, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xBD, 0xCF, 0x84 };
+static const symbol s_25_5[10] = { 0xCE, 0xB3, 0xCE, 0xB9, 0xCE, 0xB1, 0xCE, 0xB3, 0xCE, 0xB9 };
+static const symbol s_25_6[6] = { 0xCE, 0xB8, 0xCE, 0xB5, 0xCE, 0xB9 };
+static const symbol s_25_7[4] = { 0xCE, 0xBF, 0xCE, 0xBA };
+static const symbol s_25_8[6] = { 0xCE, 0xBC, 0xCE, 0xB1, 0xCE, 0xBC };
+static const symbol s_25_9[6] = { 0xCE, 0xBC, 0xCE, 0xB1, 0xCE, 0xBD };
+static const struct among a_25[10] = {
+{ 10, s_25_0, 0, -1, 0},
+{ 6, s_25_1, 0, -1, 0},
+{ 10, s_25_2, 0, -1, 0},
+{ 10, s_25_3, 0, -1, 0},
+{ 10, s_25_4, 0, -1, 0},
+{ 10, s_25_5, 0, -1, 0},
+{ 6, s_25_6, 0, -1, 0},
+{ 4, s_25_7, 0, -1, 0},
+{ 6, s_25_8, 0, -1, 0},
+{ 6, s_25_9, 0, -1, 0}
+};
+
+static const symbol s_26_0[8] = { 0xCE, 0xB5, 0xCE, 0xB4, 0xCE, 0xB5, 0xCF, 0x83 };
+static const symbol s_26_1[8] = { 0xCE, 0xB5, 0xCE, 0xB4, 0xCF, 0x89, 0xCE, 0xBD };
+static const struct among a_26[2] = {
+{ 8, s_26_0, 0, 1, 0},
+{ 8, s_26_1, 0, 1, 0}
+};
+
+static const symbol s_27_0[10] = { 0xCE, 0xBA, 0xCF, 0x81, 0xCE, 0xB1, 0xCF, 0x83, 0xCF, 0x80 };
+static const symbol s_27_1[4] = { 0xCF, 0x85, 0xCF, 0x80 };
+static const symbol s_27_2[6] = { 0xCE, 0xB4, 0xCE, 0xB1, 0xCF, 0x80 };
+static const symbol s_27_3[6] = { 0xCE, 0xB3, 0xCE, 0xB7, 0xCF, 0x80 };
+static const symbol s_27_4[4] = { 0xCE, 0xB9, 0xCF, 0x80 };
+static const symbol s_27_5[6] = { 0xCE, 0xB5, 0xCE, 0xBC, 0xCF, 0x80 };
+static const symbol s_27_6[4] = { 0xCE, 0xBF, 0xCF, 0x80 };
+static const symbol s_27_7[6] = { 0xCE, 0xBC, 0xCE, 0xB9, 0xCE, 0xBB };
+static const struct among a_27[8] = {
+{ 10, s_27_0, 0, 1, 0},
+{ 4, s_27_1, 0, 1, 0},
+{ 6, s_27_2, 0, 1, 0},
+{ 6, s_27_3, 0, 1, 0},
+{ 4, s_27_4, 0, 1, 0},
+{ 6, s_27_5, 0, 1, 0},
+{ 4, s_27_6, 0, 1, 0},
+{ 6, s_27_7, 0, 1, 0}
+};
+
+static const symbol s_28_0[10] = { 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xB4, 0xCE, 0xB5, 0xCF, 0x83 };
+static const symbol s_28_1[10] = { 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xB4, 0xCF, 0x89, 0xCE, 0xBD };
+static const struct among a_28[2] = {
+{ 10, s_28_0, 0, 1, 0},
+{ 10, s_28_1, 0, 1, 0}
+};
+
+static const symbol s_29_0[4] = { 0xCF, 0x83, 0xCF, 0x80 };
+static const symbol s_29_1[4] = { 0xCF, 0x86, 0xCF, 0x81 };
+static const symbol s_29_2[2] = { 0xCF, 0x83 };
+static const symbol s_29_3[6] = { 0xCE, 0xBB, 0xCE, 0xB9, 0xCF, 0x87 };
+static const symbol s_29_4[8] = { 0xCF, 0x84, 0xCF, 0x81, 0xCE, 0xB1, 0xCE, 0xB3 };
+static const symbol s_29_5[4] = { 0xCF, 0x86, 0xCE, 0xB5 };
+static const symbol s_29_6[6] = { 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xBA };
+static const symbol s_29_7[4] = { 0xCF, 0x83, 0xCE, 0xBA };
+static const symbol s_29_8[12] = { 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xBB, 0xCE, 0xB9, 0xCE, 0xB1, 0xCE, 0xBA };
+static const symbol s_29_9[8] = { 0xCE, 0xBB, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBB };
+static const symbol s_29_10[4] = { 0xCF, 0x86, 0xCE, 0xBB };
+static const symbol s_29_11[10] = { 0xCF, 0x80, 0xCE, 0xB5, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xBB };
+static const symbol s_29_12[6] = { 0xCE, 0xB2, 0xCE, 0xB5, 0xCE, 0xBB };
+static const symbol s_29_13[4] = { 0xCF, 0x87, 0xCE, 0xBD };
+static const symbol s_29_14[8] = { 0xCF, 0x80, 0xCE, 0xBB, 0xCE, 0xB5, 0xCE, 0xBE };
+static const struct among a_29[15] = {
+{ 4, s_29_0, 0, 1, 0},
+{ 4, s_29_1, 0, 1, 0},
+{ 2, s_29_2, 0, 1, 0},
+{ 6, s_29_3, 0, 1, 0},
+{ 8, s_29_4, 0, 1, 0},
+{ 4, s_29_5, 0, 1, 0},
+{ 6, s_29_6, 0, 1, 0},
+{ 4, s_29_7, 0, 1, 0},
+{ 12, s_29_8, 0, 1, 0},
+{ 8, s_29_9, 0, 1, 0},
+{ 4, s_29_10, 0, 1, 0},
+{ 10, s_29_11, 0, 1, 0},
+{ 6, s_29_12, 0, 1, 0},
+{ 4, s_29_13, 0, 1, 0},
+{ 8, s_29_14, 0, 1, 0}
+};
+
+static const symbol s_30_0[6] = { 0xCE, 0xB5, 0xCF, 0x89, 0xCF, 0x83 };
+static const symbol s_30_1[6] = { 0xCE, 0xB5, 0xCF, 0x89, 0xCE, 0xBD };
+static const struct among a_30[2] = {
+{ 6, s_30_0, 0, 1, 0},
+{ 6, s_30_1, 0, 1, 0}
+};
+
+static const symbol s_31_0[2] = { 0xCF, 0x80 };
+static const symbol s_31_1[6] = { 0xCF, 0x80, 0xCE, 0xB1, 0xCF, 0x81 };
+static const symbol s_31_2[2] = { 0xCE, 0xB4 };
+static const symbol s_31_3[4] = { 0xCE, 0xB9, 0xCE, 0xB4 };
+static const symbol s_31_4[2] = { 0xCE, 0xB8 };
+static const symbol s_31_5[6] = { 0xCE, 0xB3, 0xCE, 0xB1, 0xCE, 0xBB };
+static const symbol s_31_6[4] = { 0xCE, 0xB5, 0xCE, 0xBB };
+static const symbol s_31_7[2] = { 0xCE, 0xBD };
+static const struct among a_31[8] = {
+{ 2, s_31_0, 0, 1, 0},
+{ 6, s_31_1, 0, 1, 0},
+{ 2, s_31_2, 0, 1, 0},
+{ 4, s_31_3, -1, 1, 0},
+{ 2, s_31_4, 0, 1, 0},
+{ 6, s_31_5, 0, 1, 0},
+{ 4, s_31_6, 0, 1, 0},
+{ 2, s_31_7, 0, 1, 0}
+};
+
+static const symbol s_32_0[6] = { 0xCE, 0xB9, 0xCE, 0xBF, 0xCF, 0x85 };
+static const symbol s_32_1[4] = { 0xCE, 0xB9, 0xCE, 0xB1 };
+static const symbol s_32_2[6] = { 0xCE, 0xB9, 0xCF, 0x89, 0xCE, 0xBD };
+static const struct among a_32[3] = {
+{ 6, s_32_0, 0, 1, 0},
+{ 4, s_32_1, 0, 1, 0},
+{ 6, s_32_2, 0, 1, 0}
+};
+
+static const symbol s_33_0[8] = { 0xCE, 0xB9, 0xCE, 0xBA, 0xCE, 0xBF, 0xCF, 0x85 };
+static const symbol s_33_1[6] = { 0xCE, 0xB9, 0xCE, 0xBA, 0xCE, 0xB1 };
+static const symbol s_33_2[8] = { 0xCE, 0xB9, 0xCE, 0xBA, 0xCF, 0x89, 0xCE, 0xBD };
+static const symbol s_33_3[6] = { 0xCE, 0xB9, 0xCE, 0xBA, 0xCE, 0xBF };
+static const struct among a_33[4] = {
+{ 8, s_33_0, 0, 1, 0},
+{ 6, s_33_1, 0, 1, 0},
+{ 8, s_33_2, 0, 1, 0},
+{ 6, s_33_3, 0, 1, 0}
+};
+
+static const symbol s_34_0[8] = { 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xBB, 0xCF, 0x80 };
+static const symbol s_34_1[6] = { 0xCE, 0xB3, 0xCE, 0xB5, 0xCF, 0x81 };
+static const symbol s_34_2[12] = { 0xCF, 0x80, 0xCE, 0xBB, 0xCE, 0xB9, 0xCE, 0xB1, 0xCF, 0x84, 0xCF, 0x83 };
+static const symbol s_34_3[8] = { 0xCF, 0x80, 0xCE, 0xB5, 0xCF, 0x84, 0xCF, 0x83 };
+static const symbol s_34_4[8] = { 0xCF, 0x80, 0xCE, 0xB9, 0xCF, 0x84, 0xCF, 0x83 };
+static const symbol s_34_5[6] = { 0xCF, 0x86, 0xCF, 0x85, 0xCF, 0x83 };
+static const symbol s_34_6[6] = { 0xCF, 0x87, 0xCE, 0xB1, 0xCF, 0x83 };
+static const symbol s_34_7[8] = { 0xCE, 0xBC, 0xCF, 0x80, 0xCE, 0xBF, 0xCF, 0x83 };
+static const symbol s_34_8[8] = { 0xCF, 0x83, 0xCE, 0xB5, 0xCF, 0x81, 0xCF, 0x84 };
+static const symbol s_34_9[14] = { 0xCE, 0xBC, 0xCF, 0x80, 0xCE, 0xB1, 0xCE, 0xB3, 0xCE, 0xB9, 0xCE, 0xB1, 0xCF, 0x84 };
+static const symbol s_34_10[6] = { 0xCE, 0xBD, 0xCE, 0xB9, 0xCF, 0x84 };
+static const symbol s_34_11[12] = { 0xCF, 0x80, 0xCE, 0xB9, 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xBD, 0xCF, 0x84 };
+static const symbol s_34_12[8] = { 0xCE, 0xB5, 0xCE, 0xBE, 0xCF, 0x89, 0xCE, 0xB4 };
+static const symbol s_34_13[4] = { 0xCE, 0xB1, 0xCE, 0xB4 };
+static const symbol s_34_14[10] = { 0xCE, 0xBA, 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xB4 };
+static const symbol s_34_15[10] = { 0xCF, 0x83, 0xCF, 0x85, 0xCE, 0xBD, 0xCE, 0xB1, 0xCE, 0xB4 };
+static const symbol s_34_16[10] = { 0xCE, 0xB1, 0xCE, 0xBD, 0xCF, 0x84, 0xCE, 0xB9, 0xCE, 0xB4 };
+static const symbol s_34_17[6] = { 0xCE, 0xB5, 0xCE, 0xBD, 0xCE, 0xB4 };
+static const symbol s_34_18[8] = { 0xCF, 0x85, 0xCF, 0x80, 0xCE, 0xBF, 0xCE, 0xB4 };
+static const symbol s_34_19[12] = { 0xCF, 0x80, 0xCF, 0x81, 0xCF, 0x89, 0xCF, 0x84, 0xCE, 0xBF, 0xCE, 0xB4 };
+static const symbol s_34_20[10] = { 0xCF, 0x86, 0xCF, 0x85, 0xCE, 0xBB, 0xCE, 0xBF, 0xCE, 0xB4 };
+static const symbol s_34_21[4] = { 0xCE, 0xB7, 0xCE, 0xB8 };
+static const symbol s_34_22[8] = { 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB7, 0xCE, 0xB8 };
+static const symbol s_34_23[6] = { 0xCE, 0xBE, 0xCE, 0xB9, 0xCE, 0xBA };
+static const symbol s_34_24[8] = { 0xCE, 0xBC, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBB };
+static const symbol s_34_25[4] = { 0xCE, 0xB1, 0xCE, 0xBB };
+static const symbol s_34_26[14] = { 0xCE, 0xB1, 0xCE, 0xBC, 0xCE, 0xBC, 0xCE, 0xBF, 0xCF, 0x87, 0xCE, 0xB1, 0xCE, 0xBB };
+static const symbol s_34_27[14] = { 0xCF, 0x83, 0xCF, 0x85, 0xCE, 0xBD, 0xCE, 0xBF, 0xCE, 0xBC, 0xCE, 0xB7, 0xCE, 0xBB };
+static const symbol s_34_28[8] = { 0xCE, 0xBC, 0xCF, 0x80, 0xCE, 0xBF, 0xCE, 0xBB };
+static const symbol s_34_29[8] = { 0xCE, 0xB2, 0xCF, 0x81, 0xCF, 0x89, 0xCE, 0xBC };
+static const symbol s_34_30[8] = { 0xCF, 0x84, 0xCF, 0x83, 0xCE, 0xB1, 0xCE, 0xBC };
+static const symbol s_34_31[8] = { 0xCE, 0xBC, 0xCF, 0x80, 0xCE, 0xB1, 0xCE, 0xBD };
+static const symbol s_34_32[8] = { 0xCE, 0xB1, 0xCE, 0xBC, 0xCE, 0xB1, 0xCE, 0xBD };
+static const symbol s_34_33[12] = { 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xBB, 0xCE, 0xBB, 0xCE, 0xB9, 0xCE, 0xBD };
+static const symbol s_34_34[14] = { 0xCF, 0x80, 0xCE, 0xBF, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB5, 0xCE, 0xBB, 0xCE, 0xBD };
+static const symbol s_34_35[10] = { 0xCF, 0x86, 0xCE, 0xB9, 0xCE, 0xBB, 0xCE, 0xBF, 0xCE, 0xBD };
+static const struct among a_34[36] = {
+{ 8, s_34_0, 0, 1, 0},
+{ 6, s_34_1, 0, 1, 0},
+{ 12, s_34_2, 0, 1, 0},
+{ 8, s_34_3, 0, 1, 0},
+{ 8, s_34_4, 0, 1, 0},
+{ 6, s_34_5, 0, 1, 0},
+{ 6, s_34_6, 0, 1, 0},
+{ 8, s_34_7, 0, 1, 0},
+{ 8, s_34_8, 0, 1, 0},
+{ 14, s_34_9, 0, 1, 0},
+{ 6, s_34_10, 0, 1, 0},
+{ 12, s_34_11, 0, 1, 0},
+{ 8, s_34_12, 0, 1, 0},
+{ 4, s_34_13, 0, 1, 0},
+{ 10, s_34_14, -1, 1, 0},
+{ 10, s_34_15, -2, 1, 0},
+{ 10, s_34_16, 0, 1, 0},
+{ 6, s_34_17, 0, 1, 0},
+{ 8, s_34_18, 0, 1, 0},
+{ 12, s_34_19, 0, 1, 0},
+{ 10, s_34_20, 0, 1, 0},
+{ 4, s_34_21, 0, 1, 0},
+{ 8, s_34_22, -1, 1, 0},
+{ 6, s_34_23, 0, 1, 0},
+{ 8, s_34_24, 0, 1, 0},
+{ 4, s_34_25, 0, 1, 0},
+{ 14, s_34_26, -1, 1, 0},
+{ 14, s_34_27, 0, 1, 0},
+{ 8, s_34_28, 0, 1, 0},
+{ 8, s_34_29, 0, 1, 0},
+{ 8, s_34_30, 0, 1, 0},
+{ 8, s_34_31, 0, 1, 0},
+{ 8, s_34_32, 0, 1, 0},
+{ 12, s_34_33, 0, 1, 0},
+{ 14, s_34_34, 0, 1, 0},
+{ 10, s_34_35, 0, 1, 0}
+};
+
+static const symbol s_35_0[12] = { 0xCE, 0xBF, 0xCF, 0x85, 0xCF, 0x83, 0xCE, 0xB1, 0xCE, 0xBC, 0xCE, 0xB5 };
+static const symbol s_35_1[10] = { 0xCE, 0xB7, 0xCF, 0x83, 0xCE, 0xB1, 0xCE, 0xBC, 0xCE, 0xB5 };
+static const symbol s_35_2[10] = { 0xCE, 0xB1, 0xCE, 0xB3, 0xCE, 0xB1, 0xCE, 0xBC, 0xCE, 0xB5 };
+static const symbol s_35_3[10] = { 0xCE, 0xB7, 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xBC, 0xCE, 0xB5 };
+static const symbol s_35_4[14] = { 0xCE, 0xB7, 0xCE, 0xB8, 0xCE, 0xB7, 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xBC, 0xCE, 0xB5 };
+static const struct among a_35[5] = {
+{ 12, s_35_0, 0, 1, 0},
+{ 10, s_35_1, 0, 1, 0},
+{ 10, s_35_2, 0, 1, 0},
+{ 10, s_35_3, 0, 1, 0},
+{ 14, s_35_4, -1, 1, 0}
+};
+
+static const symbol s_36_0[8] = { 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB1, 0xCF, 0x80 };
+static const symbol s_36_1[8] = { 0xCF, 0x80, 0xCE, 0xB9, 0xCE, 0xBA, 0xCF, 0x81 };
+static const symbol s_36_2[10] = { 0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xBF, 0xCF, 0x83, 0xCF, 0x84 };
+static const symbol s_36_3[6] = { 0xCF, 0x80, 0xCE, 0xBF, 0xCF, 0x84 };
+static const symbol s_36_4[2] = { 0xCF, 0x87 };
+static const symbol s_36_5[6] = { 0xCF, 0x83, 0xCE, 0xB9, 0xCF, 0x87 };
+static const symbol s_36_6[8] = { 0xCE, 0xB2, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xB2 };
+static const symbol s_36_7[6] = { 0xCF, 0x80, 0xCE, 0xB5, 0xCE, 0xB8 };
+static const symbol s_36_8[6] = { 0xCE, 0xBE, 0xCE, 0xB5, 0xCE, 0xB8 };
+static const symbol s_36_9[8] = { 0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xBF, 0xCE, 0xB8 };
+static const symbol s_36_10[8] = { 0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xBF, 0xCE, 0xBA };
+static const symbol s_36_11[6] = { 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBB };
+static const struct among a_36[12] = {
+{ 8, s_36_0, 0, 1, 0},
+{ 8, s_36_1, 0, 1, 0},
+{ 10, s_36_2, 0, 1, 0},
+{ 6, s_36_3, 0, 1, 0},
+{ 2, s_36_4, 0, 1, 0},
+{ 6, s_36_5, -1, 1, 0},
+{ 8, s_36_6, 0, 1, 0},
+{ 6, s_36_7, 0, 1, 0},
+{ 6, s_36_8, 0, 1, 0},
+{ 8, s_36_9, 0, 1, 0},
+{ 8, s_36_10, 0, 1, 0},
+{ 6, s_36_11, 0, 1, 0}
+};
+
+static const symbol s_37_0[4] = { 0xCF, 0x84, 0xCF, 0x81 };
+static const symbol s_37_1[4] = { 0xCF, 0x84, 0xCF, 0x83 };
+static const struct among a_37[2] = {
+{ 4, s_37_0, 0, 1, 0},
+{ 4, s_37_1, 0, 1, 0}
+};
+
+static const symbol s_38_0[12] = { 0xCE, 0xBF, 0xCF, 0x85, 0xCF, 0x83, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB5 };
+static const symbol s_38_1[10] = { 0xCE, 0xB7, 0xCF, 0x83, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB5 };
+static const symbol s_38_2[14] = { 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBD, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB5 };
+static const symbol s_38_3[16] = { 0xCE, 0xB9, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBD, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB5 };
+static const symbol s_38_4[12] = { 0xCE, 0xBF, 0xCE, 0xBD, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB5 };
+static const symbol s_38_5[14] = { 0xCE, 0xB9, 0xCE, 0xBF, 0xCE, 0xBD, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB5 };
+static const symbol s_38_6[10] = { 0xCE, 0xBF, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB5 };
+static const symbol s_38_7[12] = { 0xCE, 0xB9, 0xCE, 0xBF, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB5 };
+static const symbol s_38_8[10] = { 0xCE, 0xB1, 0xCE, 0xB3, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB5 };
+static const symbol s_38_9[10] = { 0xCE, 0xB7, 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB5 };
+static const symbol s_38_10[14] = { 0xCE, 0xB7, 0xCE, 0xB8, 0xCE, 0xB7, 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB5 };
+static const struct among a_38[11] = {
+{ 12, s_38_0, 0, 1, 0},
+{ 10, s_38_1, 0, 1, 0},
+{ 14, s_38_2, 0, 1, 0},
+{ 16, s_38_3, -1, 1, 0},
+{ 12, s_38_4, 0, 1, 0},
+{ 14, s_38_5, -1, 1, 0},
+{ 10, s_38_6, 0, 1, 0},
+{ 12, s_38_7, -1, 1, 0},
+{ 10, s_38_8, 0, 1, 0},
+{ 10, s_38_9, 0, 1, 0},
+{ 14, s_38_10, -1, 1, 0}
+};
+
+static const symbol s_39_0[2] = { 0xCF, 0x80 };
+static const symbol s_39_1[4] = { 0xCF, 0x83, 0xCF, 0x80 };
+static const symbol s_39_2[14] = { 0xCF, 0x80, 0xCE, 0xBF, 0xCE, 0xBB, 0xCF, 0x85, 0xCE, 0xB4, 0xCE, 0xB1, 0xCF, 0x80 };
+static const symbol s_39_3[8] = { 0xCE, 0xB1, 0xCE, 0xB4, 0xCE, 0xB1, 0xCF, 0x80 };
+static const symbol s_39_4[18] = { 0xCF, 0x87, 0xCE, 0xB1, 0xCE, 0xBC, 0xCE, 0xB7, 0xCE, 0xBB, 0xCE, 0xBF, 0xCE, 0xB4, 0xCE, 0xB1, 0xCF, 0x80 };
+static const symbol s_39_5[8] = { 0xCF, 0x84, 0xCF, 0x83, 0xCE, 0xBF, 0xCF, 0x80 };
+static const symbol s_39_6[6] = { 0xCE, 0xBA, 0xCE, 0xBF, 0xCF, 0x80 };
+static const symbol s_39_7[12] = { 0xCF, 0x85, 0xCF, 0x80, 0xCE, 0xBF, 0xCE, 0xBA, 0xCE, 0xBF, 0xCF, 0x80 };
+static const symbol s_39_8[12] = { 0xCF, 0x80, 0xCE, 0xB5, 0xCF, 0x81, 0xCE, 0xB9, 0xCF, 0x84, 0xCF, 0x81 };
+static const symbol s_39_9[6] = { 0xCE, 0xBF, 0xCF, 0x85, 0xCF, 0x81 };
+static const symbol s_39_10[4] = { 0xCE, 0xB5, 0xCF, 0x81 };
+static const symbol s_39_11[10] = { 0xCE, 0xB2, 0xCE, 0xB5, 0xCF, 0x84, 0xCE, 0xB5, 0xCF, 0x81 };
+static const symbol s_39_12[6] = { 0xCE, 0xB3, 0xCE, 0xB5, 0xCF, 0x81 };
+static const symbol s_39_13[12] = { 0xCE, 0xBB, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xB8, 0xCE, 0xB7, 0xCF, 0x81 };
+static const symbol s_39_14[12] = { 0xCE, 0xBA, 0xCE, 0xBF, 0xCF, 0x81, 0xCE, 0xBC, 0xCE, 0xBF, 0xCF, 0x81 };
+static const symbol s_39_15[2] = { 0xCF, 0x83 };
+static const symbol s_39_16[16] = { 0xCF, 0x83, 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xB1, 0xCE, 0xBA, 0xCE, 0xB1, 0xCF, 0x84, 0xCF, 0x83 };
+static const symbol s_39_17[6] = { 0xCE, 0xB8, 0xCF, 0x85, 0xCF, 0x83 };
+static const symbol s_39_18[6] = { 0xCE, 0xB2, 0xCE, 0xB1, 0xCF, 0x83 };
+static const symbol s_39_19[10] = { 0xCF, 0x80, 0xCE, 0xBF, 0xCE, 0xBB, 0xCE, 0xB9, 0xCF, 0x83 };
+static const symbol s_39_20[8] = { 0xCE, 0xBA, 0xCE, 0xB1, 0xCF, 0x83, 0xCF, 0x84 };
+static const symbol s_39_21[8] = { 0xCE, 0xB4, 0xCE, 0xB9, 0xCE, 0xB1, 0xCF, 0x84 };
+static const symbol s_39_22[8] = { 0xCF, 0x80, 0xCE, 0xBB, 0xCE, 0xB1, 0xCF, 0x84 };
+static const symbol s_39_23[14] = { 0xCF, 0x84, 0xCF, 0x83, 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xBB, 0xCE, 0xB1, 0xCF, 0x84 };
+static const symbol s_39_24[6] = { 0xCF, 0x84, 0xCE, 0xB5, 0xCF, 0x84 };
+static const symbol s_39_25[12] = { 0xCF, 0x80, 0xCE, 0xBF, 0xCF, 0x85, 0xCF, 0x81, 0xCE, 0xB9, 0xCF, 0x84 };
+static const symbol s_39_26[10] = { 0xCF, 0x83, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBB, 0xCF, 0x84 };
+static const symbol s_39_27[8] = { 0xCE, 0xB6, 0xCF, 0x89, 0xCE, 0xBD, 0xCF, 0x84 };
+static const symbol s_39_28[10] = { 0xCE, 0xBC, 0xCE, 0xB1, 0xCE, 0xB9, 0xCE, 0xBD, 0xCF, 0x84 };
+static const symbol s_39_29[2] = { 0xCF, 0x86 };
+static const symbol s_39_30[14] = { 0xCF, 0x80, 0xCE, 0xB5, 0xCE, 0xBD, 0xCF, 0x84, 0xCE, 0xB1, 0xCF, 0x81, 0xCF, 0x86 };
+static const symbol s_39_31[14] = { 0xCE, 0xBA, 0xCE, 0xBF, 0xCE, 0xB9, 0xCE, 0xBB, 0xCE, 0xB1, 0xCF, 0x81, 0xCF, 0x86 };
+static const symbol s_39_32[6] = { 0xCE, 0xBF, 0xCF, 0x81, 0xCF, 0x86 };
+static const symbol s_39_33[8] = { 0xCE, 0xB4, 0xCE, 0xB9, 0xCE, 0xB1, 0xCF, 0x86 };
+static const symbol s_39_34[8] = { 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB5, 0xCF, 0x86 };
+static const symbol s_39_35[16] = { 0xCF, 0x86, 0xCF, 0x89, 0xCF, 0x84, 0xCE, 0xBF, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB5, 0xCF, 0x86 };
+static const symbol s_39_36[10] = { 0xCF, 0x80, 0xCE, 0xB5, 0xCF, 0x81, 0xCE, 0xB7, 0xCF, 0x86 };
+static const symbol s_39_37[12] = { 0xCF, 0x85, 0xCF, 0x80, 0xCE, 0xB5, 0xCF, 0x81, 0xCE, 0xB7, 0xCF, 0x86 };
+static const symbol s_39_38[2] = { 0xCF, 0x87 };
+static const symbol s_39_39[14] = { 0xCF, 0x80, 0xCE, 0xBF, 0xCE, 0xBB, 0xCF, 0x85, 0xCE, 0xBC, 0xCE, 0xB7, 0xCF, 0x87 };
+static const symbol s_39_40[8] = { 0xCE, 0xB1, 0xCE, 0xBC, 0xCE, 0xB7, 0xCF, 0x87 };
+static const symbol s_39_41[12] = { 0xCE, 0xB2, 0xCE, 0xB9, 0xCE, 0xBF, 0xCE, 0xBC, 0xCE, 0xB7, 0xCF, 0x87 };
+static const symbol s_39_42[22] = { 0xCE, 0xBC, 0xCE, 0xB9, 0xCE, 0xBA, 0xCF, 0x81, 0xCE, 0xBF, 0xCE, 0xB2, 0xCE, 0xB9, 0xCE, 0xBF, 0xCE, 0xBC, 0xCE, 0xB7, 0xCF, 0x87 };
+static const symbol s_39_43[22] = { 0xCE, 0xBC, 0xCE, 0xB5, 0xCE, 0xB3, 0xCE, 0xBB, 0xCE, 0xBF, 0xCE, 0xB2, 0xCE, 0xB9, 0xCE, 0xBF, 0xCE, 0xBC, 0xCE, 0xB7, 0xCF, 0x87 };
+static const symbol s_39_44[22] = { 0xCE, 0xBA, 0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xBD, 0xCE, 0xBF, 0xCE, 0xB2, 0xCE, 0xB9, 0xCE, 0xBF, 0xCE, 0xBC, 0xCE, 0xB7, 0xCF, 0x87 };
+static const symbol s_39_45[6] = { 0xCE, 0xBB, 0xCE, 0xB9, 0xCF, 0x87 };
+static const symbol s_39_46[6] = { 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xB2 };
+static const symbol s_39_47[8] = { 0xCE, 0xBD, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xB2 };
+static const symbol s_39_48[14] = { 0xCF, 0x88, 0xCE, 0xB7, 0xCE, 0xBB, 0xCE, 0xBF, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xB2 };
+static const symbol s_39_49[6] = { 0xCE, 0xBB, 0xCE, 0xB9, 0xCE, 0xB2 };
+static const symbol s_39_50[8] = { 0xCE, 0xBA, 0xCE, 0xBB, 0xCE, 0xB9, 0xCE, 0xB2 };
+static const symbol s_39_51[16] = { 0xCE, 0xBE, 0xCE, 0xB7, 0xCF, 0x81, 0xCE, 0xBF, 0xCE, 0xBA, 0xCE, 0xBB, 0xCE, 0xB9, 0xCE, 0xB2 };
+static const symbol s_39_52[2] = { 0xCE, 0xB3 };
+static const symbol s_39_53[10] = { 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xBF, 0xCF, 0x81, 0xCE, 0xB3 };
+static const symbol s_39_54[10] = { 0xCE, 0xB5, 0xCE, 0xBD, 0xCE, 0xBF, 0xCF, 0x81, 0xCE, 0xB3 };
+static const symbol s_39_55[4] = { 0xCE, 0xB1, 0xCE, 0xB3 };
+static const symbol s_39_56[8] = { 0xCF, 0x84, 0xCF, 0x81, 0xCE, 0xB1, 0xCE, 0xB3 };
+static const symbol s_39_57[8] = { 0xCF, 0x84, 0xCF, 0x83, 0xCE, 0xB1, 0xCE, 0xB3 };
+static const symbol s_39_58[10] = { 0xCF, 0x84, 0xCF, 0x83, 0xCE, 0xB9, 0xCE, 0xB3, 0xCE, 0xB3 };
+static const symbol s_39_59[12] = { 0xCE, 0xB1, 0xCF, 0x84, 0xCF, 0x83, 0xCE, 0xB9, 0xCE, 0xB3, 0xCE, 0xB3 };
+static const symbol s_39_60[10] = { 0xCE, 0xB1, 0xCE, 0xB8, 0xCE, 0xB9, 0xCE, 0xB3, 0xCE, 0xB3 };
+static const symbol s_39_61[8] = { 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB5, 0xCE, 0xB3 };
+static const symbol s_39_62[8] = { 0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xB7, 0xCE, 0xB3 };
+static const symbol s_39_63[6] = { 0xCF, 0x83, 0xCE, 0xB9, 0xCE, 0xB3 };
+static const symbol s_39_64[14] = { 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xBB, 0xCF, 0x80, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xB6 };
+static const symbol s_39_65[2] = { 0xCE, 0xB8 };
+static const symbol s_39_66[12] = { 0xCE, 0xBC, 0xCF, 0x89, 0xCE, 0xB1, 0xCE, 0xBC, 0xCE, 0xB5, 0xCE, 0xB8 };
+static const symbol s_39_67[6] = { 0xCF, 0x80, 0xCE, 0xB9, 0xCE, 0xB8 };
+static const symbol s_39_68[8] = { 0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xB9, 0xCE, 0xB8 };
+static const symbol s_39_69[8] = { 0xCE, 0xB2, 0xCE, 0xB1, 0xCF, 0x83, 0xCE, 0xBA };
+static const symbol s_39_70[12] = { 0xCE, 0xB2, 0xCF, 0x81, 0xCE, 0xB1, 0xCF, 0x87, 0xCF, 0x85, 0xCE, 0xBA };
+static const symbol s_39_71[6] = { 0xCE, 0xB4, 0xCE, 0xB5, 0xCE, 0xBA };
+static const symbol s_39_72[10] = { 0xCF, 0x80, 0xCE, 0xB5, 0xCE, 0xBB, 0xCE, 0xB5, 0xCE, 0xBA };
+static const symbol s_39_73[4] = { 0xCE, 0xB9, 0xCE, 0xBA };
+static const symbol s_39_74[8] = { 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB9, 0xCE, 0xBA };
+static const symbol s_39_75[10] = { 0xCE, 0xB2, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBB, 0xCE, 0xBA };
+static const symbol s_39_76[4] = { 0xCF, 0x80, 0xCE, 0xBB };
+static const symbol s_39_77[8] = { 0xCE, 0xB4, 0xCE, 0xB9, 0xCF, 0x80, 0xCE, 0xBB };
+static const symbol s_39_78[12] = { 0xCF, 0x88, 0xCF, 0x85, 0xCF, 0x87, 0xCE, 0xBF, 0xCF, 0x80, 0xCE, 0xBB };
+static const symbol s_39_79[10] = { 0xCE, 0xBB, 0xCE, 0xB1, 0xCE, 0xBF, 0xCF, 0x80, 0xCE, 0xBB };
+static const symbol s_39_80[6] = { 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBB };
+static const symbol s_39_81[6] = { 0xCE, 0xB3, 0xCE, 0xB1, 0xCE, 0xBB };
+static const symbol s_39_82[14] = { 0xCE, 0xB2, 0xCE, 0xB1, 0xCE, 0xB8, 0xCF, 0x85, 0xCE, 0xB3, 0xCE, 0xB1, 0xCE, 0xBB };
+static const symbol s_39_83[14] = { 0xCE, 0xBA, 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xB3, 0xCE, 0xB1, 0xCE, 0xBB };
+static const symbol s_39_84[12] = { 0xCE, 0xBF, 0xCE, 0xBB, 0xCE, 0xBF, 0xCE, 0xB3, 0xCE, 0xB1, 0xCE, 0xBB };
+static const symbol s_39_85[12] = { 0xCE, 0xBA, 0xCE, 0xB1, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB5, 0xCE, 0xBB };
+static const symbol s_39_86[6] = { 0xCE, 0xBC, 0xCE, 0xB5, 0xCE, 0xBB };
+static const symbol s_39_87[12] = { 0xCF, 0x80, 0xCE, 0xBF, 0xCF, 0x81, 0xCF, 0x84, 0xCE, 0xBF, 0xCE, 0xBB };
+static const symbol s_39_88[2] = { 0xCE, 0xBC };
+static const symbol s_39_89[14] = { 0xCE, 0xB4, 0xCF, 0x81, 0xCE, 0xB1, 0xCE, 0xB4, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBC };
+static const symbol s_39_90[10] = { 0xCE, 0xB2, 0xCF, 0x81, 0xCE, 0xB1, 0xCF, 0x87, 0xCE, 0xBC };
+static const symbol s_39_91[16] = { 0xCE, 0xBF, 0xCE, 0xBB, 0xCE, 0xB9, 0xCE, 0xB3, 0xCE, 0xBF, 0xCE, 0xB4, 0xCE, 0xB1, 0xCE, 0xBC };
+static const symbol s_39_92[16] = { 0xCE, 0xBC, 0xCE, 0xBF, 0xCF, 0x85, 0xCF, 0x83, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBB, 0xCE, 0xBC };
+static const symbol s_39_93[2] = { 0xCE, 0xBD };
+static const symbol s_39_94[16] = { 0xCE, 0xB1, 0xCE, 0xBC, 0xCE, 0xB5, 0xCF, 0x81, 0xCE, 0xB9, 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xBD };
+static const struct among a_39[95] = {
+{ 2, s_39_0, 0, 1, 0},
+{ 4, s_39_1, -1, 1, 0},
+{ 14, s_39_2, -2, 1, 0},
+{ 8, s_39_3, -3, 1, 0},
+{ 18, s_39_4, -4, 1, 0},
+{ 8, s_39_5, -5, 1, 0},
+{ 6, s_39_6, -6, 1, 0},
+{ 12, s_39_7, -1, 1, 0},
+{ 12, s_39_8, 0, 1, 0},
+{ 6, s_39_9, 0, 1, 0},
+{ 4, s_39_10, 0, 1, 0},
+{ 10, s_39_11, -1, 1, 0},
+{ 6, s_39_12, -2, 1, 0},
+{ 12, s_39_13, 0, 1, 0},
+{ 12, s_39_14, 0, 1, 0},
+{ 2, s_39_15, 0, 1, 0},
+{ 16, s_39_16, -1, 1, 0},
+{ 6, s_39_17, -2, 1, 0},
+{ 6, s_39_18, -3, 1, 0},
+{ 10, s_39_19, -4, 1, 0},
+{ 8, s_39_20, 0, 1, 0},
+{ 8, s_39_21, 0, 1, 0},
+{ 8, s_39_22, 0, 1, 0},
+{ 14, s_39_23, 0, 1, 0},
+{ 6, s_39_24, 0, 1, 0},
+{ 12, s_39_25, 0, 1, 0},
+{ 10, s_39_26, 0, 1, 0},
+{ 8, s_39_27, 0, 1, 0},
+{ 10, s_39_28, 0, 1, 0},
+{ 2, s_39_29, 0, 1, 0},
+{ 14, s_39_30, -1, 1, 0},
+{ 14, s_39_31, -2, 1, 0},
+{ 6, s_39_32, -3, 1, 0},
+{ 8, s_39_33, -4, 1, 0},
+{ 8, s_39_34, -5, 1, 0},
+{ 16, s_39_35, -1, 1, 0},
+{ 10, s_39_36, -7, 1, 0},
+{ 12, s_39_37, -1, 1, 0},
+{ 2, s_39_38, 0, 1, 0},
+{ 14, s_39_39, -1, 1, 0},
+{ 8, s_39_40, -2, 1, 0},
+{ 12, s_39_41, -3, 1, 0},
+{ 22, s_39_42, -1, 1, 0},
+{ 22, s_39_43, -2, 1, 0},
+{ 22, s_39_44, -3, 1, 0},
+{ 6, s_39_45, -7, 1, 0},
+{ 6, s_39_46, 0, 1, 0},
+{ 8, s_39_47, -1, 1, 0},
+{ 14, s_39_48, -2, 1, 0},
+{ 6, s_39_49, 0, 1, 0},
+{ 8, s_39_50, -1, 1, 0},
+{ 16, s_39_51, -1, 1, 0},
+{ 2, s_39_52, 0, 1, 0},
+{ 10, s_39_53, -1, 1, 0},
+{ 10, s_39_54, -2, 1, 0},
+{ 4, s_39_55, -3, 1, 0},
+{ 8, s_39_56, -1, 1, 0},
+{ 8, s_39_57, -2, 1, 0},
+{ 10, s_39_58, -6, 1, 0},
+{ 12, s_39_59, -1, 1, 0},
+{ 10, s_39_60, -8, 1, 0},
+{ 8, s_39_61, -9, 1, 0},
+{ 8, s_39_62, -10, 1, 0},
+{ 6, s_39_63, -11, 1, 0},
+{ 14, s_39_64, 0, 1, 0},
+{ 2, s_39_65, 0, 1, 0},
+{ 12, s_39_66, -1, 1, 0},
+{ 6, s_39_67, -2, 1, 0},
+{ 8, s_39_68, -1, 1, 0},
+{ 8, s_39_69, 0, 1, 0},
+{ 12, s_39_70, 0, 1, 0},
+{ 6, s_39_71, 0, 1, 0},
+{ 10, s_39_72, 0, 1, 0},
+{ 4, s_39_73, 0, 1, 0},
+{ 8, s_39_74, -1, 1, 0},
+{ 10, s_39_75, 0, 1, 0},
+{ 4, s_39_76, 0, 1, 0},
+{ 8, s_39_77, -1, 1, 0},
+{ 12, s_39_78, -2, 1, 0},
+{ 10, s_39_79, -3, 1, 0},
+{ 6, s_39_80, 0, 1, 0},
+{ 6, s_39_81, 0, 1, 0},
+{ 14, s_39_82, -1, 1, 0},
+{ 14, s_39_83, -2, 1, 0},
+{ 12, s_39_84, -3, 1, 0},
+{ 12, s_39_85, 0, 1, 0},
+{ 6, s_39_86, 0, 1, 0},
+{ 12, s_39_87, 0, 1, 0},
+{ 2, s_39_88, 0, 1, 0},
+{ 14, s_39_89, -1, 1, 0},
+{ 10, s_39_90, -2, 1, 0},
+{ 16, s_39_91, -3, 1, 0},
+{ 16, s_39_92, -4, 1, 0},
+{ 2, s_39_93, 0, 1, 0},
+{ 16, s_39_94, -1, 1, 0}
+};
+
+static const symbol s_40_0[6] = { 0xCF, 0x80, 0xCF, 0x85, 0xCF, 0x81 };
+static const symbol s_40_1[6] = { 0xCE, 0xB5, 0xCF, 0x85, 0xCF, 0x81 };
+static const symbol s_40_2[6] = { 0xCF, 0x87, 0xCF, 0x89, 0xCF, 0x81 };
+static const symbol s_40_3[6] = { 0xCE, 0xB2, 0xCE, 0xB1, 0xCF, 0x81 };
+static const symbol s_40_4[4] = { 0xCE, 0xB2, 0xCF, 0x81 };
+static const symbol s_40_5[6] = { 0xCE, 0xB1, 0xCE, 0xB9, 0xCF, 0x81 };
+static const symbol s_40_6[6] = { 0xCF, 0x86, 0xCE, 0xBF, 0xCF, 0x81 };
+static const symbol s_40_7[6] = { 0xCE, 0xBD, 0xCE, 0xB5, 0xCF, 0x84 };
+static const symbol s_40_8[4] = { 0xCF, 0x83, 0xCF, 0x87 };
+static const symbol s_40_9[8] = { 0xCF, 0x83, 0xCF, 0x85, 0xCE, 0xBD, 0xCE, 0xB4 };
+static const symbol s_40_10[6] = { 0xCE, 0xB5, 0xCE, 0xBD, 0xCE, 0xB4 };
+static const symbol s_40_11[4] = { 0xCE, 0xBF, 0xCE, 0xB4 };
+static const symbol s_40_12[10] = { 0xCF, 0x85, 0xCF, 0x80, 0xCE, 0xB5, 0xCF, 0x81, 0xCE, 0xB8 };
+static const symbol s_40_13[4] = { 0xCF, 0x83, 0xCE, 0xB8 };
+static const symbol s_40_14[6] = { 0xCE, 0xB5, 0xCF, 0x85, 0xCE, 0xB8 };
+static const symbol s_40_15[6] = { 0xCF, 0x81, 0xCE, 0xB1, 0xCE, 0xB8 };
+static const symbol s_40_16[6] = { 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xB8 };
+static const symbol s_40_17[8] = { 0xCE, 0xB4, 0xCE, 0xB9, 0xCE, 0xB1, 0xCE, 0xB8 };
+static const symbol s_40_18[6] = { 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xB8 };
+static const symbol s_40_19[6] = { 0xCF, 0x84, 0xCE, 0xB9, 0xCE, 0xB8 };
+static const symbol s_40_20[6] = { 0xCE, 0xB5, 0xCE, 0xBA, 0xCE, 0xB8 };
+static const symbol s_40_21[8] = { 0xCF, 0x83, 0xCF, 0x85, 0xCE, 0xBD, 0xCE, 0xB8 };
+static const symbol s_40_22[6] = { 0xCE, 0xB5, 0xCE, 0xBD, 0xCE, 0xB8 };
+static const symbol s_40_23[6] = { 0xCF, 0x81, 0xCE, 0xBF, 0xCE, 0xB8 };
+static const symbol s_40_24[6] = { 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xBA };
+static const symbol s_40_25[8] = { 0xCF, 0x89, 0xCF, 0x86, 0xCE, 0xB5, 0xCE, 0xBB };
+static const symbol s_40_26[6] = { 0xCE, 0xB2, 0xCE, 0xBF, 0xCE, 0xBB };
+static const symbol s_40_27[6] = { 0xCF, 0x83, 0xCF, 0x85, 0xCE, 0xBD };
+static const symbol s_40_28[6] = { 0xCE, 0xB1, 0xCE, 0xB9, 0xCE, 0xBD };
+static const symbol s_40_29[6] = { 0xCF, 0x80, 0xCE, 0xBF, 0xCE, 0xBD };
+static const symbol s_40_30[6] = { 0xCF, 0x81, 0xCE, 0xBF, 0xCE, 0xBD };
+static const struct among a_40[31] = {
+{ 6, s_40_0, 0, 1, 0},
+{ 6, s_40_1, 0, 1, 0},
+{ 6, s_40_2, 0, 1, 0},
+{ 6, s_40_3, 0, 1, 0},
+{ 4, s_40_4, 0, 1, 0},
+{ 6, s_40_5, 0, 1, 0},
+{ 6, s_40_6, 0, 1, 0},
+{ 6, s_40_7, 0, 1, 0},
+{ 4, s_40_8, 0, 1, 0},
+{ 8, s_40_9, 0, 1, 0},
+{ 6, s_40_10, 0, 1, 0},
+{ 4, s_40_11, 0, 1, 0},
+{ 10, s_40_12, 0, 1, 0},
+{ 4, s_40_13, 0, 1, 0},
+{ 6, s_40_14, 0, 1, 0},
+{ 6, s_40_15, 0, 1, 0},
+{ 6, s_40_16, 0, 1, 0},
+{ 8, s_40_17, 0, 1, 0},
+{ 6, s_40_18, 0, 1, 0},
+{ 6, s_40_19, 0, 1, 0},
+{ 6, s_40_20, 0, 1, 0},
+{ 8, s_40_21, 0, 1, 0},
+{ 6, s_40_22, 0, 1, 0},
+{ 6, s_40_23, 0, 1, 0},
+{ 6, s_40_24, 0, 1, 0},
+{ 8, s_40_25, 0, 1, 0},
+{ 6, s_40_26, 0, 1, 0},
+{ 6, s_40_27, 0, 1, 0},
+{ 6, s_40_28, 0, 1, 0},
+{ 6, s_40_29, 0, 1, 0},
+{ 6, s_40_30, 0, 1, 0}
+};
+
+static const symbol s_41_0[8] = { 0xCF, 0x83, 0xCE, 0xB5, 0xCF, 0x81, 0xCF, 0x80 };
+static const symbol s_41_1[6] = { 0xCE, 0xBA, 0xCE, 0xBF, 0xCF, 0x80 };
+static const symbol s_41_2[8] = { 0xCE, 0xB8, 0xCE, 0xB1, 0xCF, 0x81, 0xCF, 0x81 };
+static const symbol s_41_3[6] = { 0xCE, 0xBD, 0xCF, 0x84, 0xCF, 0x81 };
+static const symbol s_41_4[8] = { 0xCE, 0xB1, 0xCE, 0xB2, 0xCE, 0xB1, 0xCF, 0x81 };
+static const symbol s_41_5[8] = { 0xCE, 0xB5, 0xCE, 0xBD, 0xCE, 0xB1, 0xCF, 0x81 };
+static const symbol s_41_6[6] = { 0xCE, 0xB1, 0xCE, 0xB2, 0xCF, 0x81 };
+static const symbol s_41_7[8] = { 0xCE, 0xBC, 0xCF, 0x80, 0xCE, 0xBF, 0xCF, 0x81 };
+static const symbol s_41_8[2] = { 0xCF, 0x85 };
+static const symbol s_41_9[8] = { 0xCF, 0x83, 0xCF, 0x85, 0xCF, 0x81, 0xCF, 0x86 };
+static const symbol s_41_10[6] = { 0xCE, 0xBD, 0xCE, 0xB9, 0xCF, 0x86 };
+static const symbol s_41_11[6] = { 0xCF, 0x80, 0xCE, 0xB1, 0xCE, 0xB3 };
+static const symbol s_41_12[2] = { 0xCE, 0xB4 };
+static const symbol s_41_13[4] = { 0xCE, 0xB1, 0xCE, 0xB4 };
+static const symbol s_41_14[2] = { 0xCE, 0xB8 };
+static const symbol s_41_15[4] = { 0xCE, 0xB1, 0xCE, 0xB8 };
+static const symbol s_41_16[4] = { 0xCF, 0x83, 0xCE, 0xBA };
+static const symbol s_41_17[6] = { 0xCF, 0x84, 0xCE, 0xBF, 0xCE, 0xBA };
+static const symbol s_41_18[6] = { 0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xBB };
+static const symbol s_41_19[14] = { 0xCF, 0x80, 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xB1, 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xBB };
+static const symbol s_41_20[8] = { 0xCF, 0x83, 0xCE, 0xBA, 0xCE, 0xB5, 0xCE, 0xBB };
+static const symbol s_41_21[4] = { 0xCE, 0xB5, 0xCE, 0xBC };
+static const symbol s_41_22[4] = { 0xCE, 0xB1, 0xCE, 0xBD };
+static const symbol s_41_23[6] = { 0xCE, 0xB2, 0xCE, 0xB5, 0xCE, 0xBD };
+static const symbol s_41_24[10] = { 0xCE, 0xB2, 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xBF, 0xCE, 0xBD };
+static const struct among a_41[25] = {
+{ 8, s_41_0, 0, 1, 0},
+{ 6, s_41_1, 0, 1, 0},
+{ 8, s_41_2, 0, 1, 0},
+{ 6, s_41_3, 0, 1, 0},
+{ 8, s_41_4, 0, 1, 0},
+{ 8, s_41_5, 0, 1, 0},
+{ 6, s_41_6, 0, 1, 0},
+{ 8, s_41_7, 0, 1, 0},
+{ 2, s_41_8, 0, 1, 0},
+{ 8, s_41_9, 0, 1, 0},
+{ 6, s_41_10, 0, 1, 0},
+{ 6, s_41_11, 0, 1, 0},
+{ 2, s_41_12, 0, 1, 0},
+{ 4, s_41_13, -1, 1, 0},
+{ 2, s_41_14, 0, 1, 0},
+{ 4, s_41_15, -1, 1, 0},
+{ 4, s_41_16, 0, 1, 0},
+{ 6, s_41_17, 0, 1, 0},
+{ 6, s_41_18, 0, 1, 0},
+{ 14, s_41_19, 0, 1, 0},
+{ 8, s_41_20, 0, 1, 0},
+{ 4, s_41_21, 0, 1, 0},
+{ 4, s_41_22, 0, 1, 0},
+{ 6, s_41_23, 0, 1, 0},
+{ 10, s_41_24, 0, 1, 0}
+};
+
+static const symbol s_42_0[10] = { 0xCF, 0x89, 0xCE, 0xBD, 0xCF, 0x84, 0xCE, 0xB1, 0xCF, 0x83 };
+static const symbol s_42_1[10] = { 0xCE, 0xBF, 0xCE, 0xBD, 0xCF, 0x84, 0xCE, 0xB1, 0xCF, 0x83 };
+static const struct among a_42[2] = {
+{ 10, s_42_0, 0, 1, 0},
+{ 10, s_42_1, 0, 1, 0}
+};
+
+static const symbol s_43_0[12] = { 0xCE, 0xBF, 0xCE, 0xBC, 0xCE, 0xB1, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB5 };
+static const symbol s_43_1[14] = { 0xCE, 0xB9, 0xCE, 0xBF, 0xCE, 0xBC, 0xCE, 0xB1, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB5 };
+static const struct among a_43[2] = {
+{ 12, s_43_0, 0, 1, 0},
+{ 14, s_43_1, -1, 1, 0}
+};
+
+static const symbol s_44_0[2] = { 0xCF, 0x80 };
+static const symbol s_44_1[4] = { 0xCE, 0xB1, 0xCF, 0x80 };
+static const symbol s_44_2[12] = { 0xCE, 0xB1, 0xCE, 0xBA, 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xB1, 0xCF, 0x80 };
+static const symbol s_44_3[8] = { 0xCF, 0x83, 0xCF, 0x85, 0xCE, 0xBC, 0xCF, 0x80 };
+static const symbol s_44_4[10] = { 0xCE, 0xB1, 0xCF, 0x83, 0xCF, 0x85, 0xCE, 0xBC, 0xCF, 0x80 };
+static const symbol s_44_5[14] = { 0xCE, 0xB1, 0xCE, 0xBC, 0xCE, 0xB5, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xBC, 0xCF, 0x86 };
+static const struct among a_44[6] = {
+{ 2, s_44_0, 0, 1, 0},
+{ 4, s_44_1, -1, 1, 0},
+{ 12, s_44_2, -1, 1, 0},
+{ 8, s_44_3, -3, 1, 0},
+{ 10, s_44_4, -1, 1, 0},
+{ 14, s_44_5, 0, 1, 0}
+};
+
+static const symbol s_45_0[4] = { 0xCE, 0xB1, 0xCF, 0x81 };
+static const symbol s_45_1[6] = { 0xCE, 0xBD, 0xCE, 0xB9, 0xCF, 0x83 };
+static const symbol s_45_2[2] = { 0xCE, 0xB6 };
+static const symbol s_45_3[4] = { 0xCE, 0xB1, 0xCE, 0xBB };
+static const symbol s_45_4[14] = { 0xCF, 0x80, 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xB1, 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xBB };
+static const symbol s_45_5[10] = { 0xCE, 0xB5, 0xCE, 0xBA, 0xCF, 0x84, 0xCE, 0xB5, 0xCE, 0xBB };
+static const symbol s_45_6[2] = { 0xCE, 0xBC };
+static const symbol s_45_7[2] = { 0xCE, 0xBE };
+static const symbol s_45_8[6] = { 0xCF, 0x80, 0xCF, 0x81, 0xCE, 0xBF };
+static const struct among a_45[9] = {
+{ 4, s_45_0, 0, 1, 0},
+{ 6, s_45_1, 0, 1, 0},
+{ 2, s_45_2, 0, 1, 0},
+{ 4, s_45_3, 0, 1, 0},
+{ 14, s_45_4, -1, 1, 0},
+{ 10, s_45_5, 0, 1, 0},
+{ 2, s_45_6, 0, 1, 0},
+{ 2, s_45_7, 0, 1, 0},
+{ 6, s_45_8, 0, 1, 0}
+};
+
+static const symbol s_46_0[12] = { 0xCE, 0xB7, 0xCE, 0xB8, 0xCE, 0xB7, 0xCE, 0xBA, 0xCE, 0xB5, 0xCF, 0x83 };
+static const symbol s_46_1[10] = { 0xCE, 0xB7, 0xCE, 0xB8, 0xCE, 0xB7, 0xCE, 0xBA, 0xCE, 0xB1 };
+static const symbol s_46_2[10] = { 0xCE, 0xB7, 0xCE, 0xB8, 0xCE, 0xB7, 0xCE, 0xBA, 0xCE, 0xB5 };
+static const struct among a_46[3] = {
+{ 12, s_46_0, 0, 1, 0},
+{ 10, s_46_1, 0, 1, 0},
+{ 10, s_46_2, 0, 1, 0}
+};
+
+static const symbol s_47_0[4] = { 0xCF, 0x83, 0xCF, 0x86 };
+static const symbol s_47_1[8] = { 0xCE, 0xBD, 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xB8 };
+static const symbol s_47_2[6] = { 0xCF, 0x80, 0xCE, 0xB9, 0xCE, 0xB8 };
+static const symbol s_47_3[4] = { 0xCE, 0xBF, 0xCE, 0xB8 };
+static const symbol s_47_4[10] = { 0xCF, 0x83, 0xCE, 0xBA, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBB };
+static const symbol s_47_5[8] = { 0xCF, 0x83, 0xCE, 0xBA, 0xCF, 0x89, 0xCE, 0xBB };
+static const struct among a_47[6] = {
+{ 4, s_47_0, 0, 1, 0},
+{ 8, s_47_1, 0, 1, 0},
+{ 6, s_47_2, 0, 1, 0},
+{ 4, s_47_3, 0, 1, 0},
+{ 10, s_47_4, 0, 1, 0},
+{ 8, s_47_5, 0, 1, 0}
+};
+
+static const symbol s_48_0[2] = { 0xCE, 0xB8 };
+static const symbol s_48_1[10] = { 0xCF, 0x80, 0xCF, 0x81, 0xCE, 0xBF, 0xCF, 0x83, 0xCE, 0xB8 };
+static const symbol s_48_2[18] = { 0xCF, 0x80, 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xB1, 0xCE, 0xBA, 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xB8 };
+static const symbol s_48_3[8] = { 0xCE, 0xB4, 0xCE, 0xB9, 0xCE, 0xB1, 0xCE, 0xB8 };
+static const symbol s_48_4[8] = { 0xCF, 0x83, 0xCF, 0x85, 0xCE, 0xBD, 0xCE, 0xB8 };
+static const struct among a_48[5] = {
+{ 2, s_48_0, 0, 1, 0},
+{ 10, s_48_1, -1, 1, 0},
+{ 18, s_48_2, -2, 1, 0},
+{ 8, s_48_3, -3, 1, 0},
+{ 8, s_48_4, -4, 1, 0}
+};
+
+static const symbol s_49_0[8] = { 0xCE, 0xB7, 0xCE, 0xBA, 0xCE, 0xB5, 0xCF, 0x83 };
+static const symbol s_49_1[6] = { 0xCE, 0xB7, 0xCE, 0xBA, 0xCE, 0xB1 };
+static const symbol s_49_2[6] = { 0xCE, 0xB7, 0xCE, 0xBA, 0xCE, 0xB5 };
+static const struct among a_49[3] = {
+{ 8, s_49_0, 0, 1, 0},
+{ 6, s_49_1, 0, 1, 0},
+{ 6, s_49_2, 0, 1, 0}
+};
+
+static const symbol s_50_0[8] = { 0xCE, 0xB2, 0xCE, 0xBB, 0xCE, 0xB5, 0xCF, 0x80 };
+static const symbol s_50_1[10] = { 0xCF, 0x80, 0xCE, 0xBF, 0xCE, 0xB4, 0xCE, 0xB1, 0xCF, 0x81 };
+static const symbol s_50_2[8] = { 0xCF, 0x80, 0xCF, 0x81, 0xCF, 0x89, 0xCF, 0x84 };
+static const symbol s_50_3[10] = { 0xCE, 0xBA, 0xCF, 0x85, 0xCE, 0xBC, 0xCE, 0xB1, 0xCF, 0x84 };
+static const symbol s_50_4[12] = { 0xCF, 0x80, 0xCE, 0xB1, 0xCE, 0xBD, 0xCF, 0x84, 0xCE, 0xB1, 0xCF, 0x87 };
+static const symbol s_50_5[6] = { 0xCE, 0xBB, 0xCE, 0xB1, 0xCF, 0x87 };
+static const symbol s_50_6[6] = { 0xCF, 0x86, 0xCE, 0xB1, 0xCE, 0xB3 };
+static const symbol s_50_7[6] = { 0xCE, 0xBB, 0xCE, 0xB7, 0xCE, 0xB3 };
+static const symbol s_50_8[8] = { 0xCF, 0x86, 0xCF, 0x81, 0xCF, 0x85, 0xCE, 0xB4 };
+static const symbol s_50_9[12] = { 0xCE, 0xBC, 0xCE, 0xB1, 0xCE, 0xBD, 0xCF, 0x84, 0xCE, 0xB9, 0xCE, 0xBB };
+static const symbol s_50_10[8] = { 0xCE, 0xBC, 0xCE, 0xB1, 0xCE, 0xBB, 0xCE, 0xBB };
+static const symbol s_50_11[4] = { 0xCE, 0xBF, 0xCE, 0xBC };
+static const struct among a_50[12] = {
+{ 8, s_50_0, 0, 1, 0},
+{ 10, s_50_1, 0, 1, 0},
+{ 8, s_50_2, 0, 1, 0},
+{ 10, s_50_3, 0, 1, 0},
+{ 12, s_50_4, 0, 1, 0},
+{ 6, s_50_5, 0, 1, 0},
+{ 6, s_50_6, 0, 1, 0},
+{ 6, s_50_7, 0, 1, 0},
+{ 8, s_50_8, 0, 1, 0},
+{ 12, s_50_9, 0, 1, 0},
+{ 8, s_50_10, 0, 1, 0},
+{ 4, s_50_11, 0, 1, 0}
+};
+
+static const symbol s_51_0[10] = { 0xCE, 0xB5, 0xCE, 0xBA, 0xCE, 0xBB, 0xCE, 0xB9, 0xCF, 0x80 };
+static const symbol s_51_1[2] = { 0xCF, 0x81 };
+static const symbol s_51_2[10] = { 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB1, 0xCF, 0x81, 0xCF, 0x81 };
+static const symbol s_51_3[16] = { 0xCE, 0xB5, 0xCE, 0xBD, 0xCE, 0xB4, 0xCE, 0xB9, 0xCE, 0xB1, 0xCF, 0x86, 0xCE, 0xB5, 0xCF, 0x81 };
+static const symbol s_51_4[6] = { 0xCF, 0x80, 0xCE, 0xB1, 0xCF, 0x84 };
+static const symbol s_51_5[14] = { 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xB8, 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xB5, 0xCF, 0x85 };
+static const symbol s_51_6[16] = { 0xCE, 0xB4, 0xCE, 0xB5, 0xCF, 0x85, 0xCF, 0x84, 0xCE, 0xB5, 0xCF, 0x81, 0xCE, 0xB5, 0xCF, 0x85 };
+static const symbol s_51_7[6] = { 0xCE, 0xBB, 0xCE, 0xB5, 0xCF, 0x87 };
+static const symbol s_51_8[6] = { 0xCF, 0x84, 0xCF, 0x83, 0xCE, 0xB1 };
+static const symbol s_51_9[6] = { 0xCF, 0x87, 0xCE, 0xB1, 0xCE, 0xB4 };
+static const symbol s_51_10[6] = { 0xCE, 0xBC, 0xCE, 0xB5, 0xCE, 0xB4 };
+static const symbol s_51_11[12] = { 0xCE, 0xBB, 0xCE, 0xB1, 0xCE, 0xBC, 0xCF, 0x80, 0xCE, 0xB9, 0xCE, 0xB4 };
+static const symbol s_51_12[4] = { 0xCE, 0xB4, 0xCE, 0xB5 };
+static const symbol s_51_13[6] = { 0xCF, 0x80, 0xCE, 0xBB, 0xCE, 0xB5 };
+static const symbol s_51_14[10] = { 0xCE, 0xBC, 0xCE, 0xB5, 0xCF, 0x83, 0xCE, 0xB1, 0xCE, 0xB6 };
+static const symbol s_51_15[12] = { 0xCE, 0xB4, 0xCE, 0xB5, 0xCF, 0x83, 0xCF, 0x80, 0xCE, 0xBF, 0xCE, 0xB6 };
+static const symbol s_51_16[6] = { 0xCE, 0xB1, 0xCE, 0xB9, 0xCE, 0xB8 };
+static const symbol s_51_17[12] = { 0xCF, 0x86, 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xBC, 0xCE, 0xB1, 0xCE, 0xBA };
+static const symbol s_51_18[6] = { 0xCE, 0xB1, 0xCE, 0xB3, 0xCE, 0xBA };
+static const symbol s_51_19[8] = { 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB7, 0xCE, 0xBA };
+static const symbol s_51_20[2] = { 0xCE, 0xBB };
+static const symbol s_51_21[2] = { 0xCE, 0xBC };
+static const symbol s_51_22[4] = { 0xCE, 0xB1, 0xCE, 0xBC };
+static const symbol s_51_23[8] = { 0xCE, 0xB2, 0xCF, 0x81, 0xCE, 0xBF, 0xCE, 0xBC };
+static const symbol s_51_24[14] = { 0xCF, 0x85, 0xCF, 0x80, 0xCE, 0xBF, 0xCF, 0x84, 0xCE, 0xB5, 0xCE, 0xB9, 0xCE, 0xBD };
+static const struct among a_51[25] = {
+{ 10, s_51_0, 0, 1, 0},
+{ 2, s_51_1, 0, 1, 0},
+{ 10, s_51_2, -1, 1, 0},
+{ 16, s_51_3, -2, 1, 0},
+{ 6, s_51_4, 0, 1, 0},
+{ 14, s_51_5, 0, 1, 0},
+{ 16, s_51_6, 0, 1, 0},
+{ 6, s_51_7, 0, 1, 0},
+{ 6, s_51_8, 0, 1, 0},
+{ 6, s_51_9, 0, 1, 0},
+{ 6, s_51_10, 0, 1, 0},
+{ 12, s_51_11, 0, 1, 0},
+{ 4, s_51_12, 0, 1, 0},
+{ 6, s_51_13, 0, 1, 0},
+{ 10, s_51_14, 0, 1, 0},
+{ 12, s_51_15, 0, 1, 0},
+{ 6, s_51_16, 0, 1, 0},
+{ 12, s_51_17, 0, 1, 0},
+{ 6, s_51_18, 0, 1, 0},
+{ 8, s_51_19, 0, 1, 0},
+{ 2, s_51_20, 0, 1, 0},
+{ 2, s_51_21, 0, 1, 0},
+{ 4, s_51_22, -1, 1, 0},
+{ 8, s_51_23, -2, 1, 0},
+{ 14, s_51_24, 0, 1, 0}
+};
+
+static const symbol s_52_0[10] = { 0xCE, 0xBF, 0xCF, 0x85, 0xCF, 0x83, 0xCE, 0xB5, 0xCF, 0x83 };
+static const symbol s_52_1[8] = { 0xCE, 0xBF, 0xCF, 0x85, 0xCF, 0x83, 0xCE, 0xB1 };
+static const symbol s_52_2[8] = { 0xCE, 0xBF, 0xCF, 0x85, 0xCF, 0x83, 0xCE, 0xB5 };
+static const struct among a_52[3] = {
+{ 10, s_52_0, 0, 1, 0},
+{ 8, s_52_1, 0, 1, 0},
+{ 8, s_52_2, 0, 1, 0}
+};
+
+static const symbol s_53_0[4] = { 0xCF, 0x81, 0xCF, 0x80 };
+static const symbol s_53_1[4] = { 0xCF, 0x80, 0xCF, 0x81 };
+static const symbol s_53_2[4] = { 0xCF, 0x86, 0xCF, 0x81 };
+static const symbol s_53_3[8] = { 0xCF, 0x87, 0xCE, 0xBF, 0xCF, 0x81, 0xCF, 0x84 };
+static const symbol s_53_4[4] = { 0xCF, 0x83, 0xCF, 0x86 };
+static const symbol s_53_5[4] = { 0xCE, 0xBF, 0xCF, 0x86 };
+static const symbol s_53_6[6] = { 0xCF, 0x88, 0xCE, 0xBF, 0xCF, 0x86 };
+static const symbol s_53_7[6] = { 0xCE, 0xBB, 0xCE, 0xBF, 0xCF, 0x87 };
+static const symbol s_53_8[12] = { 0xCE, 0xBD, 0xCE, 0xB1, 0xCF, 0x85, 0xCE, 0xBB, 0xCE, 0xBF, 0xCF, 0x87 };
+static const symbol s_53_9[6] = { 0xCF, 0x80, 0xCE, 0xB5, 0xCE, 0xBB };
+static const symbol s_53_10[4] = { 0xCE, 0xBB, 0xCE, 0xBB };
+static const symbol s_53_11[8] = { 0xCF, 0x83, 0xCE, 0xBC, 0xCE, 0xB7, 0xCE, 0xBD };
+static const struct among a_53[12] = {
+{ 4, s_53_0, 0, 1, 0},
+{ 4, s_53_1, 0, 1, 0},
+{ 4, s_53_2, 0, 1, 0},
+{ 8, s_53_3, 0, 1, 0},
+{ 4, s_53_4, 0, 1, 0},
+{ 4, s_53_5, 0, 1, 0},
+{ 6, s_53_6, -1, -1, 0},
+{ 6, s_53_7, 0, 1, 0},
+{ 12, s_53_8, -1, -1, 0},
+{ 6, s_53_9, 0, 1, 0},
+{ 4, s_53_10, 0, 1, 0},
+{ 8, s_53_11, 0, 1, 0}
+};
+
+static const symbol s_54_0[2] = { 0xCF, 0x80 };
+static const symbol s_54_1[6] = { 0xCE, 0xB1, 0xCF, 0x83, 0xCF, 0x80 };
+static const symbol s_54_2[8] = { 0xCE, 0xB1, 0xCE, 0xBD, 0xCF, 0x85, 0xCF, 0x80 };
+static const symbol s_54_3[10] = { 0xCE, 0xB1, 0xCF, 0x81, 0xCF, 0x84, 0xCE, 0xB9, 0xCF, 0x80 };
+static const symbol s_54_4[8] = { 0xCE, 0xB1, 0xCE, 0xB5, 0xCE, 0xB9, 0xCF, 0x80 };
+static const symbol s_54_5[8] = { 0xCF, 0x83, 0xCF, 0x85, 0xCE, 0xBC, 0xCF, 0x80 };
+static const symbol s_54_6[16] = { 0xCF, 0x80, 0xCF, 0x81, 0xCE, 0xBF, 0xCF, 0x83, 0xCF, 0x89, 0xCF, 0x80, 0xCE, 0xBF, 0xCF, 0x80 };
+static const symbol s_54_7[14] = { 0xCF, 0x83, 0xCE, 0xB9, 0xCE, 0xB4, 0xCE, 0xB7, 0xCF, 0x81, 0xCE, 0xBF, 0xCF, 0x80 };
+static const symbol s_54_8[12] = { 0xCE, 0xB4, 0xCF, 0x81, 0xCE, 0xBF, 0xCF, 0x83, 0xCE, 0xBF, 0xCF, 0x80 };
+static const symbol s_54_9[8] = { 0xCE, 0xBD, 0xCE, 0xB5, 0xCE, 0xBF, 0xCF, 0x80 };
+static const symbol s_54_10[16] = { 0xCE, 0xBA, 0xCF, 0x81, 0xCE, 0xBF, 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xBB, 0xCE, 0xBF, 0xCF, 0x80 };
+static const symbol s_54_11[8] = { 0xCE, 0xBF, 0xCE, 0xBB, 0xCE, 0xBF, 0xCF, 0x80 };
+static const symbol s_54_12[2] = { 0xCF, 0x81 };
+static const symbol s_54_13[4] = { 0xCF, 0x84, 0xCF, 0x81 };
+static const symbol s_54_14[6] = { 0xCE, 0xBF, 0xCF, 0x85, 0xCF, 0x81 };
+static const symbol s_54_15[10] = { 0xCE, 0xB1, 0xCF, 0x83, 0xCF, 0x80, 0xCE, 0xB1, 0xCF, 0x81 };
+static const symbol s_54_16[6] = { 0xCF, 0x87, 0xCE, 0xB1, 0xCF, 0x81 };
+static const symbol s_54_17[8] = { 0xCE, 0xB1, 0xCF, 0x87, 0xCE, 0xB1, 0xCF, 0x81 };
+static const symbol s_54_18[8] = { 0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xB5, 0xCF, 0x81 };
+static const symbol s_54_19[2] = { 0xCF, 0x84 };
+static const symbol s_54_20[10] = { 0xCE, 0xB1, 0xCE, 0xBD, 0xCF, 0x85, 0xCF, 0x83, 0xCF, 0x84 };
+static const symbol s_54_21[10] = { 0xCE, 0xB1, 0xCE, 0xB2, 0xCE, 0xB1, 0xCF, 0x83, 0xCF, 0x84 };
+static const symbol s_54_22[10] = { 0xCF, 0x80, 0xCF, 0x81, 0xCE, 0xBF, 0xCF, 0x83, 0xCF, 0x84 };
+static const symbol s_54_23[12] = { 0xCE, 0xB1, 0xCE, 0xB9, 0xCE, 0xBC, 0xCE, 0xBF, 0xCF, 0x83, 0xCF, 0x84 };
+static const symbol s_54_24[8] = { 0xCE, 0xB4, 0xCE, 0xB9, 0xCE, 0xB1, 0xCF, 0x84 };
+static const symbol s_54_25[8] = { 0xCE, 0xB5, 0xCF, 0x80, 0xCE, 0xB9, 0xCF, 0x84 };
+static const symbol s_54_26[8] = { 0xCF, 0x83, 0xCF, 0x85, 0xCE, 0xBD, 0xCF, 0x84 };
+static const symbol s_54_27[8] = { 0xCF, 0x85, 0xCF, 0x80, 0xCE, 0xBF, 0xCF, 0x84 };
+static const symbol s_54_28[8] = { 0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xBF, 0xCF, 0x84 };
+static const symbol s_54_29[8] = { 0xCE, 0xBF, 0xCE, 0xBC, 0xCE, 0xBF, 0xCF, 0x84 };
+static const symbol s_54_30[10] = { 0xCE, 0xBD, 0xCE, 0xBF, 0xCE, 0xBC, 0xCE, 0xBF, 0xCF, 0x84 };
+static const symbol s_54_31[6] = { 0xCE, 0xBD, 0xCE, 0xB1, 0xCF, 0x85 };
+static const symbol s_54_32[10] = { 0xCF, 0x80, 0xCE, 0xBF, 0xCE, 0xBB, 0xCF, 0x85, 0xCF, 0x86 };
+static const symbol s_54_33[4] = { 0xCE, 0xB1, 0xCF, 0x86 };
+static const symbol s_54_34[6] = { 0xCE, 0xBE, 0xCE, 0xB5, 0xCF, 0x86 };
+static const symbol s_54_35[8] = { 0xCE, 0xB1, 0xCE, 0xB4, 0xCE, 0xB7, 0xCF, 0x86 };
+static const symbol s_54_36[8] = { 0xCF, 0x80, 0xCE, 0xB1, 0xCE, 0xBC, 0xCF, 0x86 };
+static const symbol s_54_37[12] = { 0xCE, 0xB1, 0xCE, 0xBC, 0xCE, 0xB1, 0xCE, 0xBB, 0xCE, 0xBB, 0xCE, 0xB9 };
+static const symbol s_54_38[2] = { 0xCE, 0xBB };
+static const symbol s_54_39[8] = { 0xCE, 0xB1, 0xCE, 0xBC, 0xCE, 0xB1, 0xCE, 0xBB };
+static const symbol s_54_40[2] = { 0xCE, 0xBC };
+static const symbol s_54_41[10] = { 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBB, 0xCE, 0xB1, 0xCE, 0xBC };
+static const symbol s_54_42[4] = { 0xCE, 0xB5, 0xCE, 0xBD };
+static const symbol s_54_43[12] = { 0xCE, 0xB4, 0xCE, 0xB5, 0xCF, 0x81, 0xCE, 0xB2, 0xCE, 0xB5, 0xCE, 0xBD };
+static const struct among a_54[44] = {
+{ 2, s_54_0, 0, 1, 0},
+{ 6, s_54_1, -1, 1, 0},
+{ 8, s_54_2, -2, 1, 0},
+{ 10, s_54_3, -3, 1, 0},
+{ 8, s_54_4, -4, 1, 0},
+{ 8, s_54_5, -5, 1, 0},
+{ 16, s_54_6, -6, 1, 0},
+{ 14, s_54_7, -7, 1, 0},
+{ 12, s_54_8, -8, 1, 0},
+{ 8, s_54_9, -9, 1, 0},
+{ 16, s_54_10, -10, 1, 0},
+{ 8, s_54_11, -11, 1, 0},
+{ 2, s_54_12, 0, 1, 0},
+{ 4, s_54_13, -1, 1, 0},
+{ 6, s_54_14, -2, 1, 0},
+{ 10, s_54_15, -3, 1, 0},
+{ 6, s_54_16, -4, 1, 0},
+{ 8, s_54_17, -1, 1, 0},
+{ 8, s_54_18, -6, 1, 0},
+{ 2, s_54_19, 0, 1, 0},
+{ 10, s_54_20, -1, 1, 0},
+{ 10, s_54_21, -2, 1, 0},
+{ 10, s_54_22, -3, 1, 0},
+{ 12, s_54_23, -4, 1, 0},
+{ 8, s_54_24, -5, 1, 0},
+{ 8, s_54_25, -6, 1, 0},
+{ 8, s_54_26, -7, 1, 0},
+{ 8, s_54_27, -8, 1, 0},
+{ 8, s_54_28, -9, 1, 0},
+{ 8, s_54_29, -10, 1, 0},
+{ 10, s_54_30, -1, 1, 0},
+{ 6, s_54_31, 0, 1, 0},
+{ 10, s_54_32, 0, 1, 0},
+{ 4, s_54_33, 0, 1, 0},
+{ 6, s_54_34, 0, 1, 0},
+{ 8, s_54_35, 0, 1, 0},
+{ 8, s_54_36, 0, 1, 0},
+{ 12, s_54_37, 0, 1, 0},
+{ 2, s_54_38, 0, 1, 0},
+{ 8, s_54_39, -1, 1, 0},
+{ 2, s_54_40, 0, 1, 0},
+{ 10, s_54_41, -1, 1, 0},
+{ 4, s_54_42, 0, 1, 0},
+{ 12, s_54_43, -1, 1, 0}
+};
+
+static const symbol s_55_0[8] = { 0xCE, 0xB1, 0xCE, 0xB3, 0xCE, 0xB5, 0xCF, 0x83 };
+static const symbol s_55_1[6] = { 0xCE, 0xB1, 0xCE, 0xB3, 0xCE, 0xB1 };
+static const symbol s_55_2[6] = { 0xCE, 0xB1, 0xCE, 0xB3, 0xCE, 0xB5 };
+static const struct among a_55[3] = {
+{ 8, s_55_0, 0, 1, 0},
+{ 6, s_55_1, 0, 1, 0},
+{ 6, s_55_2, 0, 1, 0}
+};
+
+static const symbol s_56_0[8] = { 0xCE, 0xB7, 0xCF, 0x83, 0xCE, 0xBF, 0xCF, 0x85 };
+static const symbol s_56_1[6] = { 0xCE, 0xB7, 0xCF, 0x83, 0xCE, 0xB1 };
+static const symbol s_56_2[6] = { 0xCE, 0xB7, 0xCF, 0x83, 0xCE, 0xB5 };
+static const struct among a_56[3] = {
+{ 8, s_56_0, 0, 1, 0},
+{ 6, s_56_1, 0, 1, 0},
+{ 6, s_56_2, 0, 1, 0}
+};
+
+static const symbol s_57_0[2] = { 0xCE, 0xBD };
+static const symbol s_57_1[10] = { 0xCE, 0xB5, 0xCF, 0x80, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xBD };
+static const symbol s_57_2[14] = { 0xCE, 0xB4, 0xCF, 0x89, 0xCE, 0xB4, 0xCE, 0xB5, 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xBD };
+static const symbol s_57_3[12] = { 0xCF, 0x87, 0xCE, 0xB5, 0xCF, 0x81, 0xCF, 0x83, 0xCE, 0xBF, 0xCE, 0xBD };
+static const symbol s_57_4[14] = { 0xCE, 0xBC, 0xCE, 0xB5, 0xCE, 0xB3, 0xCE, 0xB1, 0xCE, 0xBB, 0xCE, 0xBF, 0xCE, 0xBD };
+static const symbol s_57_5[12] = { 0xCE, 0xB5, 0xCF, 0x81, 0xCE, 0xB7, 0xCE, 0xBC, 0xCE, 0xBF, 0xCE, 0xBD };
+static const struct among a_57[6] = {
+{ 2, s_57_0, 0, 1, 0},
+{ 10, s_57_1, -1, 1, 0},
+{ 14, s_57_2, -2, 1, 0},
+{ 12, s_57_3, -3, 1, 0},
+{ 14, s_57_4, -4, 1, 0},
+{ 12, s_57_5, -5, 1, 0}
+};
+
+static const symbol s_58_0[4] = { 0xCF, 0x87, 0xCF, 0x81 };
+static const symbol s_58_1[10] = { 0xCE, 0xB4, 0xCF, 0x85, 0xCF, 0x83, 0xCF, 0x87, 0xCF, 0x81 };
+static const symbol s_58_2[8] = { 0xCE, 0xB5, 0xCF, 0x85, 0xCF, 0x87, 0xCF, 0x81 };
+static const symbol s_58_3[6] = { 0xCE, 0xB1, 0xCF, 0x87, 0xCF, 0x81 };
+static const symbol s_58_4[14] = { 0xCE, 0xBA, 0xCE, 0xBF, 0xCE, 0xB9, 0xCE, 0xBD, 0xCE, 0xBF, 0xCF, 0x87, 0xCF, 0x81 };
+static const symbol s_58_5[12] = { 0xCF, 0x80, 0xCE, 0xB1, 0xCE, 0xBB, 0xCE, 0xB9, 0xCE, 0xBC, 0xCF, 0x88 };
+static const symbol s_58_6[4] = { 0xCF, 0x83, 0xCE, 0xB2 };
+static const symbol s_58_7[6] = { 0xCE, 0xB1, 0xCF, 0x83, 0xCE, 0xB2 };
+static const symbol s_58_8[6] = { 0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xBB };
+static const symbol s_58_9[10] = { 0xCE, 0xB1, 0xCE, 0xB5, 0xCE, 0xB9, 0xCE, 0xBC, 0xCE, 0xBD };
+static const struct among a_58[10] = {
+{ 4, s_58_0, 0, 1, 0},
+{ 10, s_58_1, -1, 1, 0},
+{ 8, s_58_2, -2, 1, 0},
+{ 6, s_58_3, -3, 1, 0},
+{ 14, s_58_4, -4, 1, 0},
+{ 12, s_58_5, 0, 1, 0},
+{ 4, s_58_6, 0, 1, 0},
+{ 6, s_58_7, -1, 1, 0},
+{ 6, s_58_8, 0, 1, 0},
+{ 10, s_58_9, 0, 1, 0}
+};
+
+static const symbol s_59_0[8] = { 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBD, 0xCE, 0xB5 };
+static const symbol s_59_1[12] = { 0xCE, 0xB7, 0xCF, 0x83, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBD, 0xCE, 0xB5 };
+static const symbol s_59_2[12] = { 0xCE, 0xB7, 0xCE, 0xB8, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBD, 0xCE, 0xB5 };
+static const struct among a_59[3] = {
+{ 8, s_59_0, 0, 1, 0},
+{ 12, s_59_1, -1, 1, 0},
+{ 12, s_59_2, -2, 1, 0}
+};
+
+static const symbol s_60_0[2] = { 0xCF, 0x81 };
+static const symbol s_60_1[22] = { 0xCF, 0x83, 0xCF, 0x84, 0xCF, 0x81, 0xCE, 0xB1, 0xCE, 0xB2, 0xCE, 0xBF, 0xCE, 0xBC, 0xCE, 0xBF, 0xCF, 0x85, 0xCF, 0x84, 0xCF, 0x83 };
+static const symbol s_60_2[18] = { 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xBA, 0xCE, 0xBF, 0xCE, 0xBC, 0xCE, 0xBF, 0xCF, 0x85, 0xCF, 0x84, 0xCF, 0x83 };
+static const symbol s_60_3[6] = { 0xCF, 0x83, 0xCF, 0x80, 0xCE, 0xB9 };
+static const symbol s_60_4[2] = { 0xCE, 0xBD };
+static const symbol s_60_5[8] = { 0xCE, 0xB5, 0xCE, 0xBE, 0xCF, 0x89, 0xCE, 0xBD };
+static const struct among a_60[6] = {
+{ 2, s_60_0, 0, 1, 0},
+{ 22, s_60_1, 0, 1, 0},
+{ 18, s_60_2, 0, 1, 0},
+{ 6, s_60_3, 0, 1, 0},
+{ 2, s_60_4, 0, 1, 0},
+{ 8, s_60_5, -1, 1, 0}
+};
+
+static const symbol s_61_0[8] = { 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBC, 0xCE, 0xB5 };
+static const symbol s_61_1[12] = { 0xCE, 0xB7, 0xCF, 0x83, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBC, 0xCE, 0xB5 };
+static const symbol s_61_2[12] = { 0xCE, 0xB7, 0xCE, 0xB8, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBC, 0xCE, 0xB5 };
+static const struct among a_61[3] = {
+{ 8, s_61_0, 0, 1, 0},
+{ 12, s_61_1, -1, 1, 0},
+{ 12, s_61_2, -2, 1, 0}
+};
+
+static const symbol s_62_0[10] = { 0xCE, 0xB1, 0xCF, 0x83, 0xCE, 0xBF, 0xCF, 0x85, 0xCF, 0x83 };
+static const symbol s_62_1[16] = { 0xCF, 0x80, 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xB1, 0xCF, 0x83, 0xCE, 0xBF, 0xCF, 0x85, 0xCF, 0x83 };
+static const symbol s_62_2[16] = { 0xCE, 0xB1, 0xCE, 0xBB, 0xCE, 0xBB, 0xCE, 0xBF, 0xCF, 0x83, 0xCE, 0xBF, 0xCF, 0x85, 0xCF, 0x83 };
+static const symbol s_62_3[2] = { 0xCF, 0x86 };
+static const symbol s_62_4[2] = { 0xCF, 0x87 };
+static const symbol s_62_5[4] = { 0xCE, 0xB1, 0xCE, 0xB6 };
+static const symbol s_62_6[12] = { 0xCF, 0x89, 0xCF, 0x81, 0xCE, 0xB9, 0xCE, 0xBF, 0xCF, 0x80, 0xCE, 0xBB };
+static const struct among a_62[7] = {
+{ 10, s_62_0, 0, 1, 0},
+{ 16, s_62_1, -1, 1, 0},
+{ 16, s_62_2, 0, 1, 0},
+{ 2, s_62_3, 0, 1, 0},
+{ 2, s_62_4, 0, 1, 0},
+{ 4, s_62_5, 0, 1, 0},
+{ 12, s_62_6, 0, 1, 0}
+};
+
+static const symbol s_63_0[10] = { 0xCE, 0xBC, 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xBF, 0xCF, 0x83 };
+static const symbol s_63_1[8] = { 0xCE, 0xBC, 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xB1 };
+static const symbol s_63_2[10] = { 0xCE, 0xBC, 0xCE, 0xB1, 0xCF, 0x84, 0xCF, 0x89, 0xCE, 0xBD };
+static const struct among a_63[3] = {
+{ 10, s_63_0, 0, 1, 0},
+{ 8, s_63_1, 0, 1, 0},
+{ 10, s_63_2, 0, 1, 0}
+};
+
+static const symbol s_64_0[4] = { 0xCF, 0x85, 0xCF, 0x83 };
+static const symbol s_64_1[6] = { 0xCE, 0xBF, 0xCF, 0x85, 0xCF, 0x83 };
+static const symbol s_64_2[4] = { 0xCE, 0xB1, 0xCF, 0x83 };
+static const symbol s_64_3[4] = { 0xCE, 0xB5, 0xCF, 0x83 };
+static const symbol s_64_4[8] = { 0xCE, 0xB7, 0xCF, 0x83, 0xCE, 0xB5, 0xCF, 0x83 };
+static const symbol s_64_5[8] = { 0xCE, 0xB7, 0xCE, 0xB4, 0xCE, 0xB5, 0xCF, 0x83 };
+static const symbol s_64_6[4] = { 0xCE, 0xB7, 0xCF, 0x83 };
+static const symbol s_64_7[6] = { 0xCE, 0xB5, 0xCE, 0xB9, 0xCF, 0x83 };
+static const symbol s_64_8[10] = { 0xCE, 0xB7, 0xCE, 0xB8, 0xCE, 0xB5, 0xCE, 0xB9, 0xCF, 0x83 };
+static const symbol s_64_9[4] = { 0xCE, 0xBF, 0xCF, 0x83 };
+static const symbol s_64_10[2] = { 0xCF, 0x85 };
+static const symbol s_64_11[4] = { 0xCE, 0xBF, 0xCF, 0x85 };
+static const symbol s_64_12[2] = { 0xCF, 0x89 };
+static const symbol s_64_13[6] = { 0xCE, 0xB7, 0xCF, 0x83, 0xCF, 0x89 };
+static const symbol s_64_14[4] = { 0xCE, 0xB1, 0xCF, 0x89 };
+static const symbol s_64_15[6] = { 0xCE, 0xB7, 0xCE, 0xB8, 0xCF, 0x89 };
+static const symbol s_64_16[2] = { 0xCE, 0xB1 };
+static const symbol s_64_17[10] = { 0xCE, 0xB9, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBC, 0xCE, 0xB1 };
+static const symbol s_64_18[12] = { 0xCE, 0xBF, 0xCF, 0x83, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBD, 0xCE, 0xB1 };
+static const symbol s_64_19[14] = { 0xCE, 0xB9, 0xCE, 0xBF, 0xCF, 0x83, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBD, 0xCE, 0xB1 };
+static const symbol s_64_20[12] = { 0xCE, 0xBF, 0xCE, 0xBC, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBD, 0xCE, 0xB1 };
+static const symbol s_64_21[14] = { 0xCE, 0xB9, 0xCE, 0xBF, 0xCE, 0xBC, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBD, 0xCE, 0xB1 };
+static const symbol s_64_22[2] = { 0xCE, 0xB5 };
+static const symbol s_64_23[14] = { 0xCE, 0xB9, 0xCE, 0xB5, 0xCF, 0x83, 0xCE, 0xB1, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB5 };
+static const symbol s_64_24[12] = { 0xCE, 0xBF, 0xCF, 0x83, 0xCE, 0xB1, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB5 };
+static const symbol s_64_25[14] = { 0xCE, 0xB9, 0xCE, 0xBF, 0xCF, 0x83, 0xCE, 0xB1, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB5 };
+static const symbol s_64_26[14] = { 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBC, 0xCE, 0xB1, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB5 };
+static const symbol s_64_27[16] = { 0xCE, 0xB9, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBC, 0xCE, 0xB1, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB5 };
+static const symbol s_64_28[14] = { 0xCE, 0xB9, 0xCE, 0xB5, 0xCE, 0xBC, 0xCE, 0xB1, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB5 };
+static const symbol s_64_29[12] = { 0xCE, 0xBF, 0xCF, 0x85, 0xCF, 0x83, 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xB5 };
+static const symbol s_64_30[10] = { 0xCE, 0xB7, 0xCF, 0x83, 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xB5 };
+static const symbol s_64_31[10] = { 0xCE, 0xB1, 0xCE, 0xB3, 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xB5 };
+static const symbol s_64_32[10] = { 0xCE, 0xB7, 0xCE, 0xBA, 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xB5 };
+static const symbol s_64_33[14] = { 0xCE, 0xB7, 0xCE, 0xB8, 0xCE, 0xB7, 0xCE, 0xBA, 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xB5 };
+static const symbol s_64_34[8] = { 0xCE, 0xB5, 0xCE, 0xB9, 0xCF, 0x84, 0xCE, 0xB5 };
+static const symbol s_64_35[12] = { 0xCE, 0xB7, 0xCE, 0xB8, 0xCE, 0xB5, 0xCE, 0xB9, 0xCF, 0x84, 0xCE, 0xB5 };
+static const symbol s_64_36[2] = { 0xCE, 0xB7 };
+static const symbol s_64_37[2] = { 0xCE, 0xB9 };
+static const symbol s_64_38[8] = { 0xCE, 0xB1, 0xCF, 0x83, 0xCE, 0xB1, 0xCE, 0xB9 };
+static const symbol s_64_39[8] = { 0xCE, 0xB5, 0xCF, 0x83, 0xCE, 0xB1, 0xCE, 0xB9 };
+static const symbol s_64_40[10] = { 0xCE, 0xB9, 0xCE, 0xB5, 0xCF, 0x83, 0xCE, 0xB1, 0xCE, 0xB9 };
+static const symbol s_64_41[8] = { 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xB9 };
+static const symbol s_64_42[8] = { 0xCE, 0xB5, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xB9 };
+static const symbol s_64_43[10] = { 0xCE, 0xB9, 0xCE, 0xB5, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xB9 };
+static const symbol s_64_44[12] = { 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBD, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xB9 };
+static const symbol s_64_45[14] = { 0xCE, 0xB9, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBD, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xB9 };
+static const symbol s_64_46[10] = { 0xCE, 0xBF, 0xCE, 0xBD, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xB9 };
+static const symbol s_64_47[10] = { 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBC, 0xCE, 0xB1, 0xCE, 0xB9 };
+static const symbol s_64_48[8] = { 0xCE, 0xB1, 0xCE, 0xBC, 0xCE, 0xB1, 0xCE, 0xB9 };
+static const symbol s_64_49[10] = { 0xCE, 0xB9, 0xCE, 0xB5, 0xCE, 0xBC, 0xCE, 0xB1, 0xCE, 0xB9 };
+static const symbol s_64_50[8] = { 0xCE, 0xBF, 0xCE, 0xBC, 0xCE, 0xB1, 0xCE, 0xB9 };
+static const symbol s_64_51[4] = { 0xCE, 0xB5, 0xCE, 0xB9 };
+static const symbol s_64_52[8] = { 0xCE, 0xB7, 0xCF, 0x83, 0xCE, 0xB5, 0xCE, 0xB9 };
+static const symbol s_64_53[6] = { 0xCE, 0xB1, 0xCE, 0xB5, 0xCE, 0xB9 };
+static const symbol s_64_54[8] = { 0xCE, 0xB7, 0xCE, 0xB8, 0xCE, 0xB5, 0xCE, 0xB9 };
+static const symbol s_64_55[4] = { 0xCE, 0xBF, 0xCE, 0xB9 };
+static const symbol s_64_56[6] = { 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBD };
+static const symbol s_64_57[10] = { 0xCE, 0xB7, 0xCF, 0x83, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBD };
+static const symbol s_64_58[10] = { 0xCE, 0xBF, 0xCF, 0x83, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBD };
+static const symbol s_64_59[12] = { 0xCE, 0xB9, 0xCE, 0xBF, 0xCF, 0x83, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBD };
+static const symbol s_64_60[10] = { 0xCE, 0xB7, 0xCE, 0xB8, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBD };
+static const symbol s_64_61[10] = { 0xCE, 0xBF, 0xCE, 0xBC, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBD };
+static const symbol s_64_62[12] = { 0xCE, 0xB9, 0xCE, 0xBF, 0xCE, 0xBC, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBD };
+static const symbol s_64_63[4] = { 0xCF, 0x89, 0xCE, 0xBD };
+static const symbol s_64_64[8] = { 0xCE, 0xB7, 0xCE, 0xB4, 0xCF, 0x89, 0xCE, 0xBD };
+static const symbol s_64_65[4] = { 0xCE, 0xB1, 0xCE, 0xBD };
+static const symbol s_64_66[10] = { 0xCE, 0xBF, 0xCF, 0x85, 0xCF, 0x83, 0xCE, 0xB1, 0xCE, 0xBD };
+static const symbol s_64_67[16] = { 0xCE, 0xBF, 0xCE, 0xBD, 0xCF, 0x84, 0xCE, 0xBF, 0xCF, 0x85, 0xCF, 0x83, 0xCE, 0xB1, 0xCE, 0xBD };
+static const symbol s_64_68[18] = { 0xCE, 0xB9, 0xCE, 0xBF, 0xCE, 0xBD, 0xCF, 0x84, 0xCE, 0xBF, 0xCF, 0x85, 0xCF, 0x83, 0xCE, 0xB1, 0xCE, 0xBD };
+static const symbol s_64_69[8] = { 0xCE, 0xB7, 0xCF, 0x83, 0xCE, 0xB1, 0xCE, 0xBD };
+static const symbol s_64_70[14] = { 0xCE, 0xBF, 0xCF, 0x83, 0xCE, 0xB1, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xBD };
+static const symbol s_64_71[16] = { 0xCE, 0xB9, 0xCE, 0xBF, 0xCF, 0x83, 0xCE, 0xB1, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xBD };
+static const symbol s_64_72[14] = { 0xCE, 0xBF, 0xCE, 0xBC, 0xCE, 0xB1, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xBD };
+static const symbol s_64_73[16] = { 0xCE, 0xB9, 0xCE, 0xBF, 0xCE, 0xBC, 0xCE, 0xB1, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xBD };
+static const symbol s_64_74[12] = { 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBD, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xBD };
+static const symbol s_64_75[14] = { 0xCE, 0xB9, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBD, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xBD };
+static const symbol s_64_76[10] = { 0xCE, 0xBF, 0xCE, 0xBD, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xBD };
+static const symbol s_64_77[12] = { 0xCE, 0xB9, 0xCE, 0xBF, 0xCE, 0xBD, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xBD };
+static const symbol s_64_78[8] = { 0xCE, 0xBF, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xBD };
+static const symbol s_64_79[10] = { 0xCE, 0xB9, 0xCE, 0xBF, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xBD };
+static const symbol s_64_80[8] = { 0xCE, 0xB1, 0xCE, 0xB3, 0xCE, 0xB1, 0xCE, 0xBD };
+static const symbol s_64_81[8] = { 0xCE, 0xB7, 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xBD };
+static const symbol s_64_82[12] = { 0xCE, 0xB7, 0xCE, 0xB8, 0xCE, 0xB7, 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xBD };
+static const symbol s_64_83[2] = { 0xCE, 0xBF };
+static const struct among a_64[84] = {
+{ 4, s_64_0, 0, 1, 0},
+{ 6, s_64_1, -1, 1, 0},
+{ 4, s_64_2, 0, 1, 0},
+{ 4, s_64_3, 0, 1, 0},
+{ 8, s_64_4, -1, 1, 0},
+{ 8, s_64_5, -2, 1, 0},
+{ 4, s_64_6, 0, 1, 0},
+{ 6, s_64_7, 0, 1, 0},
+{ 10, s_64_8, -1, 1, 0},
+{ 4, s_64_9, 0, 1, 0},
+{ 2, s_64_10, 0, 1, 0},
+{ 4, s_64_11, -1, 1, 0},
+{ 2, s_64_12, 0, 1, 0},
+{ 6, s_64_13, -1, 1, 0},
+{ 4, s_64_14, -2, 1, 0},
+{ 6, s_64_15, -3, 1, 0},
+{ 2, s_64_16, 0, 1, 0},
+{ 10, s_64_17, -1, 1, 0},
+{ 12, s_64_18, -2, 1, 0},
+{ 14, s_64_19, -1, 1, 0},
+{ 12, s_64_20, -4, 1, 0},
+{ 14, s_64_21, -1, 1, 0},
+{ 2, s_64_22, 0, 1, 0},
+{ 14, s_64_23, -1, 1, 0},
+{ 12, s_64_24, -2, 1, 0},
+{ 14, s_64_25, -1, 1, 0},
+{ 14, s_64_26, -4, 1, 0},
+{ 16, s_64_27, -1, 1, 0},
+{ 14, s_64_28, -6, 1, 0},
+{ 12, s_64_29, -7, 1, 0},
+{ 10, s_64_30, -8, 1, 0},
+{ 10, s_64_31, -9, 1, 0},
+{ 10, s_64_32, -10, 1, 0},
+{ 14, s_64_33, -1, 1, 0},
+{ 8, s_64_34, -12, 1, 0},
+{ 12, s_64_35, -1, 1, 0},
+{ 2, s_64_36, 0, 1, 0},
+{ 2, s_64_37, 0, 1, 0},
+{ 8, s_64_38, -1, 1, 0},
+{ 8, s_64_39, -2, 1, 0},
+{ 10, s_64_40, -1, 1, 0},
+{ 8, s_64_41, -4, 1, 0},
+{ 8, s_64_42, -5, 1, 0},
+{ 10, s_64_43, -1, 1, 0},
+{ 12, s_64_44, -7, 1, 0},
+{ 14, s_64_45, -1, 1, 0},
+{ 10, s_64_46, -9, 1, 0},
+{ 10, s_64_47, -10, 1, 0},
+{ 8, s_64_48, -11, 1, 0},
+{ 10, s_64_49, -12, 1, 0},
+{ 8, s_64_50, -13, 1, 0},
+{ 4, s_64_51, -14, 1, 0},
+{ 8, s_64_52, -1, 1, 0},
+{ 6, s_64_53, -2, 1, 0},
+{ 8, s_64_54, -3, 1, 0},
+{ 4, s_64_55, -18, 1, 0},
+{ 6, s_64_56, 0, 1, 0},
+{ 10, s_64_57, -1, 1, 0},
+{ 10, s_64_58, -2, 1, 0},
+{ 12, s_64_59, -1, 1, 0},
+{ 10, s_64_60, -4, 1, 0},
+{ 10, s_64_61, -5, 1, 0},
+{ 12, s_64_62, -1, 1, 0},
+{ 4, s_64_63, 0, 1, 0},
+{ 8, s_64_64, -1, 1, 0},
+{ 4, s_64_65, 0, 1, 0},
+{ 10, s_64_66, -1, 1, 0},
+{ 16, s_64_67, -1, 1, 0},
+{ 18, s_64_68, -1, 1, 0},
+{ 8, s_64_69, -4, 1, 0},
+{ 14, s_64_70, -5, 1, 0},
+{ 16, s_64_71, -1, 1, 0},
+{ 14, s_64_72, -7, 1, 0},
+{ 16, s_64_73, -1, 1, 0},
+{ 12, s_64_74, -9, 1, 0},
+{ 14, s_64_75, -1, 1, 0},
+{ 10, s_64_76, -11, 1, 0},
+{ 12, s_64_77, -1, 1, 0},
+{ 8, s_64_78, -13, 1, 0},
+{ 10, s_64_79, -1, 1, 0},
+{ 8, s_64_80, -15, 1, 0},
+{ 8, s_64_81, -16, 1, 0},
+{ 12, s_64_82, -1, 1, 0},
+{ 2, s_64_83, 0, 1, 0}
+};
+
+static const symbol s_65_0[10] = { 0xCE, 0xB5, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB5, 0xCF, 0x81 };
+static const symbol s_65_1[8] = { 0xCF, 0x85, 0xCF, 0x84, 0xCE, 0xB5, 0xCF, 0x81 };
+static const symbol s_65_2[8] = { 0xCF, 0x89, 0xCF, 0x84, 0xCE, 0xB5, 0xCF, 0x81 };
+static const symbol s_65_3[8] = { 0xCE, 0xBF, 0xCF, 0x84, 0xCE, 0xB5, 0xCF, 0x81 };
+static const symbol s_65_4[10] = { 0xCE, 0xB5, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB1, 0xCF, 0x84 };
+static const symbol s_65_5[8] = { 0xCF, 0x85, 0xCF, 0x84, 0xCE, 0xB1, 0xCF, 0x84 };
+static const symbol s_65_6[8] = { 0xCF, 0x89, 0xCF, 0x84, 0xCE, 0xB1, 0xCF, 0x84 };
+static const symbol s_65_7[8] = { 0xCE, 0xBF, 0xCF, 0x84, 0xCE, 0xB1, 0xCF, 0x84 };
+static const struct among a_65[8] = {
+{ 10, s_65_0, 0, 1, 0},
+{ 8, s_65_1, 0, 1, 0},
+{ 8, s_65_2, 0, 1, 0},
+{ 8, s_65_3, 0, 1, 0},
+{ 10, s_65_4, 0, 1, 0},
+{ 8, s_65_5, 0, 1, 0},
+{ 8, s_65_6, 0, 1, 0},
+{ 8, s_65_7, 0, 1, 0}
+};
+
+static const unsigned char g_v[] = { 81, 65, 16, 1 };
+
+static const unsigned char g_v2[] = { 81, 65, 0, 1 };
+
+static int r_has_min_length(struct SN_env * z) {
+    return len_utf8(z->p) >= 3;
+}
+
+static int r_tolower(struct SN_env * z) {
+    int among_var;
+    while (1) {
+        int v_1 = z->l - z->c;
+        z->ket = z->c;
+        among_var = find_among_b(z, a_0, 46, 0);
+        z->bra = z->c;
+        switch (among_var) {
+            case 1:
+                {
+                    int ret = slice_from_s(z, 2, s_0);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {
+                    int ret = slice_from_s(z, 2, s_1);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                {
+                    int ret = slice_from_s(z, 2, s_2);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 4:
+                {
+                    int ret = slice_from_s(z, 2, s_3);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 5:
+                {
+                    int ret = slice_from_s(z, 2, s_4);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 6:
+                {
+                    int ret = slice_from_s(z, 2, s_5);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 7:
+                {
+                    int ret = slice_from_s(z, 2, s_6);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 8:
+                {
+                    int ret = slice_from_s(z, 2, s_7);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 9:
+                {
+                    int ret = slice_from_s(z, 2, s_8);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 10:
+                {
+                    int ret = slice_from_s(z, 2, s_9);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 11:
+                {
+                    int ret = slice_from_s(z, 2, s_10);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 12:
+                {
+                    int ret = slice_from_s(z, 2, s_11);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 13:
+                {
+                    int ret = slice_from_s(z, 2, s_12);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 14:
+                {
+                    int ret = slice_from_s(z, 2, s_13);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 15:
+                {
+                    int ret = slice_from_s(z, 2, s_14);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 16:
+                {
+                    int ret = slice_from_s(z, 2, s_15);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 17:
+                {
+                    int ret = slice_from_s(z, 2, s_16);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 18:
+                {
+                    int ret = slice_from_s(z, 2, s_17);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 19:
+                {
+                    int ret = slice_from_s(z, 2, s_18);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 20:
+                {
+                    int ret = slice_from_s(z, 2, s_19);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 21:
+                {
+                    int ret = slice_from_s(z, 2, s_20);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 22:
+                {
+                    int ret = slice_from_s(z, 2, s_21);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 23:
+                {
+                    int ret = slice_from_s(z, 2, s_22);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 24:
+                {
+                    int ret = slice_from_s(z, 2, s_23);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 25:
+                {
+                    int ret = skip_b_utf8(z->p, z->c, z->lb, 1);
+                    if (ret < 0) goto lab0;
+                    z->c = ret;
+                }
+                break;
+        }
+        continue;
+    lab0:
+        z->c = z->l - v_1;
+        break;
+    }
+    return 1;
+}
+
+static int r_step_1(struct SN_env * z) {
+    int among_var;
+    z->ket = z->c;
+    among_var = find_among_b(z, a_1, 40, 0);
+    if (!among_var) return 0;
+    z->bra = z->c;
+    switch (among_var) {
+        case 1:
+            {
+                int ret = slice_from_s(z, 4, s_24);
+                if (ret < 0) return ret;
+            }
+            break;
+        case 2:
+            {
+                int ret = slice_from_s(z, 6, s_25);
+                if (ret < 0) return ret;
+            }
+            break;
+        case 3:
+            {
+                int ret = slice_from_s(z, 6, s_26);
+                if (ret < 0) return ret;
+            }
+            break;
+        case 4:
+            {
+                int ret = slice_from_s(z, 4, s_27);
+                if (ret < 0) return ret;
+            }
+            break;
+        case 5:
+            {
+                int ret = slice_from_s(z, 8, s_28);
+                if (ret < 0) return ret;
+            }
+            break;
+        case 6:
+            {
+                int ret = slice_from_s(z, 6, s_29);
+                if (ret < 0) return ret;
+            }
+            break;
+        case 7:
+            {
+                int ret = slice_from_s(z, 6, s_30);
+                if (ret < 0) return ret;
+            }
+            break;
+        case 8:
+            {
+                int ret = slice_from_s(z, 6, s_31);
+                if (ret < 0) return ret;
+            }
+            break;
+        case 9:
+            {
+                int ret = slice_from_s(z, 4, s_32);
+                if (ret < 0) return ret;
+            }
+            break;
+        case 10:
+            {
+                int ret = slice_from_s(z, 12, s_33);
+                if (ret < 0) return ret;
+            }
+            break;
+        case 11:
+            {
+                int ret = slice_from_s(z, 10, s_34);
+                if (ret < 0) return ret;
+            }
+            break;
+    }
+    ((SN_local *)z)->b_test1 = 0;
+    return 1;
+}
+
+static int r_step_s1(struct SN_env * z) {
+    int among_var;
+    z->ket = z->c;
+    if (!find_among_b(z, a_3, 14, 0)) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    ((SN_local *)z)->b_test1 = 0;
+    z->ket = z->c;
+    z->bra = z->c;
+    among_var = find_among_b(z, a_2, 31, 0);
+    if (!among_var) return 0;
+    if (z->c > z->lb) return 0;
+    switch (among_var) {
+        case 1:
+            {
+                int ret = slice_from_s(z, 2, s_35);
+                if (ret < 0) return ret;
+            }
+            break;
+        case 2:
+            {
+                int ret = slice_from_s(z, 4, s_36);
+                if (ret < 0) return ret;
+            }
+            break;
+    }
+    return 1;
+}
+
+static int r_step_s2(struct SN_env * z) {
+    z->ket = z->c;
+    if (!find_among_b(z, a_5, 7, 0)) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    ((SN_local *)z)->b_test1 = 0;
+    z->ket = z->c;
+    z->bra = z->c;
+    if (!find_among_b(z, a_4, 8, 0)) return 0;
+    if (z->c > z->lb) return 0;
+    {
+        int ret = slice_from_s(z, 4, s_37);
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+static int r_step_s3(struct SN_env * z) {
+    int among_var;
+    do {
+        int v_1 = z->l - z->c;
+        z->ket = z->c;
+        if (!(eq_s_b(z, 6, s_38))) goto lab0;
+        z->bra = z->c;
+        if (z->c > z->lb) goto lab0;
+        {
+            int ret = slice_from_s(z, 4, s_39);
+            if (ret < 0) return ret;
+        }
+        break;
+    lab0:
+        z->c = z->l - v_1;
+        z->ket = z->c;
+    } while (0);
+    if (!find_among_b(z, a_7, 7, 0)) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    ((SN_local *)z)->b_test1 = 0;
+    z->ket = z->c;
+    z->bra = z->c;
+    among_var = find_among_b(z, a_6, 32, 0);
+    if (!among_var) return 0;
+    if (z->c > z->lb) return 0;
+    switch (among_var) {
+        case 1:
+            {
+                int ret = slice_from_s(z, 2, s_40);
+                if (ret < 0) return ret;
+            }
+            break;
+        case 2:
+            {
+                int ret = slice_from_s(z, 4, s_41);
+                if (ret < 0) return ret;
+            }
+            break;
+    }
+    return 1;
+}
+
+static int r_step_s4(struct SN_env * z) {
+    z->ket = z->c;
+    if (!find_among_b(z, a_9, 7, 0)) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    ((SN_local *)z)->b_test1 = 0;
+    z->ket = z->c;
+    z->bra = z->c;
+    if (z->c - 3 <= z->lb || z->p[z->c - 1] >> 5 != 5 || !((-2145255424 >> (z->p[z->c - 1] & 0x1f)) & 1)) return 0;
+    if (!find_among_b(z, a_8, 19, 0)) return 0;
+    if (z->c > z->lb) return 0;
+    {
+        int ret = slice_from_s(z, 2, s_42);
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+static int r_step_s5(struct SN_env * z) {
+    int among_var;
+    z->ket = z->c;
+    if (!find_among_b(z, a_11, 11, 0)) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    ((SN_local *)z)->b_test1 = 0;
+    z->ket = z->c;
+    z->bra = z->c;
+    among_var = find_among_b(z, a_10, 40, 0);
+    if (!among_var) return 0;
+    if (z->c > z->lb) return 0;
+    switch (among_var) {
+        case 1:
+            {
+                int ret = slice_from_s(z, 2, s_43);
+                if (ret < 0) return ret;
+            }
+            break;
+        case 2:
+            {
+                int ret = slice_from_s(z, 6, s_44);
+                if (ret < 0) return ret;
+            }
+            break;
+    }
+    return 1;
+}
+
+static int r_step_s6(struct SN_env * z) {
+    int among_var;
+    z->ket = z->c;
+    if (!find_among_b(z, a_14, 6, 0)) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    ((SN_local *)z)->b_test1 = 0;
+    do {
+        int v_1 = z->l - z->c;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (z->c - 3 <= z->lb || z->p[z->c - 1] != 181) goto lab0;
+        among_var = find_among_b(z, a_12, 7, 0);
+        if (!among_var) goto lab0;
+        if (z->c > z->lb) goto lab0;
+        switch (among_var) {
+            case 1:
+                {
+                    int ret = slice_from_s(z, 6, s_45);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {
+                    int ret = slice_from_s(z, 2, s_46);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+        break;
+    lab0:
+        z->c = z->l - v_1;
+        z->ket = z->c;
+        if (z->c - 9 <= z->lb || (z->p[z->c - 1] != 186 && z->p[z->c - 1] != 189)) return 0;
+        among_var = find_among_b(z, a_13, 10, 0);
+        if (!among_var) return 0;
+        z->bra = z->c;
+        switch (among_var) {
+            case 1:
+                {
+                    int ret = slice_from_s(z, 12, s_47);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {
+                    int ret = slice_from_s(z, 8, s_48);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                {
+                    int ret = slice_from_s(z, 10, s_49);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 4:
+                {
+                    int ret = slice_from_s(z, 6, s_50);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 5:
+                {
+                    int ret = slice_from_s(z, 12, s_51);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 6:
+                {
+                    int ret = slice_from_s(z, 10, s_52);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 7:
+                {
+                    int ret = slice_from_s(z, 6, s_53);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 8:
+                {
+                    int ret = slice_from_s(z, 16, s_54);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 9:
+                {
+                    int ret = slice_from_s(z, 12, s_55);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 10:
+                {
+                    int ret = slice_from_s(z, 10, s_56);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    } while (0);
+    return 1;
+}
+
+static int r_step_s7(struct SN_env * z) {
+    z->ket = z->c;
+    if (z->c - 9 <= z->lb || (z->p[z->c - 1] != 177 && z->p[z->c - 1] != 185)) return 0;
+    if (!find_among_b(z, a_16, 4, 0)) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    ((SN_local *)z)->b_test1 = 0;
+    z->ket = z->c;
+    z->bra = z->c;
+    if (z->c - 1 <= z->lb || (z->p[z->c - 1] != 131 && z->p[z->c - 1] != 135)) return 0;
+    if (!find_among_b(z, a_15, 2, 0)) return 0;
+    if (z->c > z->lb) return 0;
+    {
+        int ret = slice_from_s(z, 8, s_57);
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+static int r_step_s8(struct SN_env * z) {
+    int among_var;
+    z->ket = z->c;
+    if (!find_among_b(z, a_18, 8, 0)) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    ((SN_local *)z)->b_test1 = 0;
+    do {
+        int v_1 = z->l - z->c;
+        z->ket = z->c;
+        z->bra = z->c;
+        among_var = find_among_b(z, a_17, 46, 0);
+        if (!among_var) goto lab0;
+        if (z->c > z->lb) goto lab0;
+        switch (among_var) {
+            case 1:
+                {
+                    int ret = slice_from_s(z, 4, s_58);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {
+                    int ret = slice_from_s(z, 6, s_59);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+        break;
+    lab0:
+        z->c = z->l - v_1;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (!(eq_s_b(z, 6, s_60))) return 0;
+        {
+            int ret = slice_from_s(z, 6, s_61);
+            if (ret < 0) return ret;
+        }
+    } while (0);
+    return 1;
+}
+
+static int r_step_s9(struct SN_env * z) {
+    z->ket = z->c;
+    if (z->c - 7 <= z->lb || z->p[z->c - 1] >> 5 != 5 || !((-1610481664 >> (z->p[z->c - 1] & 0x1f)) & 1)) return 0;
+    if (!find_among_b(z, a_21, 3, 0)) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    ((SN_local *)z)->b_test1 = 0;
+    do {
+        int v_1 = z->l - z->c;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (!find_among_b(z, a_19, 4, 0)) goto lab0;
+        if (z->c > z->lb) goto lab0;
+        {
+            int ret = slice_from_s(z, 4, s_62);
+            if (ret < 0) return ret;
+        }
+        break;
+    lab0:
+        z->c = z->l - v_1;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (z->c - 1 <= z->lb || (z->p[z->c - 1] != 181 && z->p[z->c - 1] != 189)) return 0;
+        if (!find_among_b(z, a_20, 2, 0)) return 0;
+        {
+            int ret = slice_from_s(z, 4, s_63);
+            if (ret < 0) return ret;
+        }
+    } while (0);
+    return 1;
+}
+
+static int r_step_s10(struct SN_env * z) {
+    z->ket = z->c;
+    if (!find_among_b(z, a_23, 4, 0)) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    ((SN_local *)z)->b_test1 = 0;
+    z->ket = z->c;
+    z->bra = z->c;
+    if (!find_among_b(z, a_22, 7, 0)) return 0;
+    if (z->c > z->lb) return 0;
+    {
+        int ret = slice_from_s(z, 6, s_64);
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+static int r_step_2a(struct SN_env * z) {
+    z->ket = z->c;
+    if (z->c - 7 <= z->lb || (z->p[z->c - 1] != 131 && z->p[z->c - 1] != 189)) return 0;
+    if (!find_among_b(z, a_24, 2, 0)) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    {
+        int v_1 = z->l - z->c;
+        if (!find_among_b(z, a_25, 10, 0)) goto lab0;
+        return 0;
+    lab0:
+        z->c = z->l - v_1;
+    }
+    {
+        int saved_c = z->c;
+        int ret = insert_s(z, z->c, z->c, 4, s_65);
+        z->c = saved_c;
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+static int r_step_2b(struct SN_env * z) {
+    z->ket = z->c;
+    if (z->c - 7 <= z->lb || (z->p[z->c - 1] != 131 && z->p[z->c - 1] != 189)) return 0;
+    if (!find_among_b(z, a_26, 2, 0)) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    z->ket = z->c;
+    z->bra = z->c;
+    if (z->c - 3 <= z->lb || (z->p[z->c - 1] != 128 && z->p[z->c - 1] != 187)) return 0;
+    if (!find_among_b(z, a_27, 8, 0)) return 0;
+    {
+        int ret = slice_from_s(z, 4, s_66);
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+static int r_step_2c(struct SN_env * z) {
+    z->ket = z->c;
+    if (z->c - 9 <= z->lb || (z->p[z->c - 1] != 131 && z->p[z->c - 1] != 189)) return 0;
+    if (!find_among_b(z, a_28, 2, 0)) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    z->ket = z->c;
+    z->bra = z->c;
+    if (!find_among_b(z, a_29, 15, 0)) return 0;
+    {
+        int ret = slice_from_s(z, 6, s_67);
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+static int r_step_2d(struct SN_env * z) {
+    z->ket = z->c;
+    if (z->c - 5 <= z->lb || (z->p[z->c - 1] != 131 && z->p[z->c - 1] != 189)) return 0;
+    if (!find_among_b(z, a_30, 2, 0)) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    ((SN_local *)z)->b_test1 = 0;
+    z->ket = z->c;
+    z->bra = z->c;
+    if (!find_among_b(z, a_31, 8, 0)) return 0;
+    if (z->c > z->lb) return 0;
+    {
+        int ret = slice_from_s(z, 2, s_68);
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+static int r_step_3(struct SN_env * z) {
+    z->ket = z->c;
+    if (!find_among_b(z, a_32, 3, 0)) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    ((SN_local *)z)->b_test1 = 0;
+    z->ket = z->c;
+    z->bra = z->c;
+    if (in_grouping_b_U(z, g_v, 945, 969, 0)) return 0;
+    {
+        int ret = slice_from_s(z, 2, s_69);
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+static int r_step_4(struct SN_env * z) {
+    z->ket = z->c;
+    if (!find_among_b(z, a_33, 4, 0)) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    ((SN_local *)z)->b_test1 = 0;
+    do {
+        int v_1 = z->l - z->c;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (in_grouping_b_U(z, g_v, 945, 969, 0)) goto lab0;
+        {
+            int ret = slice_from_s(z, 4, s_70);
+            if (ret < 0) return ret;
+        }
+        break;
+    lab0:
+        z->c = z->l - v_1;
+        z->ket = z->c;
+    } while (0);
+    z->bra = z->c;
+    if (!find_among_b(z, a_34, 36, 0)) return 0;
+    if (z->c > z->lb) return 0;
+    {
+        int ret = slice_from_s(z, 4, s_71);
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+static int r_step_5a(struct SN_env * z) {
+    {
+        int v_1 = z->l - z->c;
+        z->ket = z->c;
+        if (!(eq_s_b(z, 10, s_72))) goto lab0;
+        z->bra = z->c;
+        if (z->c > z->lb) goto lab0;
+        {
+            int ret = slice_from_s(z, 8, s_73);
+            if (ret < 0) return ret;
+        }
+    lab0:
+        z->c = z->l - v_1;
+    }
+    {
+        int v_2 = z->l - z->c;
+        z->ket = z->c;
+        if (z->c - 9 <= z->lb || z->p[z->c - 1] != 181) goto lab1;
+        if (!find_among_b(z, a_35, 5, 0)) goto lab1;
+        z->bra = z->c;
+        {
+            int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        ((SN_local *)z)->b_test1 = 0;
+    lab1:
+        z->c = z->l - v_2;
+    }
+    z->ket = z->c;
+    if (!(eq_s_b(z, 6, s_74))) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    ((SN_local *)z)->b_test1 = 0;
+    z->ket = z->c;
+    z->bra = z->c;
+    if (!find_among_b(z, a_36, 12, 0)) return 0;
+    if (z->c > z->lb) return 0;
+    {
+        int ret = slice_from_s(z, 4, s_75);
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+static int r_step_5b(struct SN_env * z) {
+    {
+        int v_1 = z->l - z->c;
+        z->ket = z->c;
+        if (z->c - 9 <= z->lb || z->p[z->c - 1] != 181) goto lab0;
+        if (!find_among_b(z, a_38, 11, 0)) goto lab0;
+        z->bra = z->c;
+        {
+            int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        ((SN_local *)z)->b_test1 = 0;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (z->c - 3 <= z->lb || (z->p[z->c - 1] != 129 && z->p[z->c - 1] != 131)) goto lab0;
+        if (!find_among_b(z, a_37, 2, 0)) goto lab0;
+        if (z->c > z->lb) goto lab0;
+        {
+            int ret = slice_from_s(z, 8, s_76);
+            if (ret < 0) return ret;
+        }
+    lab0:
+        z->c = z->l - v_1;
+    }
+    z->ket = z->c;
+    if (!(eq_s_b(z, 6, s_77))) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    ((SN_local *)z)->b_test1 = 0;
+    do {
+        int v_2 = z->l - z->c;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (in_grouping_b_U(z, g_v2, 945, 969, 0)) goto lab1;
+        {
+            int ret = slice_from_s(z, 4, s_78);
+            if (ret < 0) return ret;
+        }
+        break;
+    lab1:
+        z->c = z->l - v_2;
+        z->ket = z->c;
+    } while (0);
+    z->bra = z->c;
+    if (!find_among_b(z, a_39, 95, 0)) return 0;
+    if (z->c > z->lb) return 0;
+    {
+        int ret = slice_from_s(z, 4, s_79);
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+static int r_step_5c(struct SN_env * z) {
+    {
+        int v_1 = z->l - z->c;
+        z->ket = z->c;
+        if (!(eq_s_b(z, 10, s_80))) goto lab0;
+        z->bra = z->c;
+        {
+            int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        ((SN_local *)z)->b_test1 = 0;
+    lab0:
+        z->c = z->l - v_1;
+    }
+    z->ket = z->c;
+    if (!(eq_s_b(z, 6, s_81))) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    ((SN_local *)z)->b_test1 = 0;
+    do {
+        int v_2 = z->l - z->c;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (in_grouping_b_U(z, g_v2, 945, 969, 0)) goto lab1;
+        {
+            int ret = slice_from_s(z, 4, s_82);
+            if (ret < 0) return ret;
+        }
+        break;
+    lab1:
+        z->c = z->l - v_2;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (!find_among_b(z, a_40, 31, 0)) goto lab2;
+        {
+            int ret = slice_from_s(z, 4, s_83);
+            if (ret < 0) return ret;
+        }
+        break;
+    lab2:
+        z->c = z->l - v_2;
+        z->ket = z->c;
+    } while (0);
+    z->bra = z->c;
+    if (!find_among_b(z, a_41, 25, 0)) return 0;
+    if (z->c > z->lb) return 0;
+    {
+        int ret = slice_from_s(z, 4, s_84);
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+static int r_step_5d(struct SN_env * z) {
+    z->ket = z->c;
+    if (z->c - 9 <= z->lb || z->p[z->c - 1] != 131) return 0;
+    if (!find_among_b(z, a_42, 2, 0)) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    ((SN_local *)z)->b_test1 = 0;
+    do {
+        int v_1 = z->l - z->c;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (!(eq_s_b(z, 6, s_85))) goto lab0;
+        if (z->c > z->lb) goto lab0;
+        {
+            int ret = slice_from_s(z, 6, s_86);
+            if (ret < 0) return ret;
+        }
+        break;
+    lab0:
+        z->c = z->l - v_1;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (!(eq_s_b(z, 6, s_87))) return 0;
+        {
+            int ret = slice_from_s(z, 6, s_88);
+            if (ret < 0) return ret;
+        }
+    } while (0);
+    return 1;
+}
+
+static int r_step_5e(struct SN_env * z) {
+    z->ket = z->c;
+    if (z->c - 11 <= z->lb || z->p[z->c - 1] != 181) return 0;
+    if (!find_among_b(z, a_43, 2, 0)) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    ((SN_local *)z)->b_test1 = 0;
+    z->ket = z->c;
+    z->bra = z->c;
+    if (!(eq_s_b(z, 4, s_89))) return 0;
+    if (z->c > z->lb) return 0;
+    {
+        int ret = slice_from_s(z, 10, s_90);
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+static int r_step_5f(struct SN_env * z) {
+    {
+        int v_1 = z->l - z->c;
+        z->ket = z->c;
+        if (!(eq_s_b(z, 10, s_91))) goto lab0;
+        z->bra = z->c;
+        {
+            int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        ((SN_local *)z)->b_test1 = 0;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (z->c - 1 <= z->lb || (z->p[z->c - 1] != 128 && z->p[z->c - 1] != 134)) goto lab0;
+        if (!find_among_b(z, a_44, 6, 0)) goto lab0;
+        if (z->c > z->lb) goto lab0;
+        {
+            int ret = slice_from_s(z, 8, s_92);
+            if (ret < 0) return ret;
+        }
+    lab0:
+        z->c = z->l - v_1;
+    }
+    z->ket = z->c;
+    if (!(eq_s_b(z, 8, s_93))) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    ((SN_local *)z)->b_test1 = 0;
+    z->ket = z->c;
+    z->bra = z->c;
+    if (!find_among_b(z, a_45, 9, 0)) return 0;
+    if (z->c > z->lb) return 0;
+    {
+        int ret = slice_from_s(z, 8, s_94);
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+static int r_step_5g(struct SN_env * z) {
+    {
+        int v_1 = z->l - z->c;
+        z->ket = z->c;
+        if (!find_among_b(z, a_46, 3, 0)) goto lab0;
+        z->bra = z->c;
+        {
+            int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        ((SN_local *)z)->b_test1 = 0;
+    lab0:
+        z->c = z->l - v_1;
+    }
+    z->ket = z->c;
+    if (!find_among_b(z, a_49, 3, 0)) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    ((SN_local *)z)->b_test1 = 0;
+    do {
+        int v_2 = z->l - z->c;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (!find_among_b(z, a_47, 6, 0)) goto lab1;
+        {
+            int ret = slice_from_s(z, 4, s_95);
+            if (ret < 0) return ret;
+        }
+        break;
+    lab1:
+        z->c = z->l - v_2;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (z->c - 1 <= z->lb || z->p[z->c - 1] != 184) return 0;
+        if (!find_among_b(z, a_48, 5, 0)) return 0;
+        if (z->c > z->lb) return 0;
+        {
+            int ret = slice_from_s(z, 4, s_96);
+            if (ret < 0) return ret;
+        }
+    } while (0);
+    return 1;
+}
+
+static int r_step_5h(struct SN_env * z) {
+    z->ket = z->c;
+    if (!find_among_b(z, a_52, 3, 0)) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    ((SN_local *)z)->b_test1 = 0;
+    do {
+        int v_1 = z->l - z->c;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (!find_among_b(z, a_50, 12, 0)) goto lab0;
+        {
+            int ret = slice_from_s(z, 6, s_97);
+            if (ret < 0) return ret;
+        }
+        break;
+    lab0:
+        z->c = z->l - v_1;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (!find_among_b(z, a_51, 25, 0)) return 0;
+        if (z->c > z->lb) return 0;
+        {
+            int ret = slice_from_s(z, 6, s_98);
+            if (ret < 0) return ret;
+        }
+    } while (0);
+    return 1;
+}
+
+static int r_step_5i(struct SN_env * z) {
+    int among_var;
+    z->ket = z->c;
+    if (!find_among_b(z, a_55, 3, 0)) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    ((SN_local *)z)->b_test1 = 0;
+    do {
+        int v_1 = z->l - z->c;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (!(eq_s_b(z, 8, s_99))) goto lab0;
+        {
+            int ret = slice_from_s(z, 4, s_100);
+            if (ret < 0) return ret;
+        }
+        break;
+    lab0:
+        z->c = z->l - v_1;
+        do {
+            int v_2 = z->l - z->c;
+            z->ket = z->c;
+            z->bra = z->c;
+            among_var = find_among_b(z, a_53, 12, 0);
+            if (!among_var) goto lab1;
+            switch (among_var) {
+                case 1:
+                    {
+                        int ret = slice_from_s(z, 4, s_101);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+            }
+            break;
+        lab1:
+            z->c = z->l - v_2;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (!find_among_b(z, a_54, 44, 0)) return 0;
+            if (z->c > z->lb) return 0;
+            {
+                int ret = slice_from_s(z, 4, s_102);
+                if (ret < 0) return ret;
+            }
+        } while (0);
+    } while (0);
+    return 1;
+}
+
+static int r_step_5j(struct SN_env * z) {
+    z->ket = z->c;
+    if (!find_among_b(z, a_56, 3, 0)) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    ((SN_local *)z)->b_test1 = 0;
+    z->ket = z->c;
+    z->bra = z->c;
+    if (z->c - 1 <= z->lb || z->p[z->c - 1] != 189) return 0;
+    if (!find_among_b(z, a_57, 6, 0)) return 0;
+    if (z->c > z->lb) return 0;
+    {
+        int ret = slice_from_s(z, 4, s_103);
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+static int r_step_5k(struct SN_env * z) {
+    z->ket = z->c;
+    if (!(eq_s_b(z, 8, s_104))) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    ((SN_local *)z)->b_test1 = 0;
+    z->ket = z->c;
+    z->bra = z->c;
+    if (!find_among_b(z, a_58, 10, 0)) return 0;
+    if (z->c > z->lb) return 0;
+    {
+        int ret = slice_from_s(z, 6, s_105);
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+static int r_step_5l(struct SN_env * z) {
+    z->ket = z->c;
+    if (z->c - 7 <= z->lb || z->p[z->c - 1] != 181) return 0;
+    if (!find_among_b(z, a_59, 3, 0)) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    ((SN_local *)z)->b_test1 = 0;
+    z->ket = z->c;
+    z->bra = z->c;
+    if (!find_among_b(z, a_60, 6, 0)) return 0;
+    if (z->c > z->lb) return 0;
+    {
+        int ret = slice_from_s(z, 6, s_106);
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+static int r_step_5m(struct SN_env * z) {
+    z->ket = z->c;
+    if (z->c - 7 <= z->lb || z->p[z->c - 1] != 181) return 0;
+    if (!find_among_b(z, a_61, 3, 0)) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    ((SN_local *)z)->b_test1 = 0;
+    z->ket = z->c;
+    z->bra = z->c;
+    if (!find_among_b(z, a_62, 7, 0)) return 0;
+    if (z->c > z->lb) return 0;
+    {
+        int ret = slice_from_s(z, 6, s_107);
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+static int r_step_6(struct SN_env * z) {
+    {
+        int v_1 = z->l - z->c;
+        z->ket = z->c;
+        if (!find_among_b(z, a_63, 3, 0)) goto lab0;
+        z->bra = z->c;
+        {
+            int ret = slice_from_s(z, 4, s_108);
+            if (ret < 0) return ret;
+        }
+    lab0:
+        z->c = z->l - v_1;
+    }
+    if (!((SN_local *)z)->b_test1) return 0;
+    z->ket = z->c;
+    if (!find_among_b(z, a_64, 84, 0)) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+static int r_step_7(struct SN_env * z) {
+    z->ket = z->c;
+    if (z->c - 7 <= z->lb || (z->p[z->c - 1] != 129 && z->p[z->c - 1] != 132)) return 0;
+    if (!find_among_b(z, a_65, 8, 0)) return 0;
+    z->bra = z->c;
+    {
+        int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+extern int greek_UTF_8_stem(struct SN_env * z) {
+    z->lb = z->c; z->c = z->l;
+    {
+        int v_1 = z->l - z->c;
+        {
+            int ret = r_tolower(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - v_1;
+    }
+    {
+        int ret = r_has_min_length(z);
+        if (ret <= 0) return ret;
+    }
+    ((SN_local *)z)->b_test1 = 1;
+    {
+        int v_2 = z->l - z->c;
+        {
+            int ret = r_step_1(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - v_2;
+    }
+    {
+        int v_3 = z->l - z->c;
+        {
+            int ret = r_step_s1(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - v_3;
+    }
+    {
+        int v_4 = z->l - z->c;
+        {
+            int ret = r_step_s2(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - v_4;
+    }
+    {
+        int v_5 = z->l - z->c;
+        {
+            int ret = r_step_s3(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - v_5;
+    }
+    {
+        int v_6 = z->l - z->c;
+        {
+            int ret = r_step_s4(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - v_6;
+    }
+    {
+        int v_7 = z->l - z->c;
+        {
+            int ret = r_step_s5(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - v_7;
+    }
+    {
+        int v_8 = z->l - z->c;
+        {
+            int ret = r_step_s6(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - v_8;
+    }
+    {
+        int v_9 = z->l - z->c;
+        {
+            int ret = r_step_s7(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - v_9;
+    }
+    {
+        int v_10 = z->l - z->c;
+        {
+            int ret = r_step_s8(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - v_10;
+    }
+    {
+        int v_11 = z->l - z->c;
+        {
+            int ret = r_step_s9(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - v_11;
+    }
+    {
+        int v_12 = z->l - z->c;
+        {
+            int ret = r_step_s10(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - v_12;
+    }
+    {
+        int v_13 = z->l - z->c;
+        {
+            int ret = r_step_2a(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - v_13;
+    }
+    {
+        int v_14 = z->l - z->c;
+        {
+            int ret = r_step_2b(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - v_14;
+    }
+    {
+        int v_15 = z->l - z->c;
+        {
+            int ret = r_step_2c(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - v_15;
+    }
+    {
+        int v_16 = z->l - z->c;
+        {
+            int ret = r_step_2d(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - v_16;
+    }
+    {
+        int v_17 = z->l - z->c;
+        {
+            int ret = r_step_3(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - v_17;
+    }
+    {
+        int v_18 = z->l - z->c;
+        {
+            int ret = r_step_4(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - v_18;
+    }
+    {
+        int v_19 = z->l - z->c;
+        {
+            int ret = r_step_5a(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - v_19;
+    }
+    {
+        int v_20 = z->l - z->c;
+        {
+            int ret = r_step_5b(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - v_20;
+    }
+    {
+        int v_21 = z->l - z->c;
+        {
+            int ret = r_step_5c(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - v_21;
+    }
+    {
+        int v_22 = z->l - z->c;
+        {
+            int ret = r_step_5d(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - v_22;
+    }
+    {
+        int v_23 = z->l - z->c;
+        {
+            int ret = r_step_5e(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - v_23;
+    }
+    {
+        int v_24 = z->l - z->c;
+        {
+            int ret = r_step_5f(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - v_24;
+    }
+    {
+        int v_25 = z->l - z->c;
+        {
+            int ret = r_step_5g(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - v_25;
+    }
+    {
+        int v_26 = z->l - z->c;
+        {
+            int ret = r_step_5h(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - v_26;
+    }
+    {
+        int v_27 = z->l - z->c;
+        {
+            int ret = r_step_5j(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - v_27;
+    }
+    {
+        int v_28 = z->l - z->c;
+        {
+            int ret = r_step_5i(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - v_28;
+    }
+    {
+        int v_29 = z->l - z->c;
+        {
+            int ret = r_step_5k(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - v_29;
+    }
+    {
+        int v_30 = z->l - z->c;
+        {
+            int ret = r_step_5l(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - v_30;
+    }
+    {
+        int v_31 = z->l - z->c;
+        {
+            int ret = r_step_5m(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - v_31;
+    }
+    {
+        int v_32 = z->l - z->c;
+        {
+            int ret = r_step_6(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - v_32;
+    }
+    {
+        int v_33 = z->l - z->c;
+        {
+            int ret = r_step_7(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - v_33;
+    }
+    z->c = z->lb;
+    return 1;
+}
+
+extern struct SN_env * greek_UTF_8_create_env(void) {
+    return greek_UTF_8_create_env_with_allocator(NULL);
+}
+
+extern struct SN_env * greek_UTF_8_create_env_with_allocator(const struct SN_allocator * allocator) {
+    struct SN_env * z = SN_new_env_with_allocator(sizeof(SN_local), allocator);
+    if (z) {
+        ((SN_local *)z)->b_test1 = 0;
+    }
+    return z;
+}
+
+extern void greek_UTF_8_close_env(struct SN_env * z) {
+    SN_delete_env(z);
+}
+
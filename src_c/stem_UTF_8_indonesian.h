@@ -0,0 +1,20 @@
+/* Generated from indonesian.sbl by Snowball 3.0.0 - https://snowballstem.org/ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct SN_allocator;
+
+extern struct SN_env * indonesian_UTF_8_create_env(void);
+extern struct SN_env * indonesian_UTF_8_create_env_with_allocator(const struct SN_allocator * allocator);
+extern void indonesian_UTF_8_close_env(struct SN_env * z);
+
+extern int indonesian_UTF_8_stem(struct SN_env * z);
+
+extern int indonesian_UTF_8_stem_ascii(struct SN_env * z);
+#define indonesian_UTF_8_stem_ascii indonesian_UTF_8_stem_ascii
+
+#ifdef __cplusplus
+}
+#endif
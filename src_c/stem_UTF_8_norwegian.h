@@ -0,0 +1,20 @@
+/* Generated from norwegian.sbl by Snowball 3.0.0 - https://snowballstem.org/ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct SN_allocator;
+
+extern struct SN_env * norwegian_UTF_8_create_env(void);
+extern struct SN_env * norwegian_UTF_8_create_env_with_allocator(const struct SN_allocator * allocator);
+extern void norwegian_UTF_8_close_env(struct SN_env * z);
+
+extern int norwegian_UTF_8_stem(struct SN_env * z);
+
+extern int norwegian_UTF_8_stem_ascii(struct SN_env * z);
+#define norwegian_UTF_8_stem_ascii norwegian_UTF_8_stem_ascii
+
+#ifdef __cplusplus
+}
+#endif
@@ -27,6 +27,7 @@
 
 #include "libstemmer.h"
 
+#define U_00E9 "\xc3\xa9"
 #define U_0622 "\xd8\xa2"
 #define U_0627 "\xd8\xa7"
 #define U_062B "\xd8\xab"
@@ -50,15 +51,13 @@ static const struct testcase {
       "a" EMOJI_FACE_THROWING_A_KISS "ing",
       "a" EMOJI_FACE_THROWING_A_KISS "e" },
     { "en", 0, U_40079 "wing", 0 },
-      "a" EMOJI_FACE_THROWING_A_KISS "e" },
-    { "en", 0, U_40079 "wing", 0 },
 
     // The Persian stemmer removes ASCII space inside a word.  It shouldn't
     // appear there if our tokenisation recommendations are followed, and
     // it seems more appropriate to test here rather than adding instances
     // to persian/voc.txt.
     { "fa", 0, U_0622 U_062B " " U_0627 U_0631,
-      U_0622 U_062B U_0627 U_0631, 0 },
+      U_0622 U_062B U_0627 U_0631 },
 
     // The Finnish stemmer used to damage numbers ending with two or more of
     // the same digit.  Regression test, applied to all stemmers.
@@ -77,6 +76,14 @@ static const struct testcase {
     { 0, 0, "space1999", 0 },
     { 0, 0, "hal9000", 0 },
     { 0, 0, "0x0e00", 0 },
+
+    // Words which are all ASCII use a version of the stemmer specialised
+    // for ASCII if there is one, so check words which are and aren't ASCII
+    // on both sides of the 16 byte blocks checked using SIMD.
+    { "en", 0, "generalizations", "general" },
+    { "en", 0, "denationalizations", "denation" },
+    { "en", 0, "rationalizations" U_00E9, 0 },
+    { "en", 0, U_00E9 "rationalizations", U_00E9 "ration" },
     { 0, 0, 0, 0 }
 };
 
@@ -86,7 +93,8 @@ run_testcase(const char * language, const struct testcase *test)
     const char * charenc = test->charenc;
     const char * input = test->input;
     const char * expect = test->expect;
-    struct sb_stemmer * stemmer = sb_stemmer_new(language, charenc);
+    const struct sb_stemmer_module * module = sb_stemmer_module_find(language, charenc);
+    struct sb_stemmer * stemmer = module ? sb_stemmer_new_from_module(module) : NULL;
     const sb_symbol * stemmed;
     int len;
 
@@ -112,9 +120,361 @@ run_testcase(const char * language, const struct testcase *test)
                         language, input, len, stemmed, expect);
         exit(1);
     }
+
+    /* Check sb_stemmer_stem_into() agrees, and handles a short buffer. */
+    {
+        sb_symbol out[64];
+        int out_len;
+        int ret = sb_stemmer_stem_into(stemmer,
+                                       (const unsigned char*)input,
+                                       strlen(input), out, len - 1, &out_len);
+        if (len > 0 && (ret != 1 || out_len != len)) {
+            fprintf(stderr, "%s stemmer stem_into for %s with short buffer returned %d\n",
+                            language, input, ret);
+            exit(1);
+        }
+        ret = sb_stemmer_stem_into(stemmer, (const unsigned char*)input,
+                                   strlen(input), out, sizeof(out), &out_len);
+        if (ret != 0 || out_len != len || memcmp(out, expect, len) != 0) {
+            fprintf(stderr, "%s stemmer stem_into output for %s was %.*s not %s\n",
+                            language, input, out_len, out, expect);
+            exit(1);
+        }
+    }
+
+    /* Check sb_stemmer_stem_inplace() agrees, both with no room to spare
+     * and with plenty of room. */
+    {
+        int size = strlen(input);
+        sb_symbol * buf = malloc(SB_STEMMER_INPLACE_HEAD + size + 64);
+        if (buf == NULL) {
+            fprintf(stderr, "Out of memory");
+            exit(1);
+        }
+        for (int extra = 0; extra <= 64; extra += 64) {
+            int ret;
+            memcpy(buf + SB_STEMMER_INPLACE_HEAD, input, size);
+            ret = sb_stemmer_stem_inplace(stemmer, buf, size, size + extra);
+            if (ret != len ||
+                memcmp(buf + SB_STEMMER_INPLACE_HEAD, expect, len) != 0) {
+                fprintf(stderr, "%s stemmer stem_inplace output for %s was %.*s not %s\n",
+                                language, input, ret,
+                                buf + SB_STEMMER_INPLACE_HEAD, expect);
+                exit(1);
+            }
+        }
+        free(buf);
+    }
+
+    /* Check we get the same result from the cache (the first time fills the
+     * cache, the second time should be a cache hit). */
+    if (sb_stemmer_enable_cache(stemmer, 16) < 0) {
+        fprintf(stderr, "Out of memory");
+        exit(1);
+    }
+    for (int i = 0; i < 2; ++i) {
+        stemmed = sb_stemmer_stem(stemmer, (const unsigned char*)input, strlen(input));
+        len = sb_stemmer_length(stemmer);
+        if (stemmed == NULL ||
+            len != (int)strlen(expect) || memcmp(stemmed, expect, len) != 0) {
+            fprintf(stderr, "%s stemmer cached output for %s was %.*s not %s\n",
+                            language, input, len, stemmed, expect);
+            exit(1);
+        }
+    }
     sb_stemmer_delete(stemmer);
 }
 
+/* Convert the len bytes of UTF-8 at s to UTF-16 at out, returning the
+ * number of code units, or -1 if s contains characters outside the BMP
+ * (where the UTF-8 and UTF-16 stemmers needn't agree).
+ */
+static int
+utf8_to_utf16(const sb_symbol * s, int len, sb_utf16 * out)
+{
+    int i = 0, n = 0;
+    while (i < len) {
+        int ch = s[i++];
+        if (ch >= 0xF0) return -1;
+        if (ch >= 0xE0) {
+            ch = (ch & 0x0F) << 12 | (s[i] & 0x3F) << 6 | (s[i + 1] & 0x3F);
+            i += 2;
+        } else if (ch >= 0xC0) {
+            ch = (ch & 0x1F) << 6 | (s[i] & 0x3F);
+            i += 1;
+        }
+        out[n++] = ch;
+    }
+    return n;
+}
+
+/* Check the UTF-16 version of a stemmer gives the same results as the UTF-8
+ * version for all the testcase inputs.
+ */
+static void
+run_utf16_test(const char * language)
+{
+    struct sb_stemmer * stemmer = sb_stemmer_new(language, NULL);
+    struct sb_stemmer * stemmer16 = sb_stemmer_new(language, "UTF_16");
+    const struct testcase * p;
+
+    if (stemmer16 == NULL) {
+        fprintf(stderr, "No UTF-16 %s stemmer\n", language);
+        exit(1);
+    }
+    for (p = testcases; p->input; ++p) {
+        sb_utf16 word[256];
+        sb_utf16 expect[256];
+        sb_utf16 out[256];
+        const sb_symbol * stemmed;
+        int size, expect_len, len;
+        size = utf8_to_utf16((const sb_symbol *)p->input, strlen(p->input), word);
+        if (size < 0) continue;
+        stemmed = sb_stemmer_stem(stemmer, (const sb_symbol *)p->input,
+                                  strlen(p->input));
+        if (stemmed == NULL) {
+            fprintf(stderr, "Out of memory");
+            exit(1);
+        }
+        expect_len = utf8_to_utf16(stemmed, sb_stemmer_length(stemmer), expect);
+        if (sb_stemmer_stem_utf16(stemmer16, word, size, out, 256, &len) != 0 ||
+            len != expect_len ||
+            memcmp(out, expect, len * sizeof(sb_utf16)) != 0) {
+            fprintf(stderr, "%s UTF-16 stemmer output for %s differs\n",
+                    language, p->input);
+            exit(1);
+        }
+    }
+    sb_stemmer_delete(stemmer);
+    sb_stemmer_delete(stemmer16);
+}
+
+/* Check sb_stemmer_stem_batch() gives the same results as sb_stemmer_stem()
+ * for all the testcase inputs, including when the output buffer fills up.
+ */
+static void
+run_batch_test(const char * language)
+{
+    struct sb_stemmer * stemmer = sb_stemmer_new(language, NULL);
+    sb_symbol words[1024];
+    sb_symbol out[1024];
+    int offsets[64];
+    int out_offsets[64];
+    int count = 0;
+    int done = 0;
+    const struct testcase * p;
+
+    offsets[0] = 0;
+    for (p = testcases; p->input; ++p) {
+        int len = strlen(p->input);
+        memcpy(words + offsets[count], p->input, len);
+        offsets[count + 1] = offsets[count] + len;
+        ++count;
+    }
+
+    /* An output buffer too small for the first stem gives the size needed. */
+    if (sb_stemmer_stem(stemmer, words, offsets[1]) == NULL) {
+        fprintf(stderr, "Out of memory");
+        exit(1);
+    }
+    {
+        int len = sb_stemmer_length(stemmer);
+        int r = sb_stemmer_stem_batch(stemmer, words, offsets, count,
+                                      out, len - 1, out_offsets);
+        if (len > 0 && (r != -2 || out_offsets[1] != len)) {
+            fprintf(stderr, "%s batch stemming with out_size %d gave %d (%d)\n",
+                    language, len - 1, r, out_offsets[1]);
+            exit(1);
+        }
+    }
+
+    while (done < count) {
+        /* Use a small output buffer so we exercise resuming the batch. */
+        int n = sb_stemmer_stem_batch(stemmer, words, offsets + done,
+                                      count - done, out, 20, out_offsets);
+        int i;
+        if (n <= 0) {
+            fprintf(stderr, "%s batch stemming failed (%d)\n", language, n);
+            exit(1);
+        }
+        for (i = 0; i < n; ++i) {
+            const sb_symbol * word = words + offsets[done + i];
+            int word_len = offsets[done + i + 1] - offsets[done + i];
+            const sb_symbol * stemmed = sb_stemmer_stem(stemmer, word, word_len);
+            int len = out_offsets[i + 1] - out_offsets[i];
+            if (stemmed == NULL ||
+                len != sb_stemmer_length(stemmer) ||
+                memcmp(stemmed, out + out_offsets[i], len) != 0) {
+                fprintf(stderr, "%s batch stemmer output for %.*s was %.*s\n",
+                        language, word_len, word, len, out + out_offsets[i]);
+                exit(1);
+            }
+        }
+        done += n;
+    }
+    sb_stemmer_delete(stemmer);
+}
+
+static const struct texttestcase {
+    /* Stemmer to use */
+    const char * language;
+    /* Character encoding (can be 0 for UTF-8) */
+    const char * charenc;
+    /* Input text (0 marks end of list) */
+    const char * input;
+    /* Expected stems, separated by spaces */
+    const char * expect;
+} texttestcases[] = {
+    { "en", 0, "The CONNECTED connections, don't\n(connecting)--dogs' 1999!",
+      "the connect connect don't connect dog 1999" },
+    { "en", 0, "Dog\xe2\x80\x99s \xe2\x80\x9cWords\xe2\x80\x9d",
+      "dog word" },
+    { "de", 0, "\xc3\x9c\x62\x65R \xc3\x84PFEL", "uber apfel" },
+    { "el", 0, "\xce\x9a\xce\x91\xce\x9b\xce\x97\xce\x9c\xce\x95\xce\xa1\xce\x91",
+      "\xce\xba\xce\xb1\xce\xbb\xce\xb7\xce\xbc\xce\xb5\xcf\x81" },
+    { "ru", "KOI8_R", "\xf7\xef\xe4\xe1", "\xd7\xcf\xc4" },
+    /* Invalid UTF-8 and symbols outside the common punctuation blocks
+     * separate words. */
+    { "en", 0, "dogs\xff" "cats\xe2\xb8\xae" "birds", "dog cat bird" },
+    { "en", 0, "dogs\xed\xa0\x80" "cats", "dog cat" },
+    /* 0xFF is DOT ABOVE in ISO-8859-2. */
+    { "hu", "ISO_8859_2", "ablak\xff" "ajto", "abl ajt" },
+    { 0, 0, 0, 0 }
+};
+
+static const struct lowertestcase {
+    /* Input text (0 marks end of list) */
+    const char * input;
+    /* Expected output */
+    const char * expect;
+    /* Expected NFC quick check result */
+    int nfc;
+} lowertestcases[] = {
+    { "", "", SB_NFC_YES },
+    { "ABCDEFGHIJKLMNOPQRSTUVWXYZ[@`{] abcdefghijklmnopqrstuvwxyz",
+      "abcdefghijklmnopqrstuvwxyz[@`{] abcdefghijklmnopqrstuvwxyz", SB_NFC_YES },
+    { "\xc3\x80 LONG ASCII RUN BEFORE \xc3\x96 AND AFTER \xd0\x81\xd0\xaf",
+      "\xc3\xa0 long ascii run before \xc3\xb6 and after \xd1\x91\xd1\x8f", SB_NFC_YES },
+    { "CAFE\xcc\x81", "cafe\xcc\x81", SB_NFC_MAYBE },
+    { "\xe2\x84\xaa", "\xe2\x84\xaa", SB_NFC_NO },
+    { "X\xff", "x\xff", SB_NFC_NO },
+    /* Latin Extended-B letters used for Pinyin, Sami and Livonian. */
+    { "\xc7\xbeL", "\xc7\xbfl", SB_NFC_YES },
+    { "\xc7\x8d\xc7\x95\xc7\x9e\xc7\xb4", "\xc7\x8e\xc7\x96\xc7\x9f\xc7\xb5", SB_NFC_YES },
+    /* Polytonic Greek capitals. */
+    { "\xe1\xbc\x88\xe1\xbf\xbc", "\xe1\xbc\x80\xe1\xbf\xb3", SB_NFC_YES },
+    /* U+0316 (class 220) then U+0315 (class 232) is in canonical order... */
+    { "A\xcc\x96\xcc\x95", "a\xcc\x96\xcc\x95", SB_NFC_YES },
+    /* ...but the other way round isn't. */
+    { "a\xcc\x95\xcc\x96", "a\xcc\x95\xcc\x96", SB_NFC_NO },
+    /* Overlong, surrogate and out of range sequences aren't valid UTF-8. */
+    { "\xe0\x80\x80", "\xe0\x80\x80", SB_NFC_NO },
+    { "\xed\xa0\x80", "\xed\xa0\x80", SB_NFC_NO },
+    { "\xf4\x90\x80\x80", "\xf4\x90\x80\x80", SB_NFC_NO },
+    { 0, 0, 0 }
+};
+
+static void
+run_lower_testcase(const struct lowertestcase * test)
+{
+    char buf[256];
+    int nfc;
+    int len;
+    strcpy(buf, test->input);
+    /* Fold in place, which should also work. */
+    len = sb_stemmer_lower_utf8((const sb_symbol *)buf, strlen(buf),
+                                (sb_symbol *)buf, &nfc);
+    if (len != (int)strlen(test->expect) || memcmp(buf, test->expect, len) != 0 ||
+        nfc != test->nfc) {
+        fprintf(stderr, "lower_utf8 output for %s was %.*s (nfc %d) not %s (nfc %d)\n",
+                test->input, len, buf, nfc, test->expect, test->nfc);
+        exit(1);
+    }
+}
+
+static void
+run_text_testcase(const struct texttestcase * test)
+{
+    struct sb_stemmer * stemmer = sb_stemmer_new(test->language, test->charenc);
+    const sb_symbol * text = (const sb_symbol *)test->input;
+    int size = strlen(test->input);
+    char result[256];
+    int result_len = 0;
+    int out_size;
+
+    /* Try with a full size output buffer, and then with output buffers too
+     * small to hold the results in one go. */
+    for (out_size = size; out_size > 0; out_size -= 5) {
+        int pos = 0;
+        result_len = 0;
+        while (pos < size) {
+            struct sb_stemmer_span spans[3];
+            sb_symbol out[256];
+            int consumed, i;
+            int n = sb_stemmer_stem_text(stemmer, text + pos, size - pos,
+                                         spans, 3, out, out_size, &consumed);
+            if (n == -2) {
+                /* The next word doesn't fit, so it must be longer than
+                 * out_size.  Process just it with a larger buffer. */
+                int start = consumed;
+                n = sb_stemmer_stem_text(stemmer, text + pos, size - pos,
+                                         spans, 1, out, sizeof(out), &consumed);
+                if (n != 1 || spans[0].start != start ||
+                    (spans[0].end - start <= out_size &&
+                     spans[0].stem_len <= out_size)) {
+                    fprintf(stderr, "%s stem_text for %s with out_size %d failed\n",
+                            test->language, test->input, out_size);
+                    exit(1);
+                }
+            }
+            if (n < 0) {
+                fprintf(stderr, "Out of memory");
+                exit(1);
+            }
+            if (n == 0 && consumed < size - pos) {
+                fprintf(stderr, "%s stem_text for %s made no progress\n",
+                        test->language, test->input);
+                exit(1);
+            }
+            for (i = 0; i < n; ++i) {
+                if (result_len) result[result_len++] = ' ';
+                memcpy(result + result_len, out + spans[i].stem, spans[i].stem_len);
+                result_len += spans[i].stem_len;
+            }
+            pos += consumed;
+        }
+        result[result_len] = '\0';
+        if (strcmp(result, test->expect) != 0) {
+            fprintf(stderr, "%s stem_text output for %s was %s not %s\n",
+                    test->language, test->input, result, test->expect);
+            exit(1);
+        }
+    }
+    sb_stemmer_delete(stemmer);
+}
+
+/* Allocator which counts the blocks currently allocated. */
+static void *
+test_allocate(void * context, size_t size)
+{
+    ++*(int *)context;
+    return malloc(size);
+}
+
+static void *
+test_reallocate(void * context, void * p, size_t size)
+{
+    (void)context;
+    return realloc(p, size);
+}
+
+static void
+test_release(void * context, void * p)
+{
+    --*(int *)context;
+    free(p);
+}
+
 int
 main(int argc, char * argv[])
 {
@@ -122,6 +482,11 @@ main(int argc, char * argv[])
     const struct testcase * p;
     (void)argc;
     (void)argv;
+    if (sb_stemmer_module_find("xx", NULL) != NULL ||
+        sb_stemmer_module_find("english", "UTF_32") != NULL) {
+        fprintf(stderr, "sb_stemmer_module_find() found a bogus stemmer\n");
+        exit(1);
+    }
     for (p = testcases; p->input; ++p) {
         const char * language = p->language;
         if (language) {
@@ -134,5 +499,206 @@ main(int argc, char * argv[])
         }
     }
 
+    {
+        const char ** l;
+        for (l = all_languages; *l; ++l) {
+            run_batch_test(*l);
+            run_utf16_test(*l);
+        }
+    }
+
+    {
+        const struct texttestcase * t;
+        for (t = texttestcases; t->input; ++t) {
+            run_text_testcase(t);
+        }
+    }
+
+    {
+        const struct lowertestcase * t;
+        for (t = lowertestcases; t->input; ++t) {
+            run_lower_testcase(t);
+        }
+    }
+
+    /* Check all memory for a stemmer comes from and is returned to the
+     * allocator it is created with. */
+    {
+        int blocks = 0;
+        struct sb_stemmer_allocator allocator;
+        struct sb_stemmer * stemmer;
+        const sb_symbol * stem;
+        allocator.allocate = test_allocate;
+        allocator.reallocate = test_reallocate;
+        allocator.release = test_release;
+        allocator.context = &blocks;
+        /* Danish uses a string variable. */
+        stemmer = sb_stemmer_new_with_allocator("danish", NULL, &allocator);
+        if (stemmer == NULL || blocks == 0 ||
+            sb_stemmer_enable_cache(stemmer, 16) != 0 ||
+            sb_stemmer_reserve(stemmer, 100) != 0) {
+            fprintf(stderr, "sb_stemmer_new_with_allocator() failed\n");
+            exit(1);
+        }
+        stem = sb_stemmer_stem(stemmer, (const sb_symbol *)"indtagelsen", 11);
+        if (stem == NULL || strcmp((const char *)stem, "indtag") != 0) {
+            fprintf(stderr, "stemming failed with custom allocator\n");
+            exit(1);
+        }
+        sb_stemmer_delete(stemmer);
+        if (blocks != 0) {
+            fprintf(stderr, "custom allocator has %d blocks left\n", blocks);
+            exit(1);
+        }
+    }
+
+    /* Check stemming in place keeps the buffer reserved by
+     * sb_stemmer_reserve() rather than freeing it. */
+    {
+        int blocks = 0;
+        int blocks_reserved;
+        struct sb_stemmer_allocator allocator;
+        struct sb_stemmer * stemmer;
+        int buf[(SB_STEMMER_INPLACE_HEAD + 16) / sizeof(int) + 1];
+        sb_symbol * word = (sb_symbol *)buf + SB_STEMMER_INPLACE_HEAD;
+        int i;
+        allocator.allocate = test_allocate;
+        allocator.reallocate = test_reallocate;
+        allocator.release = test_release;
+        allocator.context = &blocks;
+        stemmer = sb_stemmer_new_with_allocator("english", NULL, &allocator);
+        if (stemmer == NULL || sb_stemmer_reserve(stemmer, 1000) != 0) {
+            fprintf(stderr, "Out of memory");
+            exit(1);
+        }
+        blocks_reserved = blocks;
+        for (i = 0; i < 2; ++i) {
+            memcpy(word, "connections", 11);
+            if (sb_stemmer_stem_inplace(stemmer, (sb_symbol *)buf, 11, 16) != 7 ||
+                memcmp(word, "connect", 7) != 0 || blocks != blocks_reserved ||
+                sb_stemmer_stem(stemmer, word, 7) == NULL ||
+                blocks != blocks_reserved) {
+                fprintf(stderr, "sb_stemmer_stem_inplace() lost the reserved buffer\n");
+                exit(1);
+            }
+        }
+        sb_stemmer_delete(stemmer);
+    }
+
+    /* Check the counters (if compiled in) are updated. */
+    {
+        struct sb_stemmer * stemmer = sb_stemmer_new("english", NULL);
+        struct sb_stemmer_stats stats;
+        int ret;
+        sb_stemmer_stem(stemmer, (const sb_symbol *)"connections", 11);
+        sb_stemmer_stem(stemmer, (const sb_symbol *)"dog", 3);
+        ret = sb_stemmer_stats(stemmer, &stats);
+        if (ret == 0 ?
+            (stats.words != 2 || stats.input_symbols != 14 ||
+             stats.output_symbols != 10 || stats.unchanged != 1 ||
+             stats.among_calls == 0) :
+            (ret != -1 || stats.words != 0)) {
+            fprintf(stderr, "sb_stemmer_stats() returned unexpected counts\n");
+            exit(1);
+        }
+        sb_stemmer_delete(stemmer);
+    }
+
+    /* Check stemming works after reserving space for long words. */
+    {
+        struct sb_stemmer * stemmer = sb_stemmer_new("english", NULL);
+        const sb_symbol * stem;
+        if (sb_stemmer_reserve(stemmer, 1000) != 0 ||
+            sb_stemmer_reserve(stemmer, 10) != 0) {
+            fprintf(stderr, "sb_stemmer_reserve() failed\n");
+            exit(1);
+        }
+        stem = sb_stemmer_stem(stemmer, (const sb_symbol *)"connections", 11);
+        if (stem == NULL || strcmp((const char *)stem, "connect") != 0) {
+            fprintf(stderr, "stemming failed after sb_stemmer_reserve()\n");
+            exit(1);
+        }
+        sb_stemmer_delete(stemmer);
+    }
+
+    /* Check stemming UTF-16, including a surrogate pair and an unpaired
+     * surrogate (which should be passed through unchanged). */
+    {
+        static const sb_utf16 connections[] = {
+            'c', 'o', 'n', 'n', 'e', 'c', 't', 'i', 'o', 'n', 's'
+        };
+        static const sb_utf16 surrogates[] = {
+            0xD801, 0xDC00, 'x', 0xDC00, 's'
+        };
+        sb_utf16 out[16];
+        int len;
+        struct sb_stemmer * stemmer = sb_stemmer_new("english", "UTF_16");
+        if (stemmer == NULL) {
+            fprintf(stderr, "No UTF-16 english stemmer\n");
+            exit(1);
+        }
+        if (sb_stemmer_stem_utf16(stemmer, connections, 11, out, 16, &len) != 0 ||
+            len != 7 || memcmp(out, connections, 7 * sizeof(sb_utf16)) != 0) {
+            fprintf(stderr, "sb_stemmer_stem_utf16() failed for connections\n");
+            exit(1);
+        }
+        if (sb_stemmer_stem_utf16(stemmer, connections, 11, out, 6, &len) != 1 ||
+            len != 7) {
+            fprintf(stderr, "sb_stemmer_stem_utf16() should report out too small\n");
+            exit(1);
+        }
+        if (sb_stemmer_stem_utf16(stemmer, surrogates, 5, out, 16, &len) != 0 ||
+            len != 5 || memcmp(out, surrogates, sizeof(surrogates)) != 0) {
+            fprintf(stderr, "sb_stemmer_stem_utf16() failed for surrogates\n");
+            exit(1);
+        }
+        if (sb_stemmer_stem(stemmer, (const sb_symbol *)"dogs", 4) != NULL) {
+            fprintf(stderr, "sb_stemmer_stem() should fail for UTF_16\n");
+            exit(1);
+        }
+        sb_stemmer_delete(stemmer);
+        stemmer = sb_stemmer_new("english", NULL);
+        if (sb_stemmer_stem_utf16(stemmer, connections, 11, out, 16, &len) != -2) {
+            fprintf(stderr, "sb_stemmer_stem_utf16() should fail for UTF_8\n");
+            exit(1);
+        }
+        sb_stemmer_delete(stemmer);
+    }
+
+    /* Check stemmers from the pool work, including after being reused. */
+    {
+        const struct sb_stemmer_module * module = sb_stemmer_module_find("en", NULL);
+        int i;
+        for (i = 0; i < 3; ++i) {
+            struct sb_stemmer * stemmer = sb_stemmer_pool_acquire(module);
+            const sb_symbol * stemmed;
+            if (stemmer == NULL) {
+                fprintf(stderr, "Out of memory");
+                exit(1);
+            }
+            stemmed = sb_stemmer_stem(stemmer, (const sb_symbol *)"pooling", 7);
+            if (stemmed == NULL || strcmp((const char *)stemmed, "pool") != 0) {
+                fprintf(stderr, "pooled stemmer output for pooling was %s\n", stemmed);
+                exit(1);
+            }
+            sb_stemmer_pool_release(stemmer);
+        }
+        sb_stemmer_pool_clear();
+    }
+
+    /* Check the shared cache gives the same results (if it's supported). */
+    if (sb_stemmer_shared_cache_init(1 << 16) == 0) {
+        struct sb_stemmer_cache_stats stats;
+        for (p = testcases; p->input; ++p) {
+            if (p->language) run_testcase(p->language, p);
+        }
+        sb_stemmer_shared_cache_stats(&stats);
+        if (stats.hits + stats.misses == 0 || stats.memory > (1 << 16)) {
+            fprintf(stderr, "unexpected shared cache stats\n");
+            exit(1);
+        }
+        sb_stemmer_shared_cache_free();
+    }
+
     return 0;
 }